@@ -0,0 +1,265 @@
+#include "BenchSupport.h"
+#include "ClanBomber.h"
+#include "GameplayScreen.h"
+#include "GameContext.h"
+#include "GameConfig.h"
+#include "Controller.h"
+#include "Controller_AI_Modern.h"
+#include "Bomber.h"
+#include "TileManager.h"
+#include "ParticleEffectsManager.h"
+#include "AudioMixer.h"
+#include "Timer.h"
+#include "GameRandom.h"
+#include "Replay.h"
+#include "MapIndex.h"
+#include "MapEntry.h"
+#include <benchmark/benchmark.h>
+#include <SDL3/SDL.h>
+#include <glad/gl.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// === BenchArenaMap ===
+
+BenchArenaMap::BenchArenaMap(int size, int spawn_count) {
+    size = std::min(std::max(size, CoordinateConfig::MIN_GRID_WIDTH), CoordinateConfig::MAX_GRID_WIDTH);
+    name = "Bench_Arena_" + std::to_string(size);
+    path = (MapIndex::get_maps_directory() / (name + ".map")).string();
+
+    // Border and pillars solid, the rest boxes or ground from a fixed LCG
+    std::vector<std::string> rows(size, std::string(size, ' '));
+    uint32_t state = 12345;
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            state = state * 1664525u + 1013904223u;
+            bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+            bool pillar = x % 2 == 0 && y % 2 == 0;
+            rows[y][x] = (border || pillar) ? '*' : ((state >> 24) < 150 ? '+' : ' ');
+        }
+    }
+
+    // Spawn pockets on an even grid; odd coordinates never land on a pillar
+    int columns = std::max(1, (int)std::ceil(std::sqrt((double)spawn_count)));
+    int lines = (spawn_count + columns - 1) / columns;
+    for (int i = 0; i < spawn_count; i++) {
+        int x = (1 + (2 * (i % columns) + 1) * (size - 2) / (2 * columns)) | 1;
+        int y = (1 + (2 * (i / columns) + 1) * (size - 2) / (2 * lines)) | 1;
+        if (x > size - 2) x -= 2;
+        if (y > size - 2) y -= 2;
+        const int offsets[5][2] = {{0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+        for (const auto& offset : offsets) {
+            int nx = x + offset[0];
+            int ny = y + offset[1];
+            if (nx >= 1 && ny >= 1 && nx <= size - 2 && ny <= size - 2) {
+                rows[ny][nx] = ' ';
+            }
+        }
+        if (i < 8) {
+            rows[y][x] = static_cast<char>('0' + i);
+        }
+        spawns.emplace_back(x, y);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << "clanbomber-bench\n" << std::min(spawn_count, 8) << "\n";
+    for (const std::string& row : rows) {
+        file << row << "\n";
+    }
+    file.close();
+    MapIndex::rebuild();
+}
+
+BenchArenaMap::~BenchArenaMap() {
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    MapIndex::rebuild();
+}
+
+// === HeadlessRound ===
+
+HeadlessRound::HeadlessRound(int bomber_count, unsigned int seed) : app(nullptr), screen(nullptr) {
+    srand(seed);
+    GameRandom::set_fixed_seed(seed);
+    configure_ai_bombers(bomber_count, 0);
+    create_screen(nullptr);
+    GameRandom::clear_fixed_seed();
+}
+
+HeadlessRound::HeadlessRound(const BenchArenaMap& arena, int bomber_count, unsigned int seed)
+    : app(nullptr), screen(nullptr) {
+    srand(seed);
+    GameRandom::set_fixed_seed(seed);
+
+    const std::vector<MapEntry*>& maps = MapIndex::get_maps();
+    auto it = std::find_if(maps.begin(), maps.end(),
+                           [&arena](MapEntry* entry) { return entry->get_name() == arena.get_name(); });
+    configure_ai_bombers(std::min(bomber_count, 8), it != maps.end() ? (int)(it - maps.begin()) : 0);
+    create_screen(nullptr);
+
+    const std::vector<GridCoord>& spawns = arena.get_spawns();
+    for (int i = 8; i < bomber_count && i < (int)spawns.size(); i++) {
+        add_ai_bomber(i, spawns[i]);
+    }
+    GameRandom::clear_fixed_seed();
+}
+
+HeadlessRound::HeadlessRound(std::shared_ptr<Replay> playback) : app(nullptr), screen(nullptr) {
+    // The replay brings its own config; this file only keeps the player's one untouched
+    GameConfig::set_filename("clanbomber-bench.cfg");
+    create_screen(playback);
+}
+
+void HeadlessRound::configure_ai_bombers(int bomber_count, int start_map) {
+    // Own config file: never touches the player's clanbomber.cfg
+    GameConfig::set_filename("clanbomber-bench.cfg");
+    GameConfig::load();
+    for (int i = 0; i < 8; i++) {
+        GameConfig::bomber[i].set_enabled(i < bomber_count);
+        GameConfig::bomber[i].set_controller(Controller::AI);
+        GameConfig::bomber[i].set_team(0);
+    }
+    GameConfig::set_random_positions(0);
+    GameConfig::set_random_map_order(0);
+    GameConfig::set_start_map(start_map);
+    GameConfig::save();
+}
+
+void HeadlessRound::create_screen(std::shared_ptr<Replay> playback) {
+    app = new ClanBomberApplication();
+    app->text_renderer = nullptr;
+
+    // Same wiring as initialize_game_context(), minus the TextRenderer (no GL here)
+    app->game_context = new GameContext(app->lifecycle_manager.get(), app->tile_manager.get(),
+                                        app->particle_effects.get(), nullptr, nullptr, nullptr);
+    app->tile_manager->set_context(app->game_context);
+
+    screen = new GameplayScreen(app, playback);
+}
+
+void HeadlessRound::add_ai_bomber(int number, const GridCoord& tile) {
+    // Same setup as GameplayScreen's spawn loop; the screen activates it after the start delay
+    Controller* controller = Controller::create(Controller::AI);
+    if (!controller) {
+        return;
+    }
+    PixelCoord center = CoordinateSystem::grid_to_pixel(tile);
+    auto bomber = std::make_unique<Bomber>(static_cast<int>(center.pixel_x), static_cast<int>(center.pixel_y),
+                                           static_cast<Bomber::COLOR>(number % 8), controller, *app->game_context);
+    bomber->set_team(0);
+    bomber->set_number(number);
+    bomber->set_lives(3);
+    app->game_context->register_object(bomber.get());
+    controller->deactivate();
+    bomber->z = 10 + number;
+    app->bomber_objects.push_back(std::move(bomber));
+}
+
+HeadlessRound::~HeadlessRound() {
+    delete screen;
+    delete app;
+}
+
+void HeadlessRound::step(float delta_time) {
+    // Legacy code reads Timer::time_elapsed() directly
+    Timer::set_time_elapsed(delta_time);
+    screen->update(delta_time);
+}
+
+Bomber* HeadlessRound::get_first_bomber() {
+    return app->bomber_objects.empty() ? nullptr : app->bomber_objects.front().get();
+}
+
+size_t HeadlessRound::get_alive_bomber_count() {
+    size_t alive = 0;
+    for (const auto& bomber : app->bomber_objects) {
+        if (bomber && !bomber->is_dead()) {
+            alive++;
+        }
+    }
+    return alive;
+}
+
+// === BenchAccess ===
+
+void BenchAccess::generate_rating_map(Controller_AI_Modern* ai) {
+    ai->generate_rating_map();
+}
+
+bool BenchAccess::find_way(Controller_AI_Modern* ai) {
+    return ai->find_way();
+}
+
+void BenchAccess::clear_jobs(Controller_AI_Modern* ai) {
+    ai->clear_all_jobs();
+}
+
+void BenchAccess::start_voices(MixerAudio* audio, int voices) {
+    for (int i = 0; i < MAX_CHANNELS; i++) {
+        Channel& chan = AudioMixer::channels[i];
+        chan.audio = audio;
+        chan.position = 0;
+        chan.volume = 0.8f;
+        chan.gain = 1.0f;
+        chan.left_gain = 1.0f;
+        chan.right_gain = 0.5f;
+        chan.active = i < voices;
+    }
+}
+
+void BenchAccess::mix(void* stream, int bytes) {
+    AudioMixer::audio_callback(nullptr, static_cast<SDL_AudioStream*>(stream), bytes, bytes);
+}
+
+void BenchAccess::stop_voices() {
+    for (int i = 0; i < MAX_CHANNELS; i++) {
+        AudioMixer::channels[i].active = false;
+    }
+}
+
+// === Allocations ===
+
+void bench_report_allocations(benchmark::State& state, const AllocTracker::Counters& before,
+                              const AllocTracker::Counters& after, double units, const char* unit) {
+    if (!AllocTracker::is_enabled() || units <= 0.0) {
+        return;
+    }
+    double allocations = static_cast<double>(after.total_allocations() - before.total_allocations());
+    double bytes = static_cast<double>(after.total_bytes() - before.total_bytes());
+    state.counters[std::string("allocs_per_") + unit] = allocations / units;
+    state.counters[std::string("alloc_bytes_per_") + unit] = bytes / units;
+}
+
+// === GL ===
+
+bool bench_ensure_gl_context() {
+    static int state = 0; // 0 = sin intentar, 1 = listo, -1 = no disponible
+    if (state != 0) {
+        return state > 0;
+    }
+    state = -1;
+
+    if (!SDL_InitSubSystem(SDL_INIT_VIDEO)) {
+        return false;
+    }
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+
+    SDL_Window* window = SDL_CreateWindow("clanbomber-bench", 64, 64, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (!window) {
+        return false;
+    }
+    SDL_GLContext context = SDL_GL_CreateContext(window);
+    if (!context || !gladLoadGL((GLADloadfunc)SDL_GL_GetProcAddress)) {
+        return false;
+    }
+
+    state = 1;
+    return true;
+}
@@ -0,0 +1,117 @@
+#ifndef BENCHSUPPORT_H
+#define BENCHSUPPORT_H
+
+#include "GameObject.h"
+#include "AllocTracker.h"
+#include "CoordinateSystem.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace benchmark { class State; }
+
+class ClanBomberApplication;
+class GameplayScreen;
+class Controller_AI_Modern;
+class Bomber;
+class Replay;
+struct MixerAudio;
+
+/**
+ * @brief GameObject mínimo para alimentar SpatialGrid/LifecycleManager sin mapa
+ */
+class BenchObject : public GameObject {
+public:
+    BenchObject(int x, int y, ObjectType object_type)
+        : GameObject(x, y, nullptr), type(object_type) {}
+
+    ObjectType get_type() const override { return type; }
+    void move_to(int new_x, int new_y) { set_pos(new_x, new_y); }
+
+private:
+    ObjectType type;
+};
+
+/**
+ * @brief Arena grande generada (data/maps/Bench_Arena_<size>.map) para rondas con muchos bots
+ *
+ * Bloques fijos en las casillas pares, cajas pseudoaleatorias (semilla fija) y
+ * `spawn_count` huecos de salida repartidos en rejilla por todo el mapa. Los 8
+ * primeros llevan los marcadores '0'-'7'; el resto los usa HeadlessRound para
+ * los bots extra. El fichero se borra (y el índice se rehace) al destruirla.
+ */
+class BenchArenaMap {
+public:
+    BenchArenaMap(int size, int spawn_count);
+    ~BenchArenaMap();
+
+    const std::string& get_name() const { return name; }
+    const std::vector<GridCoord>& get_spawns() const { return spawns; }
+
+private:
+    std::string name;
+    std::string path;
+    std::vector<GridCoord> spawns;
+};
+
+/**
+ * @brief Ronda completa sin ventana ni GL: mismo GameplayScreen::update() que el juego
+ *
+ * Usa una configuración propia (clanbomber-bench.cfg) con todos los bombers en IA
+ * y posiciones fijas; rand() y GameRandom se siembran con una semilla fija para
+ * que dos ejecuciones simulen la misma partida.
+ *
+ * Con un Replay, la ronda reproduce la partida grabada (entradas reales de
+ * jugadores en vez de bots) con su configuración y semilla.
+ */
+class HeadlessRound {
+public:
+    explicit HeadlessRound(int bomber_count = 8, unsigned int seed = 12345);
+    explicit HeadlessRound(std::shared_ptr<Replay> playback);
+    // Más de 8 bombers: los que no caben en GameConfig se crean en los huecos de la arena
+    HeadlessRound(const BenchArenaMap& arena, int bomber_count, unsigned int seed = 12345);
+    ~HeadlessRound();
+
+    void step(float delta_time);
+
+    ClanBomberApplication* get_app() { return app; }
+    Bomber* get_first_bomber();
+    size_t get_alive_bomber_count();
+
+private:
+    ClanBomberApplication* app;
+    GameplayScreen* screen;
+
+    void configure_ai_bombers(int bomber_count, int start_map);
+    void create_screen(std::shared_ptr<Replay> playback);
+    void add_ai_bomber(int number, const GridCoord& tile);
+};
+
+/**
+ * @brief Acceso a internals para los microbenchmarks (friend en las clases medidas)
+ */
+struct BenchAccess {
+    static void generate_rating_map(Controller_AI_Modern* ai);
+    static bool find_way(Controller_AI_Modern* ai);
+    static void clear_jobs(Controller_AI_Modern* ai);
+
+    // Activa `voices` canales con el mismo sonido y mezcla `bytes` de salida
+    static void start_voices(MixerAudio* audio, int voices);
+    static void mix(void* stream, int bytes);
+    static void stop_voices();
+};
+
+/**
+ * @brief Añade el contador allocs_per_<unit> (y bytes) desde la instantánea `before`
+ * No hace nada si el core se compiló sin CLANBOMBER_ALLOC_TRACKING.
+ */
+void bench_report_allocations(benchmark::State& state, const AllocTracker::Counters& before,
+                              const AllocTracker::Counters& after, double units, const char* unit);
+
+/**
+ * @brief Ventana oculta + contexto GL para los benchmarks que lo necesitan
+ * @return false si no hay display/GL disponible (el benchmark se salta)
+ */
+bool bench_ensure_gl_context();
+
+#endif
@@ -0,0 +1,57 @@
+#include "BenchSupport.h"
+#include "Bomber.h"
+#include "Controller_AI_Modern.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+    // Primer bomber de una ronda headless, ya con la IA enganchada
+    Controller_AI_Modern* first_ai(HeadlessRound& round) {
+        Bomber* bomber = round.get_first_bomber();
+        return bomber ? dynamic_cast<Controller_AI_Modern*>(bomber->get_controller()) : nullptr;
+    }
+}
+
+static void BM_AI_GenerateRatingMap(benchmark::State& state) {
+    HeadlessRound round;
+    // Unos segundos de partida para que haya bombas y explosiones en el mapa
+    for (int i = 0; i < 120; i++) {
+        round.step(1.0f / 60.0f);
+    }
+
+    Controller_AI_Modern* ai = first_ai(round);
+    if (!ai) {
+        state.SkipWithError("no Controller_AI_Modern attached to bomber 0");
+        return;
+    }
+
+    for (auto _ : state) {
+        BenchAccess::generate_rating_map(ai);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_AI_GenerateRatingMap);
+
+static void BM_AI_FindWay(benchmark::State& state) {
+    HeadlessRound round;
+    for (int i = 0; i < 120; i++) {
+        round.step(1.0f / 60.0f);
+    }
+
+    Controller_AI_Modern* ai = first_ai(round);
+    if (!ai) {
+        state.SkipWithError("no Controller_AI_Modern attached to bomber 0");
+        return;
+    }
+    BenchAccess::generate_rating_map(ai);
+
+    int found = 0;
+    for (auto _ : state) {
+        found += BenchAccess::find_way(ai) ? 1 : 0;
+        // find_way() encola AIJob_Go; se descartan para medir solo la búsqueda
+        state.PauseTiming();
+        BenchAccess::clear_jobs(ai);
+        state.ResumeTiming();
+    }
+    state.counters["found_ratio"] = benchmark::Counter(static_cast<double>(found) / state.iterations());
+}
+BENCHMARK(BM_AI_FindWay);
@@ -0,0 +1,82 @@
+#include "BenchSupport.h"
+#include "AudioMixer.h"
+#include <benchmark/benchmark.h>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace {
+    const int MIX_RATE = 44100;
+}
+
+// Arg 0: voces activas; arg 1: frames por callback (1024 es un bloque típico del dispositivo)
+static void BM_Audio_Mix(benchmark::State& state) {
+    const int voices = static_cast<int>(state.range(0));
+    const int mix_frames = static_cast<int>(state.range(1));
+    const int mix_bytes = mix_frames * 2 * sizeof(Sint16);
+
+    SDL_AudioSpec spec;
+    spec.format = SDL_AUDIO_S16;
+    spec.channels = 2;
+    spec.freq = MIX_RATE;
+
+    // Stream sin dispositivo: audio_callback() escribe aquí y se vacía cada iteración
+    SDL_AudioStream* stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!stream) {
+        state.SkipWithError("SDL_CreateAudioStream failed");
+        return;
+    }
+
+    // Dos segundos de ruido: ningún canal llega al final durante la medición
+    std::vector<Sint16> samples(spec.freq * 2 * 2);
+    Uint32 noise = 0x12345678;
+    for (auto& sample : samples) {
+        noise = noise * 1664525u + 1013904223u;
+        sample = static_cast<Sint16>(noise >> 16);
+    }
+    MixerAudio audio;
+    audio.spec = spec;
+    audio.buffer = reinterpret_cast<Uint8*>(samples.data());
+    audio.length = static_cast<Uint32>(samples.size() * sizeof(Sint16));
+    audio.needs_free = false;
+
+    std::vector<Uint8> drain(mix_bytes);
+    AllocTracker::Counters no_allocs = {};
+    AllocTracker::Counters mix_allocs = {};
+    double worst_us = 0.0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        BenchAccess::start_voices(&audio, voices);
+        AllocTracker::Counters before = AllocTracker::get_totals();
+        state.ResumeTiming();
+
+        auto start = std::chrono::steady_clock::now();
+        BenchAccess::mix(stream, mix_bytes);
+        auto end = std::chrono::steady_clock::now();
+
+        state.PauseTiming();
+        worst_us = std::max(worst_us, std::chrono::duration<double, std::micro>(end - start).count());
+        // Solo cuenta lo que asigna el propio callback
+        AllocTracker::Counters after = AllocTracker::get_totals();
+        for (int tag = 0; tag < ALLOC_TAG_COUNT; tag++) {
+            mix_allocs.allocations[tag] += after.allocations[tag] - before.allocations[tag];
+            mix_allocs.bytes[tag] += after.bytes[tag] - before.bytes[tag];
+        }
+        SDL_GetAudioStreamData(stream, drain.data(), mix_bytes);
+        state.ResumeTiming();
+    }
+
+    BenchAccess::stop_voices();
+    SDL_DestroyAudioStream(stream);
+    state.SetItemsProcessed(state.iterations() * mix_frames);
+    state.counters["voices"] = voices;
+    // Peor callback frente a la duración del bloque que produce (el plazo real del dispositivo)
+    const double deadline_us = 1e6 * mix_frames / MIX_RATE;
+    state.counters["worst_us"] = worst_us;
+    state.counters["worst_deadline_pct"] = 100.0 * worst_us / deadline_us;
+    bench_report_allocations(state, no_allocs, mix_allocs, static_cast<double>(state.iterations()), "callback");
+}
+BENCHMARK(BM_Audio_Mix)
+    ->Args({1, 1024})->Args({4, 1024})->Args({8, 1024})->Args({16, 1024})
+    ->Args({16, 256})->Args({16, 4096});
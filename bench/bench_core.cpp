@@ -0,0 +1,170 @@
+#include "BenchSupport.h"
+#include "SpatialPartitioning.h"
+#include "LifecycleManager.h"
+#include "CoordinateSystem.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <memory>
+#include <cstdlib>
+
+namespace {
+    const int MAP_PIXELS_W = 20 * CoordinateConfig::TILE_SIZE;
+    const int MAP_PIXELS_H = 15 * CoordinateConfig::TILE_SIZE;
+
+    // Mezcla parecida a una ronda: muchas explosiones/bombas, pocos bombers
+    GameObject::ObjectType type_for(int i) {
+        static const GameObject::ObjectType mix[] = {
+            GameObject::EXPLOSION, GameObject::EXPLOSION, GameObject::BOMB,
+            GameObject::BOMB, GameObject::EXTRA, GameObject::BOMBER
+        };
+        return mix[i % 6];
+    }
+
+    std::vector<std::unique_ptr<BenchObject>> make_objects(int count, unsigned int seed) {
+        srand(seed);
+        std::vector<std::unique_ptr<BenchObject>> objects;
+        objects.reserve(count);
+        for (int i = 0; i < count; i++) {
+            objects.push_back(std::make_unique<BenchObject>(rand() % MAP_PIXELS_W, rand() % MAP_PIXELS_H, type_for(i)));
+        }
+        return objects;
+    }
+}
+
+// === SpatialGrid ===
+
+static void BM_SpatialGrid_Insert(benchmark::State& state) {
+    auto objects = make_objects(static_cast<int>(state.range(0)), 1);
+    SpatialGrid grid;
+    for (auto _ : state) {
+        for (auto& obj : objects) {
+            grid.add_object(obj.get());
+        }
+        state.PauseTiming();
+        grid.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpatialGrid_Insert)->Arg(64)->Arg(256)->Arg(1024);
+
+static void BM_SpatialGrid_Move(benchmark::State& state) {
+    auto objects = make_objects(static_cast<int>(state.range(0)), 2);
+    SpatialGrid grid;
+    for (auto& obj : objects) {
+        grid.add_object(obj.get());
+    }
+
+    int step = 0;
+    for (auto _ : state) {
+        // Cada objeto avanza unos pixels; uno de cada ~10 cruza de celda
+        int dx = (step++ & 1) ? 4 : -4;
+        for (auto& obj : objects) {
+            PixelCoord old_position(obj->get_x(), obj->get_y());
+            obj->move_to(obj->get_x() + dx, obj->get_y());
+            grid.update_object_position(obj.get(), old_position);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpatialGrid_Move)->Arg(64)->Arg(256)->Arg(1024);
+
+static void BM_SpatialGrid_TypedQuery(benchmark::State& state) {
+    auto objects = make_objects(static_cast<int>(state.range(0)), 3);
+    SpatialGrid grid;
+    for (auto& obj : objects) {
+        grid.add_object(obj.get());
+    }
+
+    int probe = 0;
+    AllocTracker::Counters before = AllocTracker::get_totals();
+    for (auto _ : state) {
+        PixelCoord position((probe * 37) % MAP_PIXELS_W, (probe * 53) % MAP_PIXELS_H);
+        probe++;
+        auto bombers = grid.get_bombers_near(position, 2);
+        auto bombs = grid.get_bombs_near(position, 1);
+        auto explosions = grid.get_objects_of_type_near(position, GameObject::EXPLOSION, 1);
+        benchmark::DoNotOptimize(bombers.data());
+        benchmark::DoNotOptimize(bombs.data());
+        benchmark::DoNotOptimize(explosions.data());
+    }
+    bench_report_allocations(state, before, AllocTracker::get_totals(),
+                             static_cast<double>(state.iterations()) * 3, "query");
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_SpatialGrid_TypedQuery)->Arg(64)->Arg(256)->Arg(1024);
+
+// === LifecycleManager ===
+
+static void BM_Lifecycle_Register(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto objects = make_objects(count, 4);
+        LifecycleManager manager;
+        state.ResumeTiming();
+
+        for (auto& obj : objects) {
+            manager.register_object(obj.release());
+        }
+
+        state.PauseTiming();
+        manager.clear_all(); // Deletes the objects
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Lifecycle_Register)->Arg(64)->Arg(512);
+
+static void BM_Lifecycle_MarkUpdateCleanup(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto objects = make_objects(count, 5);
+        std::vector<GameObject*> raw;
+        LifecycleManager manager;
+        for (auto& obj : objects) {
+            raw.push_back(obj.get());
+            manager.register_object(obj.release());
+        }
+        state.ResumeTiming();
+
+        // Un cuarto de los objetos muere en este "frame", el resto sigue vivo
+        for (int i = 0; i < count; i += 4) {
+            manager.mark_for_destruction(raw[i]);
+        }
+        manager.update_states(0.2f);  // DYING -> DEAD
+        manager.update_states(0.0f);  // DEAD -> DELETED
+        manager.cleanup_dead_objects();
+
+        state.PauseTiming();
+        manager.clear_all();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Lifecycle_MarkUpdateCleanup)->Arg(64)->Arg(512);
+
+// === CoordinateSystem ===
+
+static void BM_Coordinates_RoundTrip(benchmark::State& state) {
+    int i = 0;
+    for (auto _ : state) {
+        GridCoord grid(i % 20, (i / 20) % 15);
+        PixelCoord center = CoordinateSystem::grid_to_pixel(grid);
+        GridCoord back = CoordinateSystem::pixel_to_grid(center);
+        benchmark::DoNotOptimize(back);
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Coordinates_RoundTrip);
+
+static void BM_Coordinates_ManhattanArea(benchmark::State& state) {
+    GridCoord center(10, 7);
+    for (auto _ : state) {
+        auto area = CoordinateSystem::get_grid_area_manhattan(center, static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(area.data());
+    }
+}
+BENCHMARK(BM_Coordinates_ManhattanArea)->Arg(2)->Arg(5);
@@ -0,0 +1,35 @@
+#include "Logger.h"
+#include <benchmark/benchmark.h>
+#include <SDL3/SDL.h>
+
+/**
+ * clanbomber-bench: microbenchmarks de los sistemas core + rondas headless.
+ *
+ * Salida JSON para seguir tendencias entre commits:
+ *   clanbomber-bench --benchmark_out=bench.json --benchmark_out_format=json
+ */
+int main(int argc, char** argv) {
+    Logger::init();
+    // Los sistemas loguean en INFO a cada objeto creado; eso no se quiere medir
+    Logger::set_level_all(LogLevel::WARNING);
+
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        LOG_ERROR(CORE, "SDL_Init failed: %s", SDL_GetError());
+        Logger::shutdown();
+        return 1;
+    }
+
+#ifdef NDEBUG
+    benchmark::AddCustomContext("clanbomber_build", "release");
+#else
+    benchmark::AddCustomContext("clanbomber_build", "debug");
+#endif
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    SDL_Quit();
+    Logger::shutdown();
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include "BenchSupport.h"
+#include <benchmark/benchmark.h>
+#include "Replay.h"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * Macrobenchmark: N segundos simulados de una ronda de 8 bots, sin ventana ni GL.
+ *
+ * Paso fijo de 1/60 s (el mismo delta que vería el juego a 60 Hz), así que dos
+ * ejecuciones con la misma semilla recorren exactamente la misma partida y
+ * los tiempos son comparables entre commits.
+ */
+static double percentile_ms(const std::vector<double>& sorted_ms, double fraction) {
+    return sorted_ms.empty() ? 0.0 : sorted_ms[static_cast<size_t>(fraction * (sorted_ms.size() - 1))];
+}
+
+static void BM_Round_Headless8Bots(benchmark::State& state) {
+    const float step = 1.0f / 60.0f;
+    const int frames = static_cast<int>(state.range(0)) * 60;
+
+    std::vector<double> frame_ms;
+    frame_ms.reserve(frames);
+    size_t alive_at_end = 0;
+    AllocTracker::Counters step_allocs = {};
+    AllocTracker::Counters no_allocs = {};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        HeadlessRound round(8);
+        frame_ms.clear();
+        state.ResumeTiming();
+
+        AllocTracker::Counters before = AllocTracker::get_totals();
+        for (int i = 0; i < frames; i++) {
+            Uint64 start = SDL_GetPerformanceCounter();
+            round.step(step);
+            Uint64 end = SDL_GetPerformanceCounter();
+            frame_ms.push_back((end - start) * 1000.0 / SDL_GetPerformanceFrequency());
+        }
+        AllocTracker::Counters after = AllocTracker::get_totals();
+        for (int tag = 0; tag < ALLOC_TAG_COUNT; tag++) {
+            step_allocs.allocations[tag] += after.allocations[tag] - before.allocations[tag];
+            step_allocs.bytes[tag] += after.bytes[tag] - before.bytes[tag];
+        }
+
+        state.PauseTiming();
+        alive_at_end = round.get_alive_bomber_count();
+        state.ResumeTiming();
+        // ~HeadlessRound se mide: el teardown de la ronda también es parte del coste
+    }
+
+    std::sort(frame_ms.begin(), frame_ms.end());
+    state.counters["frames"] = frames;
+    state.counters["frame_ms_p50"] = percentile_ms(frame_ms, 0.50);
+    state.counters["frame_ms_p99"] = percentile_ms(frame_ms, 0.99);
+    state.counters["frame_ms_max"] = frame_ms.empty() ? 0.0 : frame_ms.back();
+    state.counters["alive_bombers"] = static_cast<double>(alive_at_end);
+    // Objetivo: 0 en estado estable (el arranque de la ronda no entra en la cuenta)
+    bench_report_allocations(state, no_allocs, step_allocs,
+                             static_cast<double>(frames) * state.iterations(), "frame");
+}
+BENCHMARK(BM_Round_Headless8Bots)->Arg(10)->Arg(60)->Unit(benchmark::kMillisecond)->Iterations(3);
+
+/**
+ * Macrobenchmark: arena grande generada (Arg 0 = lado en casillas) con Arg 1 bots IA.
+ *
+ * Cubre lo que solo aparece fuera del 20x15 clásico: la ventana de búsqueda de
+ * la IA, el refresco local del bitmap de cadáveres y el resto de recorridos de
+ * la rejilla. Comparar frame_ms_p50 entre tamaños: debe crecer con los bots, no
+ * con el área del mapa.
+ */
+static void BM_Round_LargeArena(benchmark::State& state) {
+    const float step = 1.0f / 60.0f;
+    const int frames = 10 * 60;
+    const int size = static_cast<int>(state.range(0));
+    const int bomber_count = static_cast<int>(state.range(1));
+    BenchArenaMap arena(size, bomber_count);
+
+    std::vector<double> frame_ms;
+    frame_ms.reserve(frames);
+    size_t alive_at_end = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        HeadlessRound round(arena, bomber_count);
+        frame_ms.clear();
+        state.ResumeTiming();
+
+        for (int i = 0; i < frames; i++) {
+            Uint64 start = SDL_GetPerformanceCounter();
+            round.step(step);
+            Uint64 end = SDL_GetPerformanceCounter();
+            frame_ms.push_back((end - start) * 1000.0 / SDL_GetPerformanceFrequency());
+        }
+
+        state.PauseTiming();
+        alive_at_end = round.get_alive_bomber_count();
+        state.ResumeTiming();
+    }
+
+    std::sort(frame_ms.begin(), frame_ms.end());
+    state.counters["frames"] = frames;
+    state.counters["tiles"] = static_cast<double>(size) * size;
+    state.counters["frame_ms_p50"] = percentile_ms(frame_ms, 0.50);
+    state.counters["frame_ms_p99"] = percentile_ms(frame_ms, 0.99);
+    state.counters["frame_ms_max"] = frame_ms.empty() ? 0.0 : frame_ms.back();
+    state.counters["alive_bombers"] = static_cast<double>(alive_at_end);
+}
+BENCHMARK(BM_Round_LargeArena)
+    ->Args({20, 8})->Args({128, 8})->Args({256, 8})
+    ->Args({128, 32})->Args({256, 32})->Args({256, 64})
+    ->Unit(benchmark::kMillisecond)->Iterations(3);
+
+/**
+ * Macrobenchmark: una partida grabada (CLANBOMBER_BENCH_REPLAY=<fichero .cbr>)
+ * re-simulada entera sin ventana. Las entradas son las de los jugadores que la
+ * grabaron, así que reproduce los picos de coste que vieron ellos.
+ */
+static void BM_Round_Replay(benchmark::State& state) {
+    const char* path = std::getenv("CLANBOMBER_BENCH_REPLAY");
+    if (!path) {
+        state.SkipWithError("set CLANBOMBER_BENCH_REPLAY=<replay.cbr>");
+        return;
+    }
+    auto load_result = Replay::load(path);
+    if (!load_result.is_ok()) {
+        state.SkipWithError(load_result.get_error_message().c_str());
+        return;
+    }
+    std::shared_ptr<Replay> replay = load_result.get_value();
+    const size_t ticks = replay->get_tick_count();
+    const float step = replay->get_step_seconds();
+
+    std::vector<double> frame_ms;
+    frame_ms.reserve(ticks);
+    for (auto _ : state) {
+        state.PauseTiming();
+        HeadlessRound round(replay);
+        frame_ms.clear();
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < ticks; i++) {
+            Uint64 start = SDL_GetPerformanceCounter();
+            round.step(step);
+            Uint64 end = SDL_GetPerformanceCounter();
+            frame_ms.push_back((end - start) * 1000.0 / SDL_GetPerformanceFrequency());
+        }
+    }
+
+    std::sort(frame_ms.begin(), frame_ms.end());
+    state.counters["frames"] = static_cast<double>(ticks);
+    state.counters["frame_ms_p50"] = percentile_ms(frame_ms, 0.50);
+    state.counters["frame_ms_p99"] = percentile_ms(frame_ms, 0.99);
+    state.counters["frame_ms_max"] = frame_ms.empty() ? 0.0 : frame_ms.back();
+}
+BENCHMARK(BM_Round_Replay)->Unit(benchmark::kMillisecond)->Iterations(3);
@@ -0,0 +1,118 @@
+#include "BenchSupport.h"
+#include "TextRenderer.h"
+#include <benchmark/benchmark.h>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static void BM_Text_CacheHit(benchmark::State& state) {
+    if (!bench_ensure_gl_context()) {
+        state.SkipWithError("no GL context available (headless machine?)");
+        return;
+    }
+
+    // Misma ruta que Game::init_resources(): data/ se copia junto al binario
+    const char* sdl_base_path = SDL_GetBasePath();
+    std::string base_path = sdl_base_path ? sdl_base_path : "./";
+
+    TextRenderer renderer;
+    if (!renderer.initialize() || !renderer.load_font("small", base_path + "data/fonts/DejaVuSans-Bold.ttf", 18)) {
+        state.SkipWithError("TextRenderer could not load data/fonts/DejaVuSans-Bold.ttf");
+        return;
+    }
+
+    // Las mismas cadenas que pinta el HUD cada frame: tras la primera vuelta todo es hit
+    const int distinct = static_cast<int>(state.range(0));
+    std::vector<std::string> texts;
+    for (int i = 0; i < distinct; i++) {
+        texts.push_back("Player " + std::to_string(i) + "  Points: " + std::to_string(i * 10));
+    }
+    SDL_Color white = {255, 255, 255, 255};
+    for (const auto& text : texts) {
+        renderer.render_text(text, "small", white);
+    }
+
+    size_t i = 0;
+    AllocTracker::Counters before = AllocTracker::get_totals();
+    for (auto _ : state) {
+        auto rendered = renderer.render_text(texts[i++ % texts.size()], "small", white);
+        benchmark::DoNotOptimize(rendered);
+    }
+    bench_report_allocations(state, before, AllocTracker::get_totals(),
+                             static_cast<double>(state.iterations()), "call");
+    TextCacheStats cache = renderer.get_cache_stats();
+    state.counters["hit_pct"] = 100.0 * cache.hits / std::max<uint64_t>(1, cache.hits + cache.misses);
+    state.counters["cache_kib"] = static_cast<double>(cache.bytes) / 1024.0;
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Text_CacheHit)->Arg(8)->Arg(64);
+
+static void BM_Text_CacheChurn(benchmark::State& state) {
+    if (!bench_ensure_gl_context()) {
+        state.SkipWithError("no GL context available (headless machine?)");
+        return;
+    }
+
+    const char* sdl_base_path = SDL_GetBasePath();
+    std::string base_path = sdl_base_path ? sdl_base_path : "./";
+
+    TextRenderer renderer;
+    if (!renderer.initialize() || !renderer.load_font("small", base_path + "data/fonts/DejaVuSans-Bold.ttf", 18)) {
+        state.SkipWithError("TextRenderer could not load data/fonts/DejaVuSans-Bold.ttf");
+        return;
+    }
+
+    // Un temporizador que nunca repite cadena: la memoria debe quedarse en el presupuesto
+    renderer.set_cache_budget(static_cast<size_t>(state.range(0)) * 1024);
+    SDL_Color white = {255, 255, 255, 255};
+    int tick = 0;
+    for (auto _ : state) {
+        auto rendered = renderer.render_text("Time " + std::to_string(tick++), "small", white);
+        benchmark::DoNotOptimize(rendered);
+    }
+    TextCacheStats cache = renderer.get_cache_stats();
+    state.counters["cache_kib"] = static_cast<double>(cache.bytes) / 1024.0;
+    state.counters["evictions"] = static_cast<double>(cache.evictions);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Text_CacheChurn)->Arg(256);
+
+static void BM_Text_AtlasLayout(benchmark::State& state) {
+    if (!bench_ensure_gl_context()) {
+        state.SkipWithError("no GL context available (headless machine?)");
+        return;
+    }
+
+    const char* sdl_base_path = SDL_GetBasePath();
+    std::string base_path = sdl_base_path ? sdl_base_path : "./";
+
+    TextRenderer renderer;
+    if (!renderer.initialize() || !renderer.load_font("small", base_path + "data/fonts/DejaVuSans-Bold.ttf", 18)) {
+        state.SkipWithError("TextRenderer could not load data/fonts/DejaVuSans-Bold.ttf");
+        return;
+    }
+
+    // Cadenas que cambian cada frame (contadores): el atlas no crea texturas por cadena
+    const int distinct = static_cast<int>(state.range(0));
+    std::vector<std::string> texts;
+    for (int i = 0; i < distinct; i++) {
+        texts.push_back("Player " + std::to_string(i) + "  Points: " + std::to_string(i * 10));
+    }
+    std::vector<GlyphQuad> quads;
+    int width = 0, height = 0;
+    renderer.layout_text(texts[0], "small", quads, width, height);
+
+    size_t i = 0;
+    AllocTracker::Counters before = AllocTracker::get_totals();
+    for (auto _ : state) {
+        GLuint atlas = renderer.layout_text(texts[i++ % texts.size()], "small", quads, width, height);
+        benchmark::DoNotOptimize(atlas);
+        benchmark::DoNotOptimize(quads.data());
+    }
+    bench_report_allocations(state, before, AllocTracker::get_totals(),
+                             static_cast<double>(state.iterations()), "call");
+    state.counters["atlas_kib"] = static_cast<double>(renderer.get_atlas_bytes()) / 1024.0;
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Text_AtlasLayout)->Arg(8)->Arg(1024);
@@ -0,0 +1,150 @@
+#include "AllocTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // Inicialización constante (ceros): válidos antes de cualquier constructor estático
+    std::atomic<uint64_t> alloc_counts[ALLOC_TAG_COUNT];
+    std::atomic<uint64_t> alloc_bytes[ALLOC_TAG_COUNT];
+    std::atomic<uint64_t> free_count;
+
+    thread_local AllocTag current_tag = ALLOC_TAG_OTHER;
+
+    AllocTracker::Counters previous_totals = {};
+    AllocTracker::Counters last_frame = {};
+
+    const char* const TAG_NAMES[ALLOC_TAG_COUNT] = {
+        "other", "game", "render", "text", "audio", "ai", "spatial", "lifecycle", "particles"
+    };
+}
+
+uint64_t AllocTracker::Counters::total_allocations() const {
+    uint64_t total = 0;
+    for (int i = 0; i < ALLOC_TAG_COUNT; i++) {
+        total += allocations[i];
+    }
+    return total;
+}
+
+uint64_t AllocTracker::Counters::total_bytes() const {
+    uint64_t total = 0;
+    for (int i = 0; i < ALLOC_TAG_COUNT; i++) {
+        total += bytes[i];
+    }
+    return total;
+}
+
+const char* AllocTracker::tag_name(AllocTag tag) {
+    return (tag >= 0 && tag < ALLOC_TAG_COUNT) ? TAG_NAMES[tag] : "?";
+}
+
+AllocTag AllocTracker::swap_tag(AllocTag tag) {
+    AllocTag previous = current_tag;
+    current_tag = tag;
+    return previous;
+}
+
+void AllocTracker::record_allocation(size_t size) {
+    alloc_counts[current_tag].fetch_add(1, std::memory_order_relaxed);
+    alloc_bytes[current_tag].fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocTracker::record_free() {
+    free_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+AllocTracker::Counters AllocTracker::get_totals() {
+    Counters totals;
+    for (int i = 0; i < ALLOC_TAG_COUNT; i++) {
+        totals.allocations[i] = alloc_counts[i].load(std::memory_order_relaxed);
+        totals.bytes[i] = alloc_bytes[i].load(std::memory_order_relaxed);
+    }
+    totals.frees = free_count.load(std::memory_order_relaxed);
+    return totals;
+}
+
+void AllocTracker::end_frame() {
+    Counters totals = get_totals();
+    for (int i = 0; i < ALLOC_TAG_COUNT; i++) {
+        last_frame.allocations[i] = totals.allocations[i] - previous_totals.allocations[i];
+        last_frame.bytes[i] = totals.bytes[i] - previous_totals.bytes[i];
+    }
+    last_frame.frees = totals.frees - previous_totals.frees;
+    previous_totals = totals;
+}
+
+const AllocTracker::Counters& AllocTracker::get_last_frame() {
+    return last_frame;
+}
+
+#if CLANBOMBER_ALLOC_TRACKING
+
+// === Reemplazo de operator new/delete ===
+// Solo las formas sin alineación extendida; las aligned (align_val_t) siguen
+// siendo las de la biblioteca estándar y no se cuentan.
+
+namespace {
+    void* tracked_malloc(std::size_t size) {
+        AllocTracker::record_allocation(size);
+        if (size == 0) {
+            size = 1;
+        }
+        for (;;) {
+            if (void* ptr = std::malloc(size)) {
+                return ptr;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+                return nullptr;
+            }
+            handler();
+        }
+    }
+
+    void tracked_free(void* ptr) {
+        if (ptr) {
+            AllocTracker::record_free();
+            std::free(ptr);
+        }
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* ptr = tracked_malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = tracked_malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return tracked_malloc(size);
+    } catch (...) {
+        return nullptr; // new_handler may throw bad_alloc
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return tracked_malloc(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr) noexcept { tracked_free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { tracked_free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { tracked_free(ptr); }
+
+#endif
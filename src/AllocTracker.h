@@ -0,0 +1,99 @@
+#ifndef ALLOCTRACKER_H
+#define ALLOCTRACKER_H
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Contador global de asignaciones (operator new/delete) por frame y subsistema
+ *
+ * Con CLANBOMBER_ALLOC_TRACKING=1 se reemplazan los operator new/delete globales
+ * (AllocTracker.cpp): cada asignación suma 1 y su tamaño al tag activo del hilo.
+ * ALLOC_SCOPE(ALLOC_TAG_X) cambia el tag hasta el final del scope; los scopes
+ * anidados ganan, así que una query del SpatialGrid dentro de la IA cuenta
+ * como SPATIAL. Los contadores son atómicos: el hilo de audio también suma.
+ *
+ * end_frame() (hilo principal) cierra el frame y deja las diferencias en
+ * get_last_frame(). Los totales acumulados sirven para medir cualquier tramo
+ * de código (benchmarks): leer antes y después y restar.
+ *
+ * Con CLANBOMBER_ALLOC_TRACKING=0 no se toca operator new y todo es no-op.
+ */
+#ifndef CLANBOMBER_ALLOC_TRACKING
+#define CLANBOMBER_ALLOC_TRACKING 0
+#endif
+
+enum AllocTag {
+    ALLOC_TAG_OTHER = 0,     // Fuera de cualquier ALLOC_SCOPE
+    ALLOC_TAG_GAME,
+    ALLOC_TAG_RENDER,
+    ALLOC_TAG_TEXT,
+    ALLOC_TAG_AUDIO,
+    ALLOC_TAG_AI,
+    ALLOC_TAG_SPATIAL,
+    ALLOC_TAG_LIFECYCLE,
+    ALLOC_TAG_PARTICLES,
+    ALLOC_TAG_COUNT
+};
+
+class AllocTracker {
+public:
+    struct Counters {
+        uint64_t allocations[ALLOC_TAG_COUNT];
+        uint64_t bytes[ALLOC_TAG_COUNT];
+        uint64_t frees;
+
+        uint64_t total_allocations() const;
+        uint64_t total_bytes() const;
+    };
+
+    static bool is_enabled() { return CLANBOMBER_ALLOC_TRACKING != 0; }
+    static const char* tag_name(AllocTag tag);
+
+    /**
+     * @brief Cierra el frame actual (llamar una vez por frame desde el hilo principal)
+     */
+    static void end_frame();
+
+    /**
+     * @brief Asignaciones del último frame completo, por tag
+     */
+    static const Counters& get_last_frame();
+
+    /**
+     * @brief Totales acumulados desde el arranque (todos los hilos)
+     */
+    static Counters get_totals();
+
+    // Usados por AllocScope y por los operator new/delete
+    static AllocTag swap_tag(AllocTag tag);
+    static void record_allocation(size_t size);
+    static void record_free();
+};
+
+/**
+ * @brief Marcador RAII: atribuye las asignaciones del scope a un subsistema
+ */
+class AllocScope {
+public:
+    explicit AllocScope(AllocTag tag) : previous(AllocTracker::swap_tag(tag)) {}
+    ~AllocScope() { AllocTracker::swap_tag(previous); }
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+private:
+    AllocTag previous;
+};
+
+#if CLANBOMBER_ALLOC_TRACKING
+#define ALLOC_CONCAT_INNER(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_INNER(a, b)
+#define ALLOC_SCOPE(tag) AllocScope ALLOC_CONCAT(alloc_scope_, __LINE__)(tag)
+#define ALLOC_FRAME_END() AllocTracker::end_frame()
+#else
+#define ALLOC_SCOPE(tag) ((void)0)
+#define ALLOC_FRAME_END() ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,204 @@
+#include "AssetPack.h"
+#include "Logger.h"
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(AssetPack::Header) == 24, "AssetPack::Header is stored as-is on disk");
+static_assert(sizeof(AssetPack::Entry) == 88, "AssetPack::Entry is stored as-is on disk");
+
+static GameResult<void> pack_error(const std::string& message, const std::string& path) {
+    return GameResult<void>::error(GameErrorType::FILE_IO_ERROR, ErrorSeverity::WARNING, message, path);
+}
+
+AssetPack::AssetPack()
+    : mapping(nullptr), file_size(0), entries(nullptr), entry_count(0),
+#ifdef _WIN32
+      file_handle(nullptr), mapping_handle(nullptr)
+#else
+      file_descriptor(-1)
+#endif
+{
+}
+
+AssetPack::~AssetPack() {
+    close();
+}
+
+GameResult<void> AssetPack::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return pack_error("Cannot open asset pack", path);
+    }
+    LARGE_INTEGER size;
+    GetFileSizeEx(file, &size);
+    HANDLE view = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* base = view ? MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    file_handle = file;
+    mapping_handle = view;
+    file_size = (uint64_t)size.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return pack_error("Cannot open asset pack", path);
+    }
+    struct stat info;
+    const void* base = nullptr;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void* mapped = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        base = mapped == MAP_FAILED ? nullptr : mapped;
+        file_size = (uint64_t)info.st_size;
+    }
+    file_descriptor = fd;
+#endif
+    if (!base) {
+        close();
+        return pack_error("Cannot map asset pack", path);
+    }
+    mapping = static_cast<const uint8_t*>(base);
+
+    // Validate everything up front: lookups and uploads then trust the index
+    const Header* header = reinterpret_cast<const Header*>(mapping);
+    if (file_size < sizeof(Header) || std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0) {
+        close();
+        return pack_error("Not an asset pack", path);
+    }
+    if (header->version != VERSION) {
+        uint32_t version = header->version;
+        close();
+        return pack_error("Unsupported asset pack version " + std::to_string(version), path);
+    }
+    uint64_t index_bytes = (uint64_t)header->entry_count * sizeof(Entry);
+    if (header->index_offset % alignof(Entry) != 0 || header->index_offset > file_size ||
+        index_bytes > file_size - header->index_offset) {
+        close();
+        return pack_error("Corrupt asset pack index", path);
+    }
+    entries = reinterpret_cast<const Entry*>(mapping + header->index_offset);
+    entry_count = header->entry_count;
+    for (size_t i = 0; i < entry_count; i++) {
+        const Entry& entry = entries[i];
+        if (entry.name[NAME_LENGTH - 1] != '\0' || entry.offset > file_size || entry.size > file_size - entry.offset) {
+            close();
+            return pack_error("Corrupt asset pack entry", path);
+        }
+        // Textures go to glTexImage2D as-is: the pixels must fill the entry exactly
+        if (entry.type == ENTRY_TEXTURE &&
+            (entry.params[0] <= 0 || entry.params[1] <= 0 ||
+             (uint64_t)entry.params[0] * (uint64_t)entry.params[1] * 4 != entry.size)) {
+            close();
+            return pack_error("Corrupt asset pack texture '" + std::string(entry.name) + "'", path);
+        }
+    }
+
+    LOG_INFO(RESOURCE, "AssetPack: mapped %s (%zu entries, %llu bytes)", path.c_str(), entry_count,
+             (unsigned long long)file_size);
+    return GameResult<void>::success();
+}
+
+void AssetPack::close() {
+#ifdef _WIN32
+    if (mapping) UnmapViewOfFile(mapping);
+    if (mapping_handle) CloseHandle(mapping_handle);
+    if (file_handle) CloseHandle(file_handle);
+    file_handle = nullptr;
+    mapping_handle = nullptr;
+#else
+    if (mapping) munmap(const_cast<uint8_t*>(mapping), (size_t)file_size);
+    if (file_descriptor >= 0) ::close(file_descriptor);
+    file_descriptor = -1;
+#endif
+    mapping = nullptr;
+    file_size = 0;
+    entries = nullptr;
+    entry_count = 0;
+}
+
+const AssetPack::Entry* AssetPack::find(const std::string& name, EntryType type) const {
+    // A few dozen entries: a linear scan beats building a map at startup
+    for (size_t i = 0; i < entry_count; i++) {
+        if (entries[i].type == type && name == entries[i].name) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+// === Writer ===
+
+bool AssetPack::Writer::add(const std::string& name, EntryType type, const void* bytes, uint64_t size,
+                            const int32_t params[4]) {
+    if (name.size() >= NAME_LENGTH) {
+        LOG_WARN(RESOURCE, "AssetPack: name too long, skipping '%s'", name.c_str());
+        return false;
+    }
+
+    // Offsets are absolute: the data block starts right after the header
+    uint64_t offset = sizeof(Header) + data.size();
+    uint64_t padding = (DATA_ALIGNMENT - offset % DATA_ALIGNMENT) % DATA_ALIGNMENT;
+    data.resize(data.size() + padding, 0);
+    offset += padding;
+
+    const uint8_t* source = static_cast<const uint8_t*>(bytes);
+    data.insert(data.end(), source, source + size);
+
+    Entry entry;
+    std::memset(&entry, 0, sizeof(entry));
+    std::memcpy(entry.name, name.c_str(), name.size());
+    entry.type = type;
+    entry.offset = offset;
+    entry.size = size;
+    std::memcpy(entry.params, params, sizeof(entry.params));
+    entries.push_back(entry);
+    return true;
+}
+
+bool AssetPack::Writer::add_texture(const std::string& name, int width, int height, const void* rgba_pixels) {
+    const int32_t params[4] = {width, height, 0, 0};
+    return add(name, ENTRY_TEXTURE, rgba_pixels, (uint64_t)width * height * 4, params);
+}
+
+bool AssetPack::Writer::add_sound(const std::string& name, const SDL_AudioSpec& spec, const void* pcm, uint32_t bytes) {
+    const int32_t params[4] = {spec.freq, (int32_t)spec.format, spec.channels, 0};
+    return add(name, ENTRY_SOUND, pcm, bytes, params);
+}
+
+GameResult<void> AssetPack::Writer::save(const std::string& path) const {
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.entry_count = (uint32_t)entries.size();
+    header.reserved = 0;
+    uint64_t index_offset = sizeof(Header) + data.size();
+    uint64_t padding = (alignof(Entry) - index_offset % alignof(Entry)) % alignof(Entry);
+    header.index_offset = index_offset + padding;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return GameResult<void>::error(GameErrorType::FILE_IO_ERROR, ErrorSeverity::ERROR,
+                                       "Cannot open asset pack for writing", path);
+    }
+    const char zeros[alignof(Entry)] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size());
+    file.write(zeros, (std::streamsize)padding);
+    file.write(reinterpret_cast<const char*>(entries.data()), (std::streamsize)(entries.size() * sizeof(Entry)));
+    if (!file) {
+        return GameResult<void>::error(GameErrorType::FILE_IO_ERROR, ErrorSeverity::ERROR,
+                                       "Failed writing asset pack", path);
+    }
+    return GameResult<void>::success();
+}
@@ -0,0 +1,108 @@
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include "ErrorHandling.h"
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Fichero único de assets ya procesados, leído con mmap sin copias
+ *
+ * Lo genera clanbomber-pack (tools/asset_packer.cpp) a partir de data/:
+ * texturas ya decodificadas a RGBA32 y sonidos ya convertidos al formato del
+ * dispositivo de AudioMixer. En el juego, Resources sube las texturas a GL
+ * y entrega el PCM a AudioMixer apuntando directamente al mapeo: no hay
+ * decodificación ni conversión al arrancar.
+ *
+ * Formato (little-endian, estructuras tal cual en disco):
+ *   Header | datos (cada bloque alineado a DATA_ALIGNMENT) | Entry[entry_count]
+ *
+ * Si el pack no existe, es de otra versión o no tiene un asset, Resources
+ * carga ese asset desde data/ como siempre.
+ */
+class AssetPack {
+public:
+    static constexpr char MAGIC[4] = {'C', 'B', 'P', 'K'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint64_t DATA_ALIGNMENT = 64;
+    static constexpr size_t NAME_LENGTH = 48;
+
+    enum EntryType : uint32_t {
+        ENTRY_TEXTURE = 1,   // params: ancho, alto (RGBA32); open() exige size == ancho * alto * 4
+        ENTRY_SOUND = 2      // params: freq, formato SDL, canales
+    };
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t entry_count;
+        uint32_t reserved;
+        uint64_t index_offset;
+    };
+
+    struct Entry {
+        char name[NAME_LENGTH];    // Terminado en '\0'
+        uint32_t type;
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t size;
+        int32_t params[4];
+    };
+
+    AssetPack();
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    /**
+     * @brief Mapea el fichero y valida cabecera e índice
+     */
+    GameResult<void> open(const std::string& path);
+    void close();
+    bool is_open() const { return mapping != nullptr; }
+
+    const Entry* find(const std::string& name, EntryType type) const;
+
+    /**
+     * @brief Datos de una entrada; válidos mientras el pack siga abierto
+     */
+    const uint8_t* get_data(const Entry& entry) const { return mapping + entry.offset; }
+
+    size_t get_entry_count() const { return entry_count; }
+    uint64_t get_file_size() const { return file_size; }
+
+    /**
+     * @brief Construye un pack en memoria y lo escribe de una vez (herramienta offline)
+     */
+    class Writer {
+    public:
+        bool add_texture(const std::string& name, int width, int height, const void* rgba_pixels);
+        bool add_sound(const std::string& name, const SDL_AudioSpec& spec, const void* pcm, uint32_t bytes);
+        GameResult<void> save(const std::string& path) const;
+
+        size_t get_entry_count() const { return entries.size(); }
+
+    private:
+        std::vector<Entry> entries;
+        std::vector<uint8_t> data;     // Empieza tras el Header
+
+        bool add(const std::string& name, EntryType type, const void* bytes, uint64_t size, const int32_t params[4]);
+    };
+
+private:
+    const uint8_t* mapping;
+    uint64_t file_size;
+    const Entry* entries;
+    size_t entry_count;
+#ifdef _WIN32
+    void* file_handle;
+    void* mapping_handle;
+#else
+    int file_descriptor;
+#endif
+};
+
+#endif
@@ -1,15 +1,93 @@
 #include "AudioMixer.h"
+#include "Logger.h"
+#include "AllocTracker.h"
 #include "GameConstants.h"
+#include "AudioStreamer.h"
 #include <iostream>
 #include <algorithm>
 #include <vector>
 
+// SSE2 is the x86-64 baseline; AVX2 is used only when the build enables it (-mavx2)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_MIX_SSE2 1
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(AUDIO_MIX_SSE2)
+#include <emmintrin.h>
+#endif
+
 // Static member initialization
 SDL_AudioStream* AudioMixer::stream = nullptr;
 SDL_AudioSpec AudioMixer::device_spec;
 std::map<std::string, MixerAudio*> AudioMixer::sounds;
 AudioPosition AudioMixer::listener_pos(GameConstants::DEFAULT_LISTENER_X, GameConstants::DEFAULT_LISTENER_Y, 0.0f);
 Channel AudioMixer::channels[MAX_CHANNELS];
+SPSCRing<AudioCommand, 256> AudioMixer::commands;
+VoiceHandle AudioMixer::next_voice = 1;
+Uint64 AudioMixer::current_tick = 1;
+Uint64 AudioMixer::coalesced_plays = 0;
+std::atomic<StealPolicy> AudioMixer::steal_policy(StealPolicy::OLDEST);
+std::atomic<int> AudioMixer::active_voices(0);
+std::atomic<Uint64> AudioMixer::dropped_commands(0);
+std::atomic<Uint64> AudioMixer::dropped_plays(0);
+std::atomic<Uint64> AudioMixer::stolen_voices(0);
+
+namespace {
+    // Samples (not frames) mixed per pass; bigger requests are mixed in several passes
+    const size_t MIX_CHUNK_SAMPLES = 4096;
+
+    // Only touched by the audio callback: nothing is allocated per block
+    alignas(32) float mix_buffer[MIX_CHUNK_SAMPLES];
+    alignas(32) Sint16 output_buffer[MIX_CHUNK_SAMPLES];
+    alignas(32) Sint16 stream_buffer[MIX_CHUNK_SAMPLES];
+}
+
+// accum += src * gain for interleaved stereo S16; `samples` must be even
+static void mix_voice(float* accum, const Sint16* src, size_t samples, float left, float right) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256 gains = _mm256_setr_ps(left, right, left, right, left, right, left, right);
+    for (; i + 8 <= samples; i += 8) {
+        __m128i pcm = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256 values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(pcm));
+        _mm256_storeu_ps(accum + i, _mm256_add_ps(_mm256_loadu_ps(accum + i), _mm256_mul_ps(values, gains)));
+    }
+#elif defined(AUDIO_MIX_SSE2)
+    const __m128 gains = _mm_setr_ps(left, right, left, right);
+    for (; i + 8 <= samples; i += 8) {
+        __m128i pcm = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        // Sign-extend to 32 bits: put each sample in the high half, shift it back down
+        __m128 low = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(pcm, pcm), 16));
+        __m128 high = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(pcm, pcm), 16));
+        _mm_storeu_ps(accum + i, _mm_add_ps(_mm_loadu_ps(accum + i), _mm_mul_ps(low, gains)));
+        _mm_storeu_ps(accum + i + 4, _mm_add_ps(_mm_loadu_ps(accum + i + 4), _mm_mul_ps(high, gains)));
+    }
+#endif
+    for (; i + 1 < samples; i += 2) {
+        accum[i] += src[i] * left;
+        accum[i + 1] += src[i + 1] * right;
+    }
+}
+
+// Clamp the float mix to S16 (truncating, like the old integer mixer)
+static void pack_s16(const float* accum, Sint16* out, size_t samples) {
+    size_t i = 0;
+#if defined(AUDIO_MIX_SSE2)
+    // Clamp before converting: out-of-range floats would convert to INT_MIN and wrap
+    const __m128 min_sample = _mm_set1_ps((float)SDL_MIN_SINT16);
+    const __m128 max_sample = _mm_set1_ps((float)SDL_MAX_SINT16);
+    for (; i + 8 <= samples; i += 8) {
+        __m128 low = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(accum + i), min_sample), max_sample);
+        __m128 high = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(accum + i + 4), min_sample), max_sample);
+        __m128i packed = _mm_packs_epi32(_mm_cvttps_epi32(low), _mm_cvttps_epi32(high));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+    }
+#endif
+    for (; i < samples; ++i) {
+        out[i] = (Sint16)std::clamp(accum[i], (float)SDL_MIN_SINT16, (float)SDL_MAX_SINT16);
+    }
+}
 
 // Helper functions for 3D audio calculations
 static float calculate_distance(const AudioPosition& sound_pos) {
@@ -38,17 +116,24 @@ static void calculate_stereo_pan(const AudioPosition& sound_pos, float& left_gai
 }
 
 
+SDL_AudioSpec AudioMixer::make_device_spec() {
+    SDL_AudioSpec spec;
+    SDL_zero(spec);
+    spec.freq = 44100;
+    spec.format = SDL_AUDIO_S16LE;
+    spec.channels = 2;
+    return spec;
+}
+
 void AudioMixer::init() {
-    SDL_zero(device_spec);
-    device_spec.freq = 44100;
-    device_spec.format = SDL_AUDIO_S16LE;
-    device_spec.channels = 2;
+    device_spec = make_device_spec();
 
     stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &device_spec, 
                                        audio_callback, nullptr);
     if (!stream) {
         std::cerr << "Failed to open audio mixer stream: " << SDL_GetError() << std::endl;
     } else {
+        AudioStreamer::init(device_spec);
         SDL_ResumeAudioDevice(SDL_GetAudioStreamDevice(stream));
     }
 }
@@ -59,6 +144,19 @@ void AudioMixer::shutdown() {
         stream = nullptr;
     }
     
+    // Stream slots may still be owned by voices or pending PLAYs; shutdown closes them all
+    AudioStreamer::shutdown();
+
+    // The callback is gone, so this thread may act as consumer: drop pending
+    // commands and voices that still point at the sounds freed below
+    AudioCommand pending;
+    while (commands.try_pop(pending)) {}
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        channels[i].active = false;
+        channels[i].stream_slot = -1;
+    }
+    active_voices.store(0, std::memory_order_relaxed);
+    
     for (auto& [name, audio] : sounds) {
         if (audio->needs_free && audio->buffer) {
             SDL_free(audio->buffer);
@@ -72,6 +170,17 @@ MixerAudio* AudioMixer::load_sound(const std::string& path) {
     MixerAudio* audio = new MixerAudio();
     audio->needs_free = true;
     
+    // Big files (music, ambience) stay on disk and are decoded while they play
+    Sint64 data_bytes = AudioStreamer::probe(path);
+    if (data_bytes >= STREAM_THRESHOLD_BYTES) {
+        audio->spec = device_spec;
+        audio->buffer = nullptr;
+        audio->length = 0;
+        audio->stream_path = path;
+        LOG_INFO(AUDIO, "Streaming %s (%lld bytes of PCM) instead of loading it", path.c_str(), (long long)data_bytes);
+        return audio;
+    }
+    
     if (!SDL_LoadWAV(path.c_str(), &audio->spec, &audio->buffer, &audio->length)) {
         std::cerr << "Failed to load sound: " << path << " - " << SDL_GetError() << std::endl;
         delete audio;
@@ -89,7 +198,7 @@ MixerAudio* AudioMixer::load_sound(const std::string& path) {
         int converted_size = 0;
         if (!SDL_ConvertAudioSamples(&audio->spec, audio->buffer, audio->length,
                                    &target_spec, &converted_buffer, &converted_size)) {
-            SDL_Log("Failed to convert sound %s on load: %s", path.c_str(), SDL_GetError());
+            LOG_WARN(AUDIO, "Failed to convert sound %s on load: %s", path.c_str(), SDL_GetError());
             SDL_free(audio->buffer);
             delete audio;
             return nullptr;
@@ -118,92 +227,339 @@ bool AudioMixer::play_sound_3d(const std::string& name, const AudioPosition& pos
     if (!stream) return false;
     
     auto it = sounds.find(name);
-    if (it == sounds.end() || !it->second->buffer) {
+    if (it == sounds.end() || (!it->second->buffer && it->second->stream_path.empty())) {
         return false;
     }
     
     MixerAudio* audio = it->second;
+    float volume, left_gain, right_gain;
+    if (!compute_spatial(pos, max_distance, volume, left_gain, right_gain)) {
+        return true; // Too far or too quiet: nothing to play, not an error
+    }
     
-    float distance = calculate_distance(pos);
-    float volume = 1.0f;
+    // Ten bombs going off in one tick should sound like one loud explosion, not use ten voices
+    if (audio->last_tick == current_tick && audio->last_voice != 0) {
+        coalesced_plays++;
+        if (volume > audio->last_volume) {
+            audio->last_volume = volume;
+            AudioCommand louder = {AudioCommand::SET_POSITION, audio->last_voice, nullptr, volume, left_gain, right_gain, 0, 0, -1};
+            send(louder);
+        }
+        return true;
+    }
     
-    if (max_distance > 0.0f) {
-        if (distance > max_distance) return true; // Too far
-        volume = std::max(0.0f, 1.0f - (distance / max_distance));
-        if (volume < 0.01f) return true; // Too quiet
+    VoiceHandle voice = start(audio, volume, left_gain, right_gain);
+    if (voice == 0) {
+        return false;
     }
+    audio->last_tick = current_tick;
+    audio->last_voice = voice;
+    audio->last_volume = volume;
+    return true;
+}
+
+VoiceHandle AudioMixer::play_voice_3d(const std::string& name, const AudioPosition& pos, float max_distance) {
+    if (!stream) return 0;
     
-    float left_gain, right_gain;
-    calculate_stereo_pan(pos, left_gain, right_gain);
+    auto it = sounds.find(name);
+    if (it == sounds.end() || (!it->second->buffer && it->second->stream_path.empty())) {
+        return 0;
+    }
     
-    // Find an available channel
-    int channel_id = -1;
-    for (int i = 0; i < MAX_CHANNELS; ++i) {
-        if (!channels[i].active) {
-            channel_id = i;
-            break;
-        }
+    // Unlike play_sound_3d, an out-of-range voice still starts (silent): it may move closer
+    float volume, left_gain, right_gain;
+    if (!compute_spatial(pos, max_distance, volume, left_gain, right_gain)) {
+        volume = 0.0f;
     }
     
-    if (channel_id == -1) {
-        // Optional: find the oldest channel and replace it
-        SDL_Log("No free audio channels to play sound: %s", name.c_str());
-        return false; // No free channels
+    return start(it->second, volume, left_gain, right_gain);
+}
+
+VoiceHandle AudioMixer::play_stream(const std::string& path, float gain, bool loop) {
+    if (!stream) return 0;
+    
+    int slot = AudioStreamer::open(path, loop);
+    if (slot < 0) {
+        return 0;
     }
+    float volume, left_gain, right_gain;
+    compute_spatial(listener_pos, 0.0f, volume, left_gain, right_gain);
     
-    // Activate the channel
-    channels[channel_id].audio = audio;
-    channels[channel_id].position = 0;
-    channels[channel_id].volume = volume;
-    channels[channel_id].left_gain = left_gain;
-    channels[channel_id].right_gain = right_gain;
-    channels[channel_id].active = true;
+    VoiceHandle voice = allocate_voice();
+    AudioCommand command = {AudioCommand::PLAY, voice, nullptr, std::max(0.0f, gain), left_gain, right_gain,
+                            255, 0, slot};
+    if (!send(command)) {
+        AudioStreamer::release(slot); // Never reached the audio thread: still ours
+        return 0;
+    }
+    return voice;
+}
+
+VoiceHandle AudioMixer::start(MixerAudio* audio, float volume, float left_gain, float right_gain) {
+    int slot = -1;
+    if (!audio->stream_path.empty()) {
+        slot = AudioStreamer::open(audio->stream_path, false);
+        if (slot < 0) {
+            return 0;
+        }
+    }
     
+    VoiceHandle voice = allocate_voice();
+    AudioCommand command = {AudioCommand::PLAY, voice, audio, volume, left_gain, right_gain,
+                            audio->priority, audio->max_instances, slot};
+    if (!send(command)) {
+        AudioStreamer::release(slot);
+        return 0;
+    }
+    return voice;
+}
+
+void AudioMixer::stop_voice(VoiceHandle voice) {
+    if (voice == 0) return;
+    AudioCommand command = {AudioCommand::STOP, voice, nullptr, 0.0f, 0.0f, 0.0f, 0, 0, -1};
+    send(command);
+}
+
+void AudioMixer::set_voice_gain(VoiceHandle voice, float gain) {
+    if (voice == 0) return;
+    AudioCommand command = {AudioCommand::SET_GAIN, voice, nullptr, std::max(0.0f, gain), 0.0f, 0.0f, 0, 0, -1};
+    send(command);
+}
+
+void AudioMixer::set_voice_position(VoiceHandle voice, const AudioPosition& pos, float max_distance) {
+    if (voice == 0) return;
+    float volume, left_gain, right_gain;
+    if (!compute_spatial(pos, max_distance, volume, left_gain, right_gain)) {
+        volume = 0.0f;
+    }
+    AudioCommand command = {AudioCommand::SET_POSITION, voice, nullptr, volume, left_gain, right_gain, 0, 0, -1};
+    send(command);
+}
+
+void AudioMixer::set_sound_policy(const std::string& name, int priority, int max_instances) {
+    auto it = sounds.find(name);
+    if (it == sounds.end()) {
+        LOG_WARN(AUDIO, "set_sound_policy: unknown sound %s", name.c_str());
+        return;
+    }
+    it->second->priority = (Uint8)std::clamp(priority, 0, 255);
+    it->second->max_instances = (Uint8)std::clamp(max_instances, 0, MAX_CHANNELS);
+}
+
+VoiceHandle AudioMixer::allocate_voice() {
+    VoiceHandle voice = next_voice++;
+    if (next_voice == 0) next_voice = 1; // 0 means "no voice"
+    return voice;
+}
+
+bool AudioMixer::send(const AudioCommand& command) {
+    if (!commands.try_push(command)) {
+        // Audio thread stalled or a burst bigger than the ring: drop rather than block
+        dropped_commands.fetch_add(1, std::memory_order_relaxed);
+        LOG_DEBUG(AUDIO, "Audio command queue full, dropping command %d", command.type);
+        return false;
+    }
     return true;
 }
 
+bool AudioMixer::compute_spatial(const AudioPosition& pos, float max_distance,
+                                 float& volume, float& left_gain, float& right_gain) {
+    volume = 1.0f;
+    if (max_distance > 0.0f) {
+        float distance = calculate_distance(pos);
+        if (distance > max_distance) return false; // Too far
+        volume = std::max(0.0f, 1.0f - (distance / max_distance));
+        if (volume < 0.01f) return false; // Too quiet
+    }
+    calculate_stereo_pan(pos, left_gain, right_gain);
+    return true;
+}
+
+int AudioMixer::get_active_voice_count() {
+    return active_voices.load(std::memory_order_relaxed);
+}
+
 void AudioMixer::set_listener_position(const AudioPosition& pos) {
     listener_pos = pos;
 }
 
-void AudioMixer::audio_callback(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount) {
-    // Buffer for mixing, using 32-bit samples to prevent clipping during accumulation
-    std::vector<Sint32> mix_buffer(additional_amount / sizeof(Sint16), 0);
+Channel* AudioMixer::find_voice(VoiceHandle voice) {
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        if (channels[i].active && channels[i].handle == voice) {
+            return &channels[i];
+        }
+    }
+    return nullptr; // Already finished or never started: nothing to do
+}
+
+static float loudness(const Channel& chan) {
+    return chan.volume * chan.gain * std::max(chan.left_gain, chan.right_gain);
+}
+
+Channel* AudioMixer::pick_victim(const AudioCommand& command, bool same_sound_only) {
+    StealPolicy policy = steal_policy.load(std::memory_order_relaxed);
+    Channel* victim = nullptr;
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        Channel& chan = channels[i];
+        if (!chan.active) continue;
+        if (same_sound_only ? chan.audio != command.audio : chan.priority > command.priority) continue;
+
+        if (!victim || chan.priority < victim->priority) {
+            victim = &chan;
+        } else if (chan.priority == victim->priority) {
+            bool better = policy == StealPolicy::OLDEST ? chan.handle < victim->handle
+                                                        : loudness(chan) < loudness(*victim);
+            if (better) victim = &chan;
+        }
+    }
+
+    // Quietest: an equal-priority voice is only replaced by one that would be heard more
+    if (victim && policy == StealPolicy::QUIETEST && !same_sound_only && victim->priority == command.priority) {
+        float incoming = command.volume * std::max(command.left_gain, command.right_gain);
+        if (incoming <= loudness(*victim)) {
+            return nullptr;
+        }
+    }
+    return victim;
+}
+
+void AudioMixer::end_voice(Channel& chan) {
+    if (chan.stream_slot >= 0) {
+        AudioStreamer::release(chan.stream_slot);
+        chan.stream_slot = -1;
+    }
+    chan.active = false;
+}
 
-    // Mix active channels
+Channel* AudioMixer::allocate_channel(const AudioCommand& command) {
+    Channel* free_channel = nullptr;
+    int instances = 0;
     for (int i = 0; i < MAX_CHANNELS; ++i) {
-        if (channels[i].active) {
+        if (!channels[i].active) {
+            if (!free_channel) free_channel = &channels[i];
+        } else if (channels[i].audio == command.audio) {
+            instances++;
+        }
+    }
+
+    Channel* victim = nullptr;
+    if (command.max_instances > 0 && instances >= command.max_instances) {
+        victim = pick_victim(command, true);    // At its limit: replace one of its own copies
+    } else if (free_channel) {
+        return free_channel;
+    } else {
+        victim = pick_victim(command, false);   // All busy: steal a less important voice
+    }
+
+    if (victim) {
+        stolen_voices.fetch_add(1, std::memory_order_relaxed);
+        end_voice(*victim);
+    }
+    return victim;
+}
+
+void AudioMixer::apply_commands() {
+    AudioCommand command;
+    while (commands.try_pop(command)) {
+        switch (command.type) {
+            case AudioCommand::PLAY: {
+                Channel* chan = allocate_channel(command);
+                if (!chan) {
+                    dropped_plays.fetch_add(1, std::memory_order_relaxed);
+                    AudioStreamer::release(command.stream_slot);
+                    break;
+                }
+                chan->audio = command.audio;
+                chan->position = 0;
+                chan->volume = command.volume;
+                chan->gain = 1.0f;
+                chan->left_gain = command.left_gain;
+                chan->right_gain = command.right_gain;
+                chan->handle = command.voice;
+                chan->priority = command.priority;
+                chan->stream_slot = command.stream_slot;
+                chan->active = true;
+                break;
+            }
+            case AudioCommand::STOP:
+                if (Channel* chan = find_voice(command.voice)) {
+                    end_voice(*chan);
+                }
+                break;
+            case AudioCommand::SET_GAIN:
+                if (Channel* chan = find_voice(command.voice)) {
+                    chan->gain = command.volume;
+                }
+                break;
+            case AudioCommand::SET_POSITION:
+                if (Channel* chan = find_voice(command.voice)) {
+                    chan->volume = command.volume;
+                    chan->left_gain = command.left_gain;
+                    chan->right_gain = command.right_gain;
+                }
+                break;
+        }
+    }
+}
+
+void AudioMixer::audio_callback(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount) {
+    ALLOC_SCOPE(ALLOC_TAG_AUDIO);
+    // Everything the game thread asked for since the last block, before mixing it
+    apply_commands();
+
+    size_t total_samples = (additional_amount / sizeof(Sint16)) & ~(size_t)1; // Whole stereo frames
+    size_t mixed = 0;
+    while (mixed < total_samples) {
+        size_t chunk = std::min(MIX_CHUNK_SAMPLES, total_samples - mixed);
+        std::fill(mix_buffer, mix_buffer + chunk, 0.0f);
+
+        // Mix active channels
+        for (int i = 0; i < MAX_CHANNELS; ++i) {
+            if (!channels[i].active) continue;
             Channel& chan = channels[i];
             MixerAudio* audio = chan.audio;
-            
-            Uint32 remaining_length = audio->length - chan.position;
-            Uint32 amount_to_mix = std::min((Uint32)additional_amount, remaining_length);
-            
-            Sint16* src_samples = (Sint16*)(audio->buffer + chan.position);
-            
-            // Mix into the 32-bit buffer
-            for (Uint32 j = 0; j < amount_to_mix / sizeof(Sint16); j += 2) {
-                // Left channel
-                mix_buffer[j] += (Sint32)(src_samples[j] * chan.volume * chan.left_gain);
-                // Right channel
-                mix_buffer[j + 1] += (Sint32)(src_samples[j + 1] * chan.volume * chan.right_gain);
+            float left = chan.volume * chan.gain * chan.left_gain;
+            float right = chan.volume * chan.gain * chan.right_gain;
+
+            if (chan.stream_slot >= 0) {
+                // Already converted by the decoder thread; a short read is an underrun or the end
+                size_t samples = AudioStreamer::read(chan.stream_slot, stream_buffer, chunk);
+                if (left != 0.0f || right != 0.0f) {
+                    mix_voice(mix_buffer, stream_buffer, samples, left, right);
+                }
+                if (samples < chunk && AudioStreamer::is_finished(chan.stream_slot)) {
+                    end_voice(chan);
+                }
+                continue;
             }
-            
-            chan.position += amount_to_mix;
-            if (chan.position >= audio->length) {
+
+            size_t remaining = (audio->length - chan.position) / sizeof(Sint16);
+            size_t samples = std::min(chunk, remaining) & ~(size_t)1;
+
+            // Silent voices (out of range, muted) keep advancing but cost nothing to mix
+            if (left != 0.0f || right != 0.0f) {
+                mix_voice(mix_buffer, (const Sint16*)(audio->buffer + chan.position), samples, left, right);
+            }
+
+            chan.position += (Uint32)(samples * sizeof(Sint16));
+            if (audio->length - chan.position < 2 * sizeof(Sint16)) {
                 chan.active = false;
             }
         }
-    }
 
-    // Clamp and convert back to 16-bit
-    std::vector<Sint16> final_buffer(additional_amount / sizeof(Sint16));
-    for (size_t i = 0; i < mix_buffer.size(); ++i) {
-        final_buffer[i] = (Sint16)std::clamp(mix_buffer[i], (Sint32)SDL_MIN_SINT16, (Sint32)SDL_MAX_SINT16);
+        pack_s16(mix_buffer, output_buffer, chunk);
+
+        // Put the mixed data into the stream
+        if (!SDL_PutAudioStreamData(stream, output_buffer, (int)(chunk * sizeof(Sint16)))) {
+            LOG_WARN(AUDIO, "Failed to put audio data in callback: %s", SDL_GetError());
+            break;
+        }
+        mixed += chunk;
     }
 
-    // Put the mixed data into the stream
-    if (SDL_PutAudioStreamData(stream, final_buffer.data(), additional_amount) < 0) {
-        SDL_Log("Failed to put audio data in callback: %s", SDL_GetError());
+    int voices = 0;
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        if (channels[i].active) voices++;
     }
+    active_voices.store(voices, std::memory_order_relaxed);
 }
\ No newline at end of file
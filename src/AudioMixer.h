@@ -2,6 +2,8 @@
 #define AUDIOMIXER_H
 
 #include <SDL3/SDL.h>
+#include "SPSCRing.h"
+#include <atomic>
 #include <string>
 #include <vector>
 #include <map>
@@ -12,47 +14,169 @@ struct AudioPosition {
     AudioPosition(float _x = 0.0f, float _y = 0.0f, float _z = 0.0f) : x(_x), y(_y), z(_z) {}
 };
 
+// Identifica una voz concreta (no un canal, que se reutiliza); 0 = ninguna
+typedef Uint32 VoiceHandle;
+
 struct MixerAudio {
     SDL_AudioSpec spec;
     Uint8* buffer;
     Uint32 length;
     bool needs_free;
+    std::string stream_path;      // No vacío: se reproduce con AudioStreamer y buffer es nullptr
+
+    // Reparto de canales (AudioMixer::set_sound_policy); solo hilo de juego
+    Uint8 priority = 0;           // Mayor = más importante
+    Uint8 max_instances = 0;      // Copias simultáneas; 0 = sin límite
+
+    // Coalescencia de disparos en el mismo tick; solo hilo de juego
+    Uint64 last_tick = 0;
+    VoiceHandle last_voice = 0;
+    float last_volume = 0.0f;
 };
 
 const int MAX_CHANNELS = 16;
 
+enum class StealPolicy {
+    OLDEST,     // Sustituye la voz que empezó antes
+    QUIETEST    // Sustituye la voz que menos se oye (y no roba si la nueva sonaría aún menos)
+};
+
+// Estado de una voz: solo lo toca el hilo de audio
 struct Channel {
     MixerAudio* audio = nullptr;
     Uint32 position = 0;
-    float volume = 1.0f;
+    float volume = 1.0f;      // Atenuación por distancia
+    float gain = 1.0f;        // Ganancia pedida con set_voice_gain()
     float left_gain = 1.0f;
     float right_gain = 1.0f;
+    VoiceHandle handle = 0;   // Crece con cada voz: el menor es el más antiguo
+    Uint8 priority = 0;
+    int stream_slot = -1;     // AudioStreamer; -1 = PCM residente en audio->buffer
     bool active = false;
 };
 
+// Orden del hilo de juego al hilo de audio (ver AudioMixer)
+struct AudioCommand {
+    enum Type : Uint8 {
+        PLAY,
+        STOP,
+        SET_GAIN,
+        SET_POSITION
+    };
+
+    Type type;
+    VoiceHandle voice;
+    MixerAudio* audio;        // PLAY
+    float volume;             // PLAY / SET_POSITION: atenuación; SET_GAIN: ganancia
+    float left_gain;          // PLAY / SET_POSITION
+    float right_gain;
+    Uint8 priority;           // PLAY: copia de MixerAudio (el hilo de audio no lo lee de ahí)
+    Uint8 max_instances;
+    int stream_slot;          // PLAY: slot de AudioStreamer ya abierto, o -1
+};
+
+/**
+ * @brief Mezclador software sobre un SDL_AudioStream con callback
+ *
+ * channels[] pertenece al hilo de audio. El hilo de juego (único productor)
+ * no lo toca: play/stop/ganancia/posición se encolan como AudioCommand en un
+ * SPSCRing, y audio_callback() vacía la cola al empezar cada bloque. Así el
+ * callback nunca bloquea ni compite por un mutex, y cada orden se aplica en
+ * el límite de un bloque.
+ *
+ * La posición 3D se resuelve en el hilo de juego (dueño de listener_pos):
+ * las órdenes ya llevan volumen y paneo calculados.
+ *
+ * Con los 16 canales ocupados (una reacción en cadena), un PLAY roba la voz
+ * de menor prioridad según StealPolicy, y cada sonido puede limitar sus
+ * copias simultáneas. Varios play_sound_3d() del mismo sonido en un mismo
+ * tick se funden en una sola voz con el volumen del más cercano.
+ *
+ * Los WAV de más de STREAM_THRESHOLD_BYTES no se cargan: suenan a través de
+ * AudioStreamer, igual que play_stream() (música y ambiente).
+ */
 class AudioMixer {
 public:
+    static constexpr Sint64 STREAM_THRESHOLD_BYTES = 1024 * 1024;
+
     static void init();
     static void shutdown();
+
+    // Formato de salida (y de todos los sonidos cargados); también lo usa clanbomber-pack
+    static SDL_AudioSpec make_device_spec();
     
     static bool play_sound(const std::string& name);
     static bool play_sound_3d(const std::string& name, const AudioPosition& pos, float max_distance = 800.0f);
+
+    // Voces controlables: el handle sigue siendo válido aunque la voz ya haya terminado
+    static VoiceHandle play_voice_3d(const std::string& name, const AudioPosition& pos, float max_distance = 800.0f);
+    static void stop_voice(VoiceHandle voice);
+    static void set_voice_gain(VoiceHandle voice, float gain);
+    static void set_voice_position(VoiceHandle voice, const AudioPosition& pos, float max_distance = 800.0f);
+
+    /**
+     * @brief Reproduce un WAV sin cargarlo entero (música, ambiente), sin posición 3D
+     * Tiene prioridad máxima: los efectos nunca le roban el canal.
+     */
+    static VoiceHandle play_stream(const std::string& path, float gain = 1.0f, bool loop = true);
+
+    /**
+     * @brief Prioridad y límite de copias de un sonido (afecta a los siguientes PLAY)
+     * @param max_instances Al llegar al límite la nueva copia sustituye a otra del mismo sonido; 0 = sin límite
+     */
+    static void set_sound_policy(const std::string& name, int priority, int max_instances);
+    static void set_steal_policy(StealPolicy policy) { steal_policy.store(policy, std::memory_order_relaxed); }
+
+    /**
+     * @brief Marca un tick de simulación nuevo (Game::update); delimita la coalescencia
+     */
+    static void begin_tick() { current_tick++; }
     static MixerAudio* load_sound(const std::string& path);
     static void add_sound(const std::string& name, MixerAudio* audio);
     
     static void set_listener_position(const AudioPosition& pos);
     static AudioPosition get_listener_position() { return listener_pos; }
     
+    static int get_active_voice_count();
+    static Uint64 get_dropped_command_count() { return dropped_commands.load(std::memory_order_relaxed); }
+    static Uint64 get_dropped_play_count() { return dropped_plays.load(std::memory_order_relaxed); }
+    static Uint64 get_stolen_voice_count() { return stolen_voices.load(std::memory_order_relaxed); }
+    static Uint64 get_coalesced_play_count() { return coalesced_plays; }
 
 private:
+    friend struct BenchAccess;  // clanbomber-bench (bench/)
+    
     static void audio_callback(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount);
 
+    // Hilo de juego
+    static VoiceHandle allocate_voice();
+    static bool send(const AudioCommand& command);
+    static bool compute_spatial(const AudioPosition& pos, float max_distance,
+                                float& volume, float& left_gain, float& right_gain);
+
+    // Hilo de audio
+    static void apply_commands();
+    static Channel* find_voice(VoiceHandle voice);
+    static Channel* allocate_channel(const AudioCommand& command);
+    static Channel* pick_victim(const AudioCommand& command, bool same_sound_only);
+    static void end_voice(Channel& chan);
+    static VoiceHandle start(MixerAudio* audio, float volume, float left_gain, float right_gain);
+
     static SDL_AudioStream* stream;
     static SDL_AudioSpec device_spec;
     static std::map<std::string, MixerAudio*> sounds;
     static AudioPosition listener_pos;
     
     static Channel channels[MAX_CHANNELS];
+    static SPSCRing<AudioCommand, 256> commands;
+    static VoiceHandle next_voice;                  // Hilo de juego
+    static Uint64 current_tick;                     // Hilo de juego
+    static Uint64 coalesced_plays;                  // Hilo de juego
+    static std::atomic<StealPolicy> steal_policy;
+    static std::atomic<int> active_voices;          // Publicado por el hilo de audio
+    static std::atomic<Uint64> dropped_commands;    // Cola llena
+    static std::atomic<Uint64> dropped_plays;       // PLAY sin canal libre ni voz que robar
+    static std::atomic<Uint64> stolen_voices;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,300 @@
+#include "AudioStreamer.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+AudioStreamer::Slot AudioStreamer::slots[MAX_STREAMS];
+SDL_AudioSpec AudioStreamer::target_spec;
+std::atomic<Uint64> AudioStreamer::underruns(0);
+std::thread AudioStreamer::decoder;
+std::atomic<bool> AudioStreamer::running(false);
+std::mutex AudioStreamer::wake_mutex;
+std::condition_variable AudioStreamer::wake;
+
+namespace {
+    const size_t DECODE_BYTES = 16384;
+    // Idle poll: well under the ring's ~370 ms, so a busy stream never runs dry
+    const auto DECODER_POLL = std::chrono::milliseconds(5);
+
+    // Decoder thread only
+    Uint8 raw_buffer[DECODE_BYTES];
+    Sint16 pcm_buffer[DECODE_BYTES / sizeof(Sint16)];
+
+    Uint16 read_u16(const Uint8* p) { return (Uint16)(p[0] | (p[1] << 8)); }
+    Uint32 read_u32(const Uint8* p) { return (Uint32)p[0] | ((Uint32)p[1] << 8) | ((Uint32)p[2] << 16) | ((Uint32)p[3] << 24); }
+}
+
+void AudioStreamer::init(const SDL_AudioSpec& device_spec) {
+    if (running) {
+        return;
+    }
+    target_spec = device_spec;
+    running = true;
+    decoder = std::thread(&AudioStreamer::decoder_loop);
+}
+
+void AudioStreamer::shutdown() {
+    if (!running) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        running = false;
+    }
+    wake.notify_one();
+    decoder.join();
+
+    // Callback and decoder are both gone: every slot can be closed from here
+    for (Slot& slot : slots) {
+        close_slot(slot);
+    }
+}
+
+Sint64 AudioStreamer::probe(const std::string& path) {
+    SDL_IOStream* file = SDL_IOFromFile(path.c_str(), "rb");
+    if (!file) {
+        return -1;
+    }
+    SDL_AudioSpec spec;
+    Uint32 frame_bytes, data_start, data_length;
+    bool ok = parse_wav(file, spec, frame_bytes, data_start, data_length);
+    SDL_CloseIO(file);
+    return ok ? (Sint64)data_length : -1;
+}
+
+int AudioStreamer::open(const std::string& path, bool loop) {
+    if (!running) {
+        return -1;
+    }
+    for (int i = 0; i < MAX_STREAMS; ++i) {
+        Slot& slot = slots[i];
+        if (slot.state.load(std::memory_order_acquire) != SLOT_FREE) {
+            continue;
+        }
+        slot.path = path;
+        slot.loop = loop;
+        slot.ended.store(false, std::memory_order_relaxed);
+        slot.state.store(SLOT_OPENING, std::memory_order_release);
+        // Taking the lock orders this notify after an idle decoder's predicate check
+        { std::lock_guard<std::mutex> lock(wake_mutex); }
+        wake.notify_one();
+        return i;
+    }
+    LOG_WARN(AUDIO, "AudioStreamer: no free stream for %s", path.c_str());
+    return -1;
+}
+
+void AudioStreamer::release(int slot) {
+    if (slot >= 0 && slot < MAX_STREAMS) {
+        slots[slot].state.store(SLOT_RELEASED, std::memory_order_release);
+    }
+}
+
+size_t AudioStreamer::read(int slot, Sint16* out, size_t samples) {
+    Slot& s = slots[slot];
+    // The decoder only ever pushes whole frames, so this stays even
+    size_t got = s.pcm.pop_bulk(out, samples & ~(size_t)1);
+    if (got < samples && !s.ended.load(std::memory_order_acquire)) {
+        underruns.fetch_add(1, std::memory_order_relaxed);
+    }
+    return got;
+}
+
+bool AudioStreamer::is_finished(int slot) {
+    Slot& s = slots[slot];
+    // `ended` is published after the last push, so an empty ring afterwards is really the end
+    return s.ended.load(std::memory_order_acquire) && s.pcm.size() == 0;
+}
+
+void AudioStreamer::decoder_loop() {
+    PROFILE_THREAD_NAME("audio-stream");
+    while (running) {
+        for (Slot& slot : slots) {
+            int state = slot.state.load(std::memory_order_acquire);
+            if (state == SLOT_OPENING) {
+                if (!open_slot(slot)) {
+                    slot.ended.store(true, std::memory_order_release); // Owner sees an empty, finished stream
+                }
+                int expected = SLOT_OPENING;
+                slot.state.compare_exchange_strong(expected, SLOT_STREAMING, std::memory_order_acq_rel);
+            } else if (state == SLOT_STREAMING) {
+                fill_slot(slot);
+            } else if (state == SLOT_RELEASED) {
+                close_slot(slot);
+            }
+        }
+
+        // Poll only while a stream is busy; idle, sleep until open() or shutdown().
+        // release() never needs to wake us: it only touches slots that are already busy
+        auto all_free = []() {
+            for (const Slot& slot : slots) {
+                if (slot.state.load(std::memory_order_acquire) != SLOT_FREE) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        std::unique_lock<std::mutex> lock(wake_mutex);
+        if (all_free()) {
+            wake.wait(lock, [&all_free]() { return !running || !all_free(); });
+        } else {
+            wake.wait_for(lock, DECODER_POLL);
+        }
+    }
+}
+
+bool AudioStreamer::open_slot(Slot& slot) {
+    PROFILE_ZONE("AudioStreamer::open_slot");
+    slot.file = SDL_IOFromFile(slot.path.c_str(), "rb");
+    if (!slot.file) {
+        LOG_WARN(AUDIO, "AudioStreamer: cannot open %s: %s", slot.path.c_str(), SDL_GetError());
+        return false;
+    }
+
+    SDL_AudioSpec source_spec;
+    if (!parse_wav(slot.file, source_spec, slot.frame_bytes, slot.data_start, slot.data_length)) {
+        LOG_WARN(AUDIO, "AudioStreamer: %s is not a supported WAV file", slot.path.c_str());
+        return false;
+    }
+    if (SDL_SeekIO(slot.file, slot.data_start, SDL_IO_SEEK_SET) < 0) {
+        return false;
+    }
+
+    slot.converter = SDL_CreateAudioStream(&source_spec, &target_spec);
+    if (!slot.converter) {
+        LOG_WARN(AUDIO, "AudioStreamer: no converter for %s: %s", slot.path.c_str(), SDL_GetError());
+        return false;
+    }
+    slot.data_read = 0;
+    slot.source_done = false;
+    LOG_DEBUG(AUDIO, "AudioStreamer: streaming %s (%u bytes)", slot.path.c_str(), slot.data_length);
+    return true;
+}
+
+void AudioStreamer::fill_slot(Slot& slot) {
+    if (!slot.converter) {
+        return;
+    }
+    PROFILE_ZONE("AudioStreamer::fill_slot");
+    const size_t read_bytes = (DECODE_BYTES / slot.frame_bytes) * slot.frame_bytes;
+
+    for (;;) {
+        size_t space = (slot.pcm.capacity() - slot.pcm.size()) & ~(size_t)1;
+        if (space < REFILL_SAMPLES) {
+            return; // Full enough; the callback will make room
+        }
+
+        int available = SDL_GetAudioStreamAvailable(slot.converter);
+        if (available <= 0) {
+            if (slot.source_done) {
+                slot.ended.store(true, std::memory_order_release);
+                return;
+            }
+            Uint32 left = slot.data_length - slot.data_read;
+            if (left == 0 && slot.loop && slot.data_length > 0) {
+                SDL_SeekIO(slot.file, slot.data_start, SDL_IO_SEEK_SET);
+                slot.data_read = 0;
+                continue;
+            }
+            size_t got = left > 0 ? SDL_ReadIO(slot.file, raw_buffer, std::min((size_t)left, read_bytes)) : 0;
+            got -= got % slot.frame_bytes;
+            if (got == 0) {
+                // End of data (or a truncated file): let the converter hand out what it holds
+                SDL_FlushAudioStream(slot.converter);
+                slot.source_done = true;
+                continue;
+            }
+            slot.data_read += (Uint32)got;
+            SDL_PutAudioStreamData(slot.converter, raw_buffer, (int)got);
+            continue;
+        }
+
+        // The converter only returns whole frames, and the ring takes all of it: `space` was checked
+        int wanted = (int)std::min(space * sizeof(Sint16), sizeof(pcm_buffer)) & ~3;
+        int got = SDL_GetAudioStreamData(slot.converter, pcm_buffer, wanted);
+        if (got <= 0) {
+            return;
+        }
+        slot.pcm.push_bulk(pcm_buffer, (size_t)got / sizeof(Sint16));
+    }
+}
+
+void AudioStreamer::close_slot(Slot& slot) {
+    if (slot.converter) {
+        SDL_DestroyAudioStream(slot.converter);
+        slot.converter = nullptr;
+    }
+    if (slot.file) {
+        SDL_CloseIO(slot.file);
+        slot.file = nullptr;
+    }
+    // The owner released the slot, so nobody is reading from the ring any more
+    slot.pcm.reset();
+    slot.source_done = false;
+    slot.state.store(SLOT_FREE, std::memory_order_release);
+}
+
+bool AudioStreamer::parse_wav(SDL_IOStream* file, SDL_AudioSpec& spec, Uint32& frame_bytes,
+                              Uint32& data_start, Uint32& data_length) {
+    Uint8 header[12];
+    if (SDL_ReadIO(file, header, sizeof(header)) != sizeof(header) ||
+        memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+
+    Sint64 file_size = SDL_GetIOSize(file);
+    bool have_format = false;
+    Uint16 format = 0, bits = 0;
+    for (;;) {
+        Uint8 chunk[8];
+        if (SDL_ReadIO(file, chunk, sizeof(chunk)) != sizeof(chunk)) {
+            return false;
+        }
+        Uint32 size = read_u32(chunk + 4);
+        Sint64 body = SDL_TellIO(file);
+
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            Uint8 fmt[40];
+            size_t wanted = std::min((size_t)size, sizeof(fmt));
+            if (wanted < 16 || SDL_ReadIO(file, fmt, wanted) != wanted) {
+                return false;
+            }
+            format = read_u16(fmt);
+            spec.channels = read_u16(fmt + 2);
+            spec.freq = (int)read_u32(fmt + 4);
+            frame_bytes = read_u16(fmt + 12);
+            bits = read_u16(fmt + 14);
+            if (format == 0xFFFE && wanted >= 26) {
+                format = read_u16(fmt + 24); // WAVE_FORMAT_EXTENSIBLE: sub-format GUID starts with the tag
+            }
+            have_format = true;
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            if (!have_format) {
+                return false;
+            }
+            data_start = (Uint32)body;
+            Sint64 in_file = file_size > body ? file_size - body : 0;
+            data_length = (Uint32)std::min((Sint64)size, in_file);
+            break;
+        }
+
+        // Chunks are padded to an even size
+        if (SDL_SeekIO(file, body + size + (size & 1), SDL_IO_SEEK_SET) < 0) {
+            return false;
+        }
+    }
+
+    if (format == 1 && bits == 8) spec.format = SDL_AUDIO_U8;
+    else if (format == 1 && bits == 16) spec.format = SDL_AUDIO_S16LE;
+    else if (format == 1 && bits == 32) spec.format = SDL_AUDIO_S32LE;
+    else if (format == 3 && bits == 32) spec.format = SDL_AUDIO_F32LE;
+    else return false;
+
+    if (spec.channels <= 0 || spec.freq <= 0 || frame_bytes != (Uint32)(spec.channels * bits / 8)) {
+        return false;
+    }
+    data_length -= data_length % frame_bytes;
+    return true;
+}
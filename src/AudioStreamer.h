@@ -0,0 +1,113 @@
+#ifndef AUDIOSTREAMER_H
+#define AUDIOSTREAMER_H
+
+#include <SDL3/SDL.h>
+#include "SPSCRing.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Reproducción de WAV grandes (música, ambiente) sin cargarlos enteros
+ *
+ * Un hilo decodificador lee cada fichero a trozos, lo convierte al formato
+ * del dispositivo con un SDL_AudioStream y deja el PCM en un SPSCRing por
+ * stream (~370 ms); el callback de AudioMixer solo copia de ese anillo. Así
+ * en RAM solo vive lo que falta por sonar de esos 370 ms, y la conversión se
+ * hace al reproducir, no al arrancar.
+ *
+ * Ciclo de un slot: open() (hilo de juego) lo saca de FREE, el decodificador
+ * lo abre y lo llena, y quien posea la voz (normalmente el hilo de audio)
+ * lo devuelve con release(); el decodificador lo cierra y lo deja en FREE.
+ *
+ * Solo WAV PCM (8/16/32 bits) y float. Un formato comprimido encajaría en
+ * fill_slot(): el resto del camino ya trabaja con PCM decodificado.
+ */
+class AudioStreamer {
+public:
+    static constexpr int MAX_STREAMS = 4;
+
+    static void init(const SDL_AudioSpec& device_spec);
+    static void shutdown();
+
+    /**
+     * @brief Tamaño de los datos PCM de un WAV sin cargarlo
+     * @return -1 si no es un WAV que este streamer sepa leer
+     */
+    static Sint64 probe(const std::string& path);
+
+    // === Hilo de juego ===
+
+    /**
+     * @brief Reserva un slot y pide al decodificador que abra el fichero
+     * @return Índice del slot, o -1 si están todos ocupados
+     */
+    static int open(const std::string& path, bool loop);
+
+    // === Dueño de la voz ===
+
+    static void release(int slot);
+
+    // === Hilo de audio ===
+
+    /**
+     * @brief Copia hasta `samples` muestras S16 estéreo ya convertidas
+     * @return Muestras copiadas (siempre pares); menos de las pedidas = fin o underrun
+     */
+    static size_t read(int slot, Sint16* out, size_t samples);
+
+    /**
+     * @brief El fichero terminó (o no se pudo abrir) y ya no quedan muestras
+     */
+    static bool is_finished(int slot);
+
+    static Uint64 get_underrun_count() { return underruns.load(std::memory_order_relaxed); }
+
+private:
+    enum SlotState {
+        SLOT_FREE,
+        SLOT_OPENING,
+        SLOT_STREAMING,
+        SLOT_RELEASED
+    };
+
+    static constexpr size_t RING_SAMPLES = 32768;     // Potencia de dos; ~370 ms a 44.1 kHz estéreo
+    static constexpr size_t REFILL_SAMPLES = 4096;    // No se rellena por menos de esto
+
+    struct Slot {
+        std::atomic<int> state{SLOT_FREE};
+        std::atomic<bool> ended{false};               // Decodificador: ya no llegará nada más
+        SPSCRing<Sint16, RING_SAMPLES> pcm;
+
+        // Solo decodificador (path y loop los escribe open() antes de publicar OPENING)
+        std::string path;
+        bool loop = false;
+        SDL_IOStream* file = nullptr;
+        SDL_AudioStream* converter = nullptr;
+        Uint32 frame_bytes = 0;
+        Uint32 data_start = 0;
+        Uint32 data_length = 0;
+        Uint32 data_read = 0;
+        bool source_done = false;
+    };
+
+    static Slot slots[MAX_STREAMS];
+    static SDL_AudioSpec target_spec;
+    static std::atomic<Uint64> underruns;
+
+    static std::thread decoder;
+    static std::atomic<bool> running;
+    static std::mutex wake_mutex;
+    static std::condition_variable wake;
+
+    static void decoder_loop();
+    static bool open_slot(Slot& slot);
+    static void fill_slot(Slot& slot);
+    static void close_slot(Slot& slot);
+    static bool parse_wav(SDL_IOStream* file, SDL_AudioSpec& spec, Uint32& frame_bytes,
+                          Uint32& data_start, Uint32& data_length);
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "Bomb.h"
+#include "Logger.h"
 #include "Explosion.h"
 #include "ClanBomber.h"
 #include "GameObject.h"
@@ -18,7 +19,7 @@ Bomb::Bomb(int _x, int _y, int _power, Bomber* _owner, GameContext* context) : G
     
     // GLOBAL CENTERING FIX: Don't override GameObject's centering system!
     // GameObject constructor already centers at tile center - no need to override
-    SDL_Log("💣 BOMB: Using GameObject global centering at (%.1f,%.1f)", x, y);
+    LOG_DEBUG(GAME, "💣 BOMB: Using GameObject global centering at (%.1f,%.1f)", x, y);
 
     // CRITICAL: Set Z-order so bombs render ABOVE tiles
     z = Z_BOMB;  // Bombs should be above tiles (3000 > 0)
@@ -67,7 +68,7 @@ void Bomb::explode() {
     // Decrement bomb count for the owner
     if (owner) {
         owner->dec_current_bombs();
-        SDL_Log("Bomb exploded, bomber now has %d/%d bombs", owner->get_current_bombs(), owner->get_max_bombs());
+        LOG_DEBUG(GAME, "Bomb exploded, bomber now has %d/%d bombs", owner->get_current_bombs(), owner->get_max_bombs());
     }
     
     // Play explosion sound with 3D positioning
@@ -1,4 +1,5 @@
 #include "Bomber.h"
+#include "Logger.h"
 #include "BomberComponents.h"
 #include "Controller.h"
 #include "ClanBomber.h"
@@ -27,12 +28,12 @@ Bomber::Bomber(int _x, int _y, COLOR _color, Controller* _controller, GameContex
     // Configure animation component with color
     animation_component->set_texture_from_color(static_cast<int>(color));
     
-    SDL_Log("Bomber: Created modern component-based bomber at (%d,%d) with color %d", _x, _y, static_cast<int>(color));
+    LOG_DEBUG(GAME, "Bomber: Created modern component-based bomber at (%d,%d) with color %d", _x, _y, static_cast<int>(color));
 }
 
 Bomber::~Bomber() {
     // Components are automatically cleaned up via unique_ptr
-    SDL_Log("Bomber: Destroyed bomber with modern component cleanup");
+    LOG_DEBUG(GAME, "Bomber: Destroyed bomber with modern component cleanup");
 }
 
 // ===== CORE GAME LOOP =====
@@ -1,4 +1,5 @@
 #include "BomberComponents.h"
+#include "Logger.h"
 #include "GameObject.h"
 #include "ClanBomber.h"
 #include "Controller.h"
@@ -83,7 +84,7 @@ void BomberMovementComponent::fly_to(int target_x, int target_y, float duration_
     this->target_x = target_x;
     this->target_y = target_y;
     
-    SDL_Log("BomberMovementComponent: Starting flight from (%d,%d) to (%d,%d) over %.2fs", 
+    LOG_DEBUG(GAME, "BomberMovementComponent: Starting flight from (%d,%d) to (%d,%d) over %.2fs", 
             start_x, start_y, target_x, target_y, flight_duration);
 }
 
@@ -113,7 +114,7 @@ void BomberMovementComponent::update_flight_animation(float deltaTime) {
         // Reset any movement blocking flags
         owner->stop(); // Ensure GameObject is in proper stopped state
         
-        SDL_Log("BomberMovementComponent: Flight animation complete at (%d,%d) - controls restored", target_x, target_y);
+        LOG_DEBUG(GAME, "BomberMovementComponent: Flight animation complete at (%d,%d) - controls restored", target_x, target_y);
     } else {
         // Interpolate position
         int current_x = start_x + (int)((target_x - start_x) * progress);
@@ -181,8 +182,8 @@ void BomberCombatComponent::place_bomb() {
     int expected_map_x = expected_grid.grid_x;
     int expected_map_y = expected_grid.grid_y;
     
-    SDL_Log("🔍 DEBUG: Bomber at (%d,%d) -> get_map_x()=%d, get_map_y()=%d", bomber_x, bomber_y, map_x, map_y);
-    SDL_Log("🔍 DEBUG: Expected tile calculation: (%d+%d)/%d=%d, (%d+%d)/%d=%d", bomber_x, TILE_SIZE/2, TILE_SIZE, expected_map_x, bomber_y, TILE_SIZE/2, TILE_SIZE, expected_map_y);
+    LOG_DEBUG(GAME, "Bomber at (%d,%d) -> get_map_x()=%d, get_map_y()=%d", bomber_x, bomber_y, map_x, map_y);
+    LOG_DEBUG(GAME, "Expected tile calculation: (%d+%d)/%d=%d, (%d+%d)/%d=%d", bomber_x, TILE_SIZE/2, TILE_SIZE, expected_map_x, bomber_y, TILE_SIZE/2, TILE_SIZE, expected_map_y);
     
     // Check if there's already a bomb at this position
     if (context->has_bomb_at(map_x, map_y)) {
@@ -195,7 +196,7 @@ void BomberCombatComponent::place_bomb() {
     int bomb_x = static_cast<int>(center.pixel_x);
     int bomb_y = static_cast<int>(center.pixel_y);
     
-    SDL_Log("💣 PLACE BOMB: Bomber at (%d,%d) -> tile (%d,%d) -> Bomb created at center (%d,%d)", 
+    LOG_DEBUG(GAME, "💣 PLACE BOMB: Bomber at (%d,%d) -> tile (%d,%d) -> Bomb created at center (%d,%d)", 
             bomber_x, bomber_y, map_x, map_y, bomb_x, bomb_y);
     
     // MODERN: Use smart pointer creation and automatic registration
@@ -214,9 +215,9 @@ void BomberCombatComponent::place_bomb() {
     bomb_standing_on = bomb;
     has_left_bomb_tile = false;
     
-    SDL_Log("🎯 BOMB ESCAPE: Bomber can move freely while on bomb at tile (%d,%d)", 
+    LOG_TRACE(GAME, "🎯 BOMB ESCAPE: Bomber can move freely while on bomb at tile (%d,%d)", 
             map_x, map_y);
-    SDL_Log("BomberCombatComponent: Placed bomb at (%d,%d) with power %d", map_x, map_y, power);
+    LOG_DEBUG(GAME, "BomberCombatComponent: Placed bomb at (%d,%d) with power %d", map_x, map_y, power);
 }
 
 void BomberCombatComponent::throw_bomb() {
@@ -245,7 +246,7 @@ void BomberCombatComponent::throw_bomb() {
     inc_current_bombs();
     bomb_cooldown = 0.2f; // 200ms cooldown
     
-    SDL_Log("BomberCombatComponent: Threw bomb from (%d,%d) with power %d", 
+    LOG_DEBUG(GAME, "BomberCombatComponent: Threw bomb from (%d,%d) with power %d", 
             owner->get_x(), owner->get_y(), power);
 }
 
@@ -266,7 +267,7 @@ void BomberCombatComponent::die() {
     AudioPosition death_pos(owner->get_x(), owner->get_y(), 0.0f);
     AudioMixer::play_sound_3d("die", death_pos, 600.0f);
     
-    SDL_Log("BomberCombatComponent: Bomber died at (%d,%d)", owner->get_x(), owner->get_y());
+    LOG_DEBUG(GAME, "BomberCombatComponent: Bomber died at (%d,%d)", owner->get_x(), owner->get_y());
 }
 
 void BomberCombatComponent::update_bomb_cooldown(float deltaTime) {
@@ -288,7 +289,7 @@ void BomberCombatComponent::update_bomb_throwing(float deltaTime) {
 bool BomberCombatComponent::can_ignore_bomb_collision(Bomb* bomb) const {
     // Only ignore collision if bomber is standing on this specific bomb and hasn't left its tile
     bool result = (bomb_standing_on == bomb && !has_left_bomb_tile);
-    SDL_Log("🔍 BOMB ESCAPE CHECK: standing_on=%p, checking=%p, has_left=%d, result=%d", 
+    LOG_TRACE(GAME, "🔍 BOMB ESCAPE CHECK: standing_on=%p, checking=%p, has_left=%d, result=%d", 
             bomb_standing_on, bomb, has_left_bomb_tile, result);
     return result;
 }
@@ -308,7 +309,7 @@ void BomberCombatComponent::update_bomb_escape_status() {
         // Bomber has left the bomb tile - enable collisions
         if (!has_left_bomb_tile) {
             has_left_bomb_tile = true;
-            SDL_Log("🏃 BOMB ESCAPE: Bomber left bomb tile - collision enabled");
+            LOG_TRACE(GAME, "🏃 BOMB ESCAPE: Bomber left bomb tile - collision enabled");
         }
     }
 }
@@ -431,7 +432,7 @@ void BomberLifecycleComponent::respawn() {
     respawning = true;
     respawn_timer = 3.0f; // 3 seconds respawn delay
     
-    SDL_Log("BomberLifecycleComponent: Starting respawn for %s (%d lives remaining)", 
+    LOG_DEBUG(GAME, "BomberLifecycleComponent: Starting respawn for %s (%d lives remaining)", 
             bomber_name.c_str(), remaining_lives);
 }
 
@@ -441,6 +442,6 @@ void BomberLifecycleComponent::update_respawn_timer(float deltaTime) {
         respawning = false;
         respawn_timer = 0.0f;
         
-        SDL_Log("BomberLifecycleComponent: Respawn complete for %s", bomber_name.c_str());
+        LOG_DEBUG(GAME, "BomberLifecycleComponent: Respawn complete for %s", bomber_name.c_str());
     }
 }
\ No newline at end of file
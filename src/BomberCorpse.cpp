@@ -1,10 +1,10 @@
 #include "BomberCorpse.h"
-#include "CorpsePart.h"
 #include "ClanBomber.h"
 #include "GameObject.h"
 #include "AudioMixer.h"
 #include "Timer.h"
-#include "ParticleSystem.h"
+#include "ParticleEffectsManager.h"
+#include "DecalLayer.h"
 #include "GameContext.h"
 #include "MemoryManagement.h"
 #include <random>
@@ -82,10 +82,17 @@ void BomberCorpse::create_gore_explosion() {
     std::random_device rd;
     std::mt19937 gen(rd());
     
-    // Add particle effects for gore explosion using ObjectPool pattern
-    ParticleSystem* blood_splatter = GameObjectFactory::getInstance().create_particle_system(x, y, static_cast<int>(FIRE_PARTICLES), get_context()); // Red particles
+    ParticleEffectsManager* effects = get_context() ? get_context()->get_particle_effects() : nullptr;
+    if (!effects) {
+        return;
+    }
+    
+    // Add particle effects for gore explosion (pooled by ParticleEffectsManager)
+    effects->spawn_emitter(x, y, FIRE_PARTICLES);
+    effects->spawn_emitter(x, y, SMOKE_TRAILS);
     
-    ParticleSystem* gore_smoke = GameObjectFactory::getInstance().create_particle_system(x, y, static_cast<int>(SMOKE_TRAILS), get_context());
+    // Body parts and blood go to the SoA gore system, not the GameObject world
+    CorpsePhysicsSystem* gore = effects->get_corpse_physics();
     
     // Create 8-12 body parts with realistic explosion physics
     std::uniform_int_distribution<> part_count_dist(8, 12);
@@ -117,25 +124,22 @@ void BomberCorpse::create_gore_explosion() {
         float start_y = y + pos_offset(gen);
         
         // Create corpse part with advanced physics
-        CorpsePart* part = new CorpsePart(start_x, start_y, part_type, vel_x, vel_y, explosion_force, get_context());
-        get_context()->register_object(part);
+        gore->spawn_part(start_x, start_y, part_type, vel_x, vel_y, explosion_force);
     }
     
-    // Create additional blood splatter effect
+    // Blood spray: droplets are stamped straight into the floor decals where they
+    // land, they are not corpse parts (those render as full body-part sprites)
+    DecalLayer* decals = effects->get_decals();
+    std::uniform_real_distribution<> flight_time_dist(0.05f, 0.2f);
+    std::uniform_real_distribution<> droplet_size_dist(3.0f, 8.0f);
     for (int i = 0; i < 20; i++) {
         float angle = angle_dist(gen);
         float velocity = velocity_dist(gen) * 0.6f; // Smaller blood droplets
-        float force = force_dist(gen) * 0.3f;
-        
-        float vel_x = std::cos(angle) * velocity;
-        float vel_y = std::sin(angle) * velocity * 0.8f; // Less upward for blood
+        float flight_time = flight_time_dist(gen);
         
-        std::uniform_real_distribution<> blood_offset(-20.0f, 20.0f);
-        float start_x = x + blood_offset(gen);
-        float start_y = y + blood_offset(gen);
+        float land_x = x + std::cos(angle) * velocity * flight_time;
+        float land_y = y + std::sin(angle) * velocity * 0.8f * flight_time; // Less spread vertically
         
-        // Use part type 0 for blood droplets (smallest)
-        CorpsePart* blood_drop = new CorpsePart(start_x, start_y, 0, vel_x, vel_y, force, get_context());
-        get_context()->register_object(blood_drop);
+        decals->stamp(land_x, land_y, droplet_size_dist(gen), DecalLayer::BLOOD_SPLAT);
     }
 }
\ No newline at end of file
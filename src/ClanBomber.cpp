@@ -17,6 +17,7 @@
  */
 
 #include "ClanBomber.h"
+#include "Logger.h"
 #include "Map.h"
 #include "GameObject.h"
 #include "Bomber.h"
@@ -67,7 +68,7 @@ void ClanBomberApplication::initialize_game_context() {
             text_renderer
         );
         
-        SDL_Log("GameContext initialized successfully (map will be set later)");
+        LOG_INFO(CORE, "GameContext initialized successfully (map will be set later)");
         
         // Set GameContext in TileManager
         if (tile_manager) {
@@ -79,11 +80,11 @@ void ClanBomberApplication::initialize_game_context() {
             game_context->set_map(map);
         }
     } else {
-        SDL_Log("ERROR: Cannot initialize GameContext - missing dependencies:");
-        SDL_Log("  text_renderer: %p", text_renderer);
-        SDL_Log("  lifecycle_manager: %p", lifecycle_manager.get());
-        SDL_Log("  tile_manager: %p", tile_manager.get());
-        SDL_Log("  particle_effects: %p", particle_effects.get());
+        LOG_ERROR(CORE, "Cannot initialize GameContext - missing dependencies:");
+        LOG_ERROR(CORE, "  text_renderer: %p", text_renderer);
+        LOG_ERROR(CORE, "  lifecycle_manager: %p", lifecycle_manager.get());
+        LOG_ERROR(CORE, "  tile_manager: %p", tile_manager.get());
+        LOG_ERROR(CORE, "  particle_effects: %p", particle_effects.get());
     }
 }
 
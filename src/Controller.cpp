@@ -17,6 +17,7 @@
  */
 
 #include "Controller.h"
+#include "Logger.h"
 
 #include "Controller_AI_Smart.h"
 #include "Controller_AI_Modern.h"
@@ -69,10 +70,10 @@ Controller* Controller::create( CONTROLLER_TYPE _type )
 {
 	switch( _type ) {
 		case AI:
-			SDL_Log("Creating Modern AI controller (NORMAL difficulty)");
+			LOG_INFO(INPUT, "Creating Modern AI controller (NORMAL difficulty)");
 			return new Controller_AI_Modern(ModernAIPersonality::NORMAL);
 		case AI_mass:
-			SDL_Log("Creating Modern AI controller (HARD difficulty)");
+			LOG_INFO(INPUT, "Creating Modern AI controller (HARD difficulty)");
 			return new Controller_AI_Modern(ModernAIPersonality::HARD);
 		case KEYMAP_1:
 			return new Controller_Keyboard(0);
@@ -99,7 +100,7 @@ Controller* Controller::create( CONTROLLER_TYPE _type )
 		case JOYSTICK_8:
 			return new Controller_Joystick(7);
 		default:
-			SDL_Log("Unknown controller type: %d, using KEYMAP_1 instead", _type);
+			LOG_WARN(INPUT, "Unknown controller type: %d, using KEYMAP_1 instead", _type);
 			return new Controller_Keyboard(0);
 	}
 }
@@ -42,7 +42,8 @@ public:
 		JOYSTICK_5,
 		JOYSTICK_6,
 		JOYSTICK_7,
-		JOYSTICK_8
+		JOYSTICK_8,
+		REPLAY		// Controller_Replay, no se crea con create()
 	} CONTROLLER_TYPE;
 	
 	enum
@@ -15,6 +15,8 @@ static constexpr int TILE_SIZE = CoordinateConfig::TILE_SIZE;
 #include "Extra.h"
 #include "GameContext.h"
 #include "SpatialPartitioning.h"
+#include "Profiler.h"
+#include "AllocTracker.h"
 #include "CoordinateSystem.h"
 #include <algorithm>
 #include <cmath>
@@ -204,6 +206,7 @@ Controller_AI_Modern::Controller_AI_Modern(ModernAIPersonality _personality)
     , next_input_time(0.0f)
     , ai_update_interval(0.05f) // 20 FPS AI thinking
     , last_ai_update(0.0f)
+    , window_x(0), window_y(0), window_width(0), window_height(0)
 {
     c_type = AI;
     set_personality(_personality);
@@ -264,12 +267,9 @@ void Controller_AI_Modern::reset() {
     
     clear_all_jobs();
     
-    // Initialize rating map
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-        for (int x = 0; x < MAP_WIDTH; x++) {
-            rating_map[x][y] = 0;
-        }
-    }
+    // Empty window: everything reads as blocking until the first think
+    window_x = window_y = window_width = window_height = 0;
+    rating_map.clear();
 }
 
 void Controller_AI_Modern::update() {
@@ -279,6 +279,8 @@ void Controller_AI_Modern::update() {
     
     // Performance optimization - don't think every frame
     if (current_time - last_ai_update >= ai_update_interval) {
+        PROFILE_ZONE("AI_Modern::think");
+        ALLOC_SCOPE(ALLOC_TAG_AI);
         generate_rating_map();
         
         if (job_ready()) {
@@ -289,13 +291,21 @@ void Controller_AI_Modern::update() {
     }
 }
 
+void Controller_AI_Modern::update_rating_window() {
+    int bomber_x = bomber->get_map_x();
+    int bomber_y = bomber->get_map_y();
+    window_x = std::max(0, bomber_x - AI_SCAN_RADIUS);
+    window_y = std::max(0, bomber_y - AI_SCAN_RADIUS);
+    window_width = std::min(map->get_width(), bomber_x + AI_SCAN_RADIUS + 1) - window_x;
+    window_height = std::min(map->get_height(), bomber_y + AI_SCAN_RADIUS + 1) - window_y;
+    
+    // assign() keeps the capacity: no allocation once the window reached full size
+    rating_map.assign((size_t)window_width * window_height, 0);
+}
+
 void Controller_AI_Modern::generate_rating_map() {
     // Reset map to neutral
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-        for (int x = 0; x < MAP_WIDTH; x++) {
-            rating_map[x][y] = 0;
-        }
-    }
+    update_rating_window();
     
     // OPTIMIZED: Analyze all objects using SpatialGrid for efficient scanning
     SpatialGrid* spatial_grid = bomber->get_context()->get_spatial_grid();
@@ -304,7 +314,7 @@ void Controller_AI_Modern::generate_rating_map() {
         PixelCoord bomber_position(bomber->get_x(), bomber->get_y());
         
         // Use AI target scanning to get all relevant objects efficiently
-        CollisionHelper::AITargets ai_targets = collision_helper.scan_ai_targets(bomber_position, 25); // Full map scan
+        CollisionHelper::AITargets ai_targets = collision_helper.scan_ai_targets(bomber_position, AI_SCAN_RADIUS);
         
         // Process bombs
         for (GameObject* obj : ai_targets.bombs) {
@@ -320,18 +330,18 @@ void Controller_AI_Modern::generate_rating_map() {
             if (obj) {
                 int x = obj->get_map_x();
                 int y = obj->get_map_y();
-                rating_map[x][y] += RATING_EXTRA;
+                add_rating(x, y, RATING_EXTRA);
             }
         }
         
         // Process explosions - need to get them separately since AITargets doesn't include explosions
         PixelCoord center_position(bomber->get_x(), bomber->get_y());
-        std::vector<GameObject*> explosions = spatial_grid->get_objects_of_type_near(center_position, GameObject::EXPLOSION, 25);
+        std::vector<GameObject*> explosions = spatial_grid->get_objects_of_type_near(center_position, GameObject::EXPLOSION, AI_SCAN_RADIUS);
         for (GameObject* obj : explosions) {
             if (obj) {
                 int x = obj->get_map_x();
                 int y = obj->get_map_y();
-                rating_map[x][y] += RATING_X;
+                add_rating(x, y, RATING_X);
             }
         }
     } else {
@@ -348,11 +358,11 @@ void Controller_AI_Modern::generate_rating_map() {
                     break;
                 }
                 case GameObject::EXPLOSION: {
-                    rating_map[x][y] += RATING_X;
+                    add_rating(x, y, RATING_X);
                     break;
                 }
                 case GameObject::EXTRA: {
-                    rating_map[x][y] += RATING_EXTRA;
+                    add_rating(x, y, RATING_EXTRA);
                     break;
                 }
                 default:
@@ -362,10 +372,11 @@ void Controller_AI_Modern::generate_rating_map() {
     }
     
     // Apply map tile ratings using new architecture
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-        for (int x = 0; x < MAP_WIDTH; x++) {
-            if (bomber->get_context()->get_tile_manager()->is_tile_blocking_at(x, y)) {
-                rating_map[x][y] += RATING_BLOCKING;
+    TileManager* tile_manager = bomber->get_context()->get_tile_manager();
+    for (int y = window_y; y < window_y + window_height; y++) {
+        for (int x = window_x; x < window_x + window_width; x++) {
+            if (tile_manager->is_tile_blocking_at(x, y)) {
+                rating_map[window_index(x, y)] += RATING_BLOCKING;
             }
         }
     }
@@ -382,27 +393,29 @@ void Controller_AI_Modern::apply_bomb_rating(int x, int y, int power, float coun
     }
     
     // Apply rating to bomb position
-    rating_map[x][y] = rating;
+    if (in_window(x, y)) {
+        rating_map[window_index(x, y)] = rating;
+    }
     
-    // Apply explosion rays using new architecture
-    for (int i = 1; i <= power && x + i < MAP_WIDTH; i++) {
+    // Apply explosion rays using new architecture (clipped to the rating window)
+    for (int i = 1; i <= power && in_window(x + i, y); i++) {
         if (bomber->get_context()->get_tile_manager()->is_tile_blocking_at(x + i, y)) break;
-        rating_map[x + i][y] += rating;
+        add_rating(x + i, y, rating);
     }
     
-    for (int i = 1; i <= power && x - i >= 0; i++) {
+    for (int i = 1; i <= power && in_window(x - i, y); i++) {
         if (bomber->get_context()->get_tile_manager()->is_tile_blocking_at(x - i, y)) break;
-        rating_map[x - i][y] += rating;
+        add_rating(x - i, y, rating);
     }
     
-    for (int i = 1; i <= power && y + i < MAP_HEIGHT; i++) {
+    for (int i = 1; i <= power && in_window(x, y + i); i++) {
         if (bomber->get_context()->get_tile_manager()->is_tile_blocking_at(x, y + i)) break;
-        rating_map[x][y + i] += rating;
+        add_rating(x, y + i, rating);
     }
     
-    for (int i = 1; i <= power && y - i >= 0; i++) {
+    for (int i = 1; i <= power && in_window(x, y - i); i++) {
         if (bomber->get_context()->get_tile_manager()->is_tile_blocking_at(x, y - i)) break;
-        rating_map[x][y - i] += rating;
+        add_rating(x, y - i, rating);
     }
 }
 
@@ -531,7 +544,8 @@ bool Controller_AI_Modern::find_bombing_opportunities(int max_distance) {
 }
 
 bool Controller_AI_Modern::find_way(int dest_rating, int avoid_rating, int max_distance) {
-    std::vector<std::vector<int>> visit_map(MAP_WIDTH, std::vector<int>(MAP_HEIGHT, -1));
+    // Same window as the rating map; the buffer is reused between searches
+    visit_map.assign(rating_map.size(), -1);
     std::queue<CL_Vector> new_queue;
     std::queue<CL_Vector> working_queue;
     
@@ -539,7 +553,10 @@ bool Controller_AI_Modern::find_way(int dest_rating, int avoid_rating, int max_d
     CL_Vector start(bomber->get_map_x(), bomber->get_map_y());
     CL_Vector dest(-1, -1, -1);
     
-    visit_map[(int)start.x][(int)start.y] = 0;
+    if (!in_window((int)start.x, (int)start.y)) {
+        return false;
+    }
+    visit_map[window_index((int)start.x, (int)start.y)] = 0;
     new_queue.push(start);
     
     while (distance < max_distance && dest.x < 0 && !new_queue.empty()) {
@@ -568,19 +585,18 @@ bool Controller_AI_Modern::find_way(int dest_rating, int avoid_rating, int max_d
                 CL_Vector next = current;
                 
                 switch (dir) {
-                    case DIR_UP:    if (next.y > 0) next.y--; else continue; break;
-                    case DIR_DOWN:  if (next.y < MAP_HEIGHT-1) next.y++; else continue; break;
-                    case DIR_LEFT:  if (next.x > 0) next.x--; else continue; break;
-                    case DIR_RIGHT: if (next.x < MAP_WIDTH-1) next.x++; else continue; break;
+                    case DIR_UP:    if (next.y > window_y) next.y--; else continue; break;
+                    case DIR_DOWN:  if (next.y < window_y + window_height - 1) next.y++; else continue; break;
+                    case DIR_LEFT:  if (next.x > window_x) next.x--; else continue; break;
+                    case DIR_RIGHT: if (next.x < window_x + window_width - 1) next.x++; else continue; break;
                 }
                 
-                int nx = (int)next.x;
-                int ny = (int)next.y;
-                if (rating_map[nx][ny] > avoid_rating && visit_map[nx][ny] < 0) {
+                size_t next_index = window_index((int)next.x, (int)next.y);
+                if (rating_map[next_index] > avoid_rating && visit_map[next_index] < 0) {
                     new_queue.push(next);
-                    visit_map[nx][ny] = distance;
+                    visit_map[next_index] = distance;
                     
-                    if (rating_map[nx][ny] >= dest_rating) {
+                    if (rating_map[next_index] >= dest_rating) {
                         dest = next;
                     }
                 }
@@ -601,16 +617,16 @@ bool Controller_AI_Modern::find_way(int dest_rating, int avoid_rating, int max_d
         int dx = (int)dest.x;
         int dy = (int)dest.y;
         
-        if (dy > 0 && visit_map[dx][dy - 1] == distance) {
+        if (in_window(dx, dy - 1) && visit_map[window_index(dx, dy - 1)] == distance) {
             reverse_path.push_back(std::make_unique<AIJob_Go>(this, DIR_DOWN));
             dest.y--;
-        } else if (dx < MAP_WIDTH-1 && visit_map[dx + 1][dy] == distance) {
+        } else if (in_window(dx + 1, dy) && visit_map[window_index(dx + 1, dy)] == distance) {
             reverse_path.push_back(std::make_unique<AIJob_Go>(this, DIR_LEFT));
             dest.x++;
-        } else if (dy < MAP_HEIGHT-1 && visit_map[dx][dy + 1] == distance) {
+        } else if (in_window(dx, dy + 1) && visit_map[window_index(dx, dy + 1)] == distance) {
             reverse_path.push_back(std::make_unique<AIJob_Go>(this, DIR_UP));
             dest.y++;
-        } else if (dx > 0 && visit_map[dx - 1][dy] == distance) {
+        } else if (in_window(dx - 1, dy) && visit_map[window_index(dx - 1, dy)] == distance) {
             reverse_path.push_back(std::make_unique<AIJob_Go>(this, DIR_RIGHT));
             dest.x--;
         }
@@ -637,13 +653,13 @@ void Controller_AI_Modern::clear_all_jobs() {
 }
 
 bool Controller_AI_Modern::is_hotspot(int x, int y) const {
-    if (x < 0 || x >= MAP_WIDTH || y < 0 || y >= MAP_HEIGHT) return true;
-    return rating_map[x][y] <= RATING_HOT;
+    if (!in_window(x, y)) return true;
+    return rating_map[window_index(x, y)] <= RATING_HOT;
 }
 
 bool Controller_AI_Modern::is_death(int x, int y) const {
-    if (x < 0 || x >= MAP_WIDTH || y < 0 || y >= MAP_HEIGHT) return true;
-    return rating_map[x][y] <= RATING_X;
+    if (!in_window(x, y)) return true;
+    return rating_map[window_index(x, y)] <= RATING_X;
 }
 
 bool Controller_AI_Modern::can_escape_from_bomb(int x, int y) const {
@@ -652,9 +668,9 @@ bool Controller_AI_Modern::can_escape_from_bomb(int x, int y) const {
     int safe_tiles = 0;
     
     if (x > 0 && !is_hotspot(x - 1, y)) safe_tiles++;
-    if (x < MAP_WIDTH - 1 && !is_hotspot(x + 1, y)) safe_tiles++;
+    if (x < map->get_width() - 1 && !is_hotspot(x + 1, y)) safe_tiles++;
     if (y > 0 && !is_hotspot(x, y - 1)) safe_tiles++;
-    if (y < MAP_HEIGHT - 1 && !is_hotspot(x, y + 1)) safe_tiles++;
+    if (y < map->get_height() - 1 && !is_hotspot(x, y + 1)) safe_tiles++;
     
     return safe_tiles >= 2; // Need multiple escape routes
 }
@@ -712,10 +728,12 @@ std::string Controller_AI_Modern::get_current_state() const {
 
 bool Controller_AI_Modern::is_starting_corner_position(int x, int y) const {
     // Check if we're in typical starting corner positions where bombing is suicide
+    int width = map->get_width();
+    int height = map->get_height();
     return (x <= 1 && y <= 1) ||           // Top-left corner
-           (x >= MAP_WIDTH-2 && y <= 1) ||  // Top-right corner  
-           (x <= 1 && y >= MAP_HEIGHT-2) || // Bottom-left corner
-           (x >= MAP_WIDTH-2 && y >= MAP_HEIGHT-2); // Bottom-right corner
+           (x >= width-2 && y <= 1) ||  // Top-right corner  
+           (x <= 1 && y >= height-2) || // Bottom-left corner
+           (x >= width-2 && y >= height-2); // Bottom-right corner
 }
 
 bool Controller_AI_Modern::can_escape_from_bomb_safely(int x, int y) const {
@@ -739,12 +757,12 @@ bool Controller_AI_Modern::can_escape_from_bomb_safely(int x, int y) const {
             int nx = x + dx * dist;
             int ny = y + dy * dist;
             
-            if (nx < 0 || nx >= MAP_WIDTH || ny < 0 || ny >= MAP_HEIGHT) {
+            if (nx < 0 || nx >= map->get_width() || ny < 0 || ny >= map->get_height()) {
                 route_safe = false;
                 break;
             }
             
-            if (is_hotspot(nx, ny) || rating_map[nx][ny] <= RATING_HOT) {
+            if (is_hotspot(nx, ny) || rating_at(nx, ny) <= RATING_HOT) {
                 route_safe = false;
                 break;
             }
@@ -787,7 +805,7 @@ bool Controller_AI_Modern::bombing_is_beneficial(int x, int y) const {
             int nx = x + dx * dist;
             int ny = y + dy * dist;
             
-            if (nx < 0 || nx >= MAP_WIDTH || ny < 0 || ny >= MAP_HEIGHT) break;
+            if (nx < 0 || nx >= map->get_width() || ny < 0 || ny >= map->get_height()) break;
             
             if (bomber->get_context()->get_tile_manager()->is_tile_blocking_at(nx, ny) && !bomber->get_context()->get_tile_manager()->is_tile_destructible_at(nx, ny)) {
                 break; // Hit wall, stop checking this direction
@@ -814,14 +832,14 @@ bool Controller_AI_Modern::should_move_to_better_position() {
     // If we're in a starting corner, prioritize moving to center
     if (is_starting_corner_position(x, y)) {
         // Find path toward center of map
-        int center_x = MAP_WIDTH / 2;
-        int center_y = MAP_HEIGHT / 2;
+        int center_x = map->get_width() / 2;
+        int center_y = map->get_height() / 2;
         
         // Simple movement toward center
         if (abs(x - center_x) > abs(y - center_y)) {
             // Move horizontally toward center
             int target_x = (x < center_x) ? x + 1 : x - 1;
-            if (target_x >= 0 && target_x < MAP_WIDTH && !is_death(target_x, y)) {
+            if (target_x >= 0 && target_x < map->get_width() && !is_death(target_x, y)) {
                 jobs.push_back(
                     std::make_unique<AIJob_Go>(this, 
                                              (x < center_x) ? DIR_RIGHT : DIR_LEFT, 1));
@@ -830,7 +848,7 @@ bool Controller_AI_Modern::should_move_to_better_position() {
         } else {
             // Move vertically toward center
             int target_y = (y < center_y) ? y + 1 : y - 1;
-            if (target_y >= 0 && target_y < MAP_HEIGHT && !is_death(x, target_y)) {
+            if (target_y >= 0 && target_y < map->get_height() && !is_death(x, target_y)) {
                 jobs.push_back(
                     std::make_unique<AIJob_Go>(this, 
                                              (y < center_y) ? DIR_DOWN : DIR_UP, 1));
@@ -853,7 +871,7 @@ int Controller_AI_Modern::count_active_bombs() const {
         PixelCoord bomber_position(bomber->get_x(), bomber->get_y());
         
         // Get all bombs in the entire game area (large radius)
-        std::vector<GameObject*> all_bombs = spatial_grid->get_bombs_near(bomber_position, 25); // 25 tile radius covers whole map
+        std::vector<GameObject*> all_bombs = spatial_grid->get_bombs_near(bomber_position, AI_SCAN_RADIUS); // Covers the classic map; large maps count nearby bombs
         count = all_bombs.size();
     } else {
         // FALLBACK: Use legacy O(n²) method if spatial grid not available
@@ -928,7 +946,7 @@ int Controller_AI_Modern::evaluate_escape_direction(int bomb_x, int bomb_y, int
         int nx = bomb_x + dx * dist;
         int ny = bomb_y + dy * dist;
         
-        if (nx < 0 || nx >= MAP_WIDTH || ny < 0 || ny >= MAP_HEIGHT) {
+        if (nx < 0 || nx >= map->get_width() || ny < 0 || ny >= map->get_height()) {
             break; // Hit boundary
         }
         
@@ -961,8 +979,8 @@ int Controller_AI_Modern::count_nearby_threats(int x, int y) const {
             int nx = x + dx;
             int ny = y + dy;
             
-            if (nx >= 0 && nx < MAP_WIDTH && ny >= 0 && ny < MAP_HEIGHT) {
-                if (is_hotspot(nx, ny) || rating_map[nx][ny] <= RATING_HOT) {
+            if (nx >= 0 && nx < map->get_width() && ny >= 0 && ny < map->get_height()) {
+                if (is_hotspot(nx, ny) || rating_at(nx, ny) <= RATING_HOT) {
                     threat_count++;
                 }
             }
@@ -20,6 +20,9 @@ class Bomber;
 #define RATING_X         -666    // Absolute death (explosion, hole)
 #define RATING_BLOCKING -1000    // Never run into walls
 
+// The AI only rates and searches this many tiles around its bomber
+#define AI_SCAN_RADIUS     25
+
 // Destruction ratings for tactical bombing
 #define DRATING_ENEMY     150    // Hitting enemies is good
 #define DRATING_BOX        20    // Destroying boxes is good
@@ -101,6 +104,7 @@ class Controller_AI_Modern : public Controller {
     friend class AIJob_Go;
     friend class AIJob_PutBomb;
     friend class AIJob_Wait;
+    friend struct BenchAccess;  // clanbomber-bench (bench/)
     
 public:
     Controller_AI_Modern(ModernAIPersonality personality = ModernAIPersonality::NORMAL);
@@ -130,6 +134,7 @@ public:
 private:
     // Core AI systems
     void generate_rating_map();
+    void update_rating_window();
     bool job_ready();
     void do_job();
     void find_new_jobs();
@@ -181,10 +186,21 @@ private:
     // Job queue
     std::vector<std::unique_ptr<AIJob>> jobs;
     
-    // Map analysis
-    int rating_map[MAP_WIDTH][MAP_HEIGHT];
+    // Map analysis: ventana de AI_SCAN_RADIUS casillas alrededor del bomber,
+    // así el coste por bot no crece con el tamaño del mapa
+    std::vector<int> rating_map;   // [(y - window_y) * window_width + (x - window_x)]
+    std::vector<int> visit_map;    // Scratch de find_way, mismo tamaño; se reutiliza
+    int window_x, window_y, window_width, window_height;
     Map* map;
     
+    bool in_window(int x, int y) const {
+        return x >= window_x && x < window_x + window_width && y >= window_y && y < window_y + window_height;
+    }
+    size_t window_index(int x, int y) const { return (size_t)(y - window_y) * window_width + (x - window_x); }
+    // Fuera de la ventana todo cuenta como pared
+    int rating_at(int x, int y) const { return in_window(x, y) ? rating_map[window_index(x, y)] : RATING_BLOCKING; }
+    void add_rating(int x, int y, int rating) { if (in_window(x, y)) rating_map[window_index(x, y)] += rating; }
+    
     // Performance optimization
     float ai_update_interval;
     float last_ai_update;
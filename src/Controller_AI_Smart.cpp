@@ -14,6 +14,8 @@
 static constexpr int TILE_SIZE = CoordinateConfig::TILE_SIZE;
 #include "GameContext.h"
 #include "SpatialPartitioning.h"
+#include "Profiler.h"
+#include "AllocTracker.h"
 #include "GameConstants.h"
 #include <algorithm>
 #include <cmath>
@@ -165,6 +167,8 @@ void Controller_AI_Smart::update() {
 }
 
 void Controller_AI_Smart::think() {
+    PROFILE_ZONE("AI_Smart::think");
+    ALLOC_SCOPE(ALLOC_TAG_AI);
     if (!bomber || !bomber->get_context()) return;
     
     analyze_enemies();
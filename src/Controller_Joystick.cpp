@@ -1,4 +1,5 @@
 #include "Controller_Joystick.h"
+#include "Logger.h"
 #include <SDL3/SDL_log.h>
 
 // Static member definitions
@@ -27,7 +28,7 @@ Controller_Joystick::Controller_Joystick(int joystick_index)
     // Initialize haptic feedback
     initialize_haptic();
     
-    SDL_Log("Controller_Joystick: Created joystick controller %d", joystick_index);
+    LOG_INFO(INPUT, "Controller_Joystick: Created joystick controller %d", joystick_index);
 }
 
 Controller_Joystick::~Controller_Joystick() {
@@ -98,7 +99,7 @@ void Controller_Joystick::initialize_joystick_system() {
     
     // Initialize SDL gamepad, joystick and haptic subsystems
     if (SDL_InitSubSystem(SDL_INIT_GAMEPAD | SDL_INIT_JOYSTICK | SDL_INIT_HAPTIC) < 0) {
-        SDL_Log("Controller_Joystick: Failed to initialize SDL gamepad/joystick/haptic subsystems: %s", SDL_GetError());
+        LOG_WARN(INPUT, "Controller_Joystick: Failed to initialize SDL gamepad/joystick/haptic subsystems: %s", SDL_GetError());
         return;
     }
     
@@ -107,18 +108,18 @@ void Controller_Joystick::initialize_joystick_system() {
     
     joystick_system_initialized = true;
     
-    SDL_Log("Controller_Joystick: Joystick system initialized");
+    LOG_INFO(INPUT, "Controller_Joystick: Joystick system initialized");
     
     // Get list of joysticks (SDL3 changed API)
     int num_joysticks;
     SDL_JoystickID* joystick_ids = SDL_GetJoysticks(&num_joysticks);
-    SDL_Log("Controller_Joystick: Found %d joysticks", num_joysticks);
+    LOG_INFO(INPUT, "Controller_Joystick: Found %d joysticks", num_joysticks);
     
     // Log connected joysticks
     if (joystick_ids) {
         for (int i = 0; i < num_joysticks && i < 8; i++) {
             const char* name = SDL_GetJoystickNameForID(joystick_ids[i]);
-            SDL_Log("Controller_Joystick: Joystick %d (ID %d): %s", i, joystick_ids[i], name ? name : "Unknown");
+            LOG_INFO(INPUT, "Controller_Joystick: Joystick %d (ID %d): %s", i, joystick_ids[i], name ? name : "Unknown");
         }
         SDL_free(joystick_ids);
     }
@@ -140,7 +141,7 @@ void Controller_Joystick::shutdown_joystick_system() {
     SDL_QuitSubSystem(SDL_INIT_GAMEPAD | SDL_INIT_JOYSTICK | SDL_INIT_HAPTIC);
     joystick_system_initialized = false;
     
-    SDL_Log("Controller_Joystick: Joystick system shutdown");
+    LOG_INFO(INPUT, "Controller_Joystick: Joystick system shutdown");
 }
 
 void Controller_Joystick::update_all_joysticks() {
@@ -175,11 +176,11 @@ bool Controller_Joystick::initialize_joystick() {
     // Get all joystick IDs
     SDL_JoystickID* joystick_ids = SDL_GetJoysticks(&num_joysticks);
     if (!joystick_ids) {
-        SDL_Log("Controller_Joystick: Failed to get joystick IDs: %s", SDL_GetError());
+        LOG_WARN(INPUT, "Controller_Joystick: Failed to get joystick IDs: %s", SDL_GetError());
         return false;
     }
     
-    SDL_Log("Controller_Joystick: Found %d total joysticks", num_joysticks);
+    LOG_INFO(INPUT, "Controller_Joystick: Found %d total joysticks", num_joysticks);
     
     // Find the joystick_index-th gamepad 
     int gamepad_count = 0;
@@ -190,7 +191,7 @@ bool Controller_Joystick::initialize_joystick() {
                 gamepad = SDL_OpenGamepad(joystick_ids[i]);
                 if (gamepad) {
                     const char* name = SDL_GetGamepadName(gamepad);
-                    SDL_Log("Controller_Joystick: Opened Gamepad %d: %s", joystick_index, name ? name : "Unknown");
+                    LOG_INFO(INPUT, "Controller_Joystick: Opened Gamepad %d: %s", joystick_index, name ? name : "Unknown");
                     
                     // Get the underlying joystick (like your example)
                     joystick = SDL_GetGamepadJoystick(gamepad);
@@ -201,19 +202,19 @@ bool Controller_Joystick::initialize_joystick() {
                         int num_buttons = SDL_GetNumJoystickButtons(joystick);
                         int num_axes = SDL_GetNumJoystickAxes(joystick);
                         int num_hats = SDL_GetNumJoystickHats(joystick);
-                        SDL_Log("Controller_Joystick: Underlying joystick - Buttons: %d, Axes: %d, Hats: %d", num_buttons, num_axes, num_hats);
+                        LOG_INFO(INPUT, "Controller_Joystick: Underlying joystick - Buttons: %d, Axes: %d, Hats: %d", num_buttons, num_axes, num_hats);
                         
                         SDL_free(joystick_ids);
                         return true;
                     } else {
-                        SDL_Log("Controller_Joystick: Failed to get underlying joystick from Gamepad");
+                        LOG_WARN(INPUT, "Controller_Joystick: Failed to get underlying joystick from Gamepad");
                         SDL_CloseGamepad(gamepad);
                         gamepad = nullptr;
                         SDL_free(joystick_ids);
                         return false;
                     }
                 } else {
-                    SDL_Log("Controller_Joystick: Failed to open Gamepad for ID %d: %s", joystick_ids[i], SDL_GetError());
+                    LOG_WARN(INPUT, "Controller_Joystick: Failed to open Gamepad for ID %d: %s", joystick_ids[i], SDL_GetError());
                     SDL_free(joystick_ids);
                     return false;
                 }
@@ -222,7 +223,7 @@ bool Controller_Joystick::initialize_joystick() {
         }
     }
     
-    SDL_Log("Controller_Joystick: Gamepad index %d not found (found %d gamepads total)", 
+    LOG_WARN(INPUT, "Controller_Joystick: Gamepad index %d not found (found %d gamepads total)", 
             joystick_index, gamepad_count);
     SDL_free(joystick_ids);
     return false;
@@ -365,24 +366,24 @@ bool Controller_Joystick::get_button_bomb() const {
 
 void Controller_Joystick::initialize_haptic() {
     if (!gamepad) {
-        SDL_Log("Controller_Joystick: No gamepad available for rumble initialization");
+        LOG_INFO(INPUT, "Controller_Joystick: No gamepad available for rumble initialization");
         return;
     }
     
     const char* name = SDL_GetGamepadName(gamepad);
-    SDL_Log("Controller_Joystick: Checking rumble support for '%s'", name ? name : "Unknown");
+    LOG_INFO(INPUT, "Controller_Joystick: Checking rumble support for '%s'", name ? name : "Unknown");
     
     // SDL3 SOLUTION: Use SDL_RumbleGamepad directly instead of haptic system!
     // This is much simpler and works better with gamepads
-    SDL_Log("Controller_Joystick: Testing SDL_RumbleGamepad (SDL3 native approach)...");
+    LOG_INFO(INPUT, "Controller_Joystick: Testing SDL_RumbleGamepad (SDL3 native approach)...");
     
     // Test rumble: mid intensity on both motors for 200ms
     if (SDL_RumbleGamepad(gamepad, 32000, 32000, 200)) {
-        SDL_Log("Controller_Joystick: ✅ SDL_RumbleGamepad test successful!");
+        LOG_INFO(INPUT, "Controller_Joystick: ✅ SDL_RumbleGamepad test successful!");
         // Set flag to indicate gamepad rumble is working
         haptic_device = (SDL_Haptic*)1; // Use as boolean flag (non-null = working)
     } else {
-        SDL_Log("Controller_Joystick: ❌ SDL_RumbleGamepad test failed: %s", SDL_GetError());
+        LOG_WARN(INPUT, "Controller_Joystick: ❌ SDL_RumbleGamepad test failed: %s", SDL_GetError());
         haptic_device = nullptr;
     }
 }
@@ -392,7 +393,7 @@ void Controller_Joystick::cleanup_haptic() {
         // Stop any ongoing rumble
         SDL_RumbleGamepad(gamepad, 0, 0, 0); // Stop rumble
         haptic_device = nullptr;
-        SDL_Log("Controller_Joystick: Gamepad rumble stopped for joystick %d", joystick_index);
+        LOG_INFO(INPUT, "Controller_Joystick: Gamepad rumble stopped for joystick %d", joystick_index);
     }
 }
 
@@ -431,7 +432,7 @@ void Controller_Joystick::apply_vibration(float intensity) {
     
     // Apply rumble using SDL3's dual-motor system
     if (!SDL_RumbleGamepad(gamepad, low_freq, high_freq, 100)) { // 100ms duration per frame
-        SDL_Log("Controller_Joystick: Failed to rumble gamepad: %s", SDL_GetError());
+        LOG_WARN(INPUT, "Controller_Joystick: Failed to rumble gamepad: %s", SDL_GetError());
     }
 }
 
@@ -487,9 +488,9 @@ float Controller_Joystick::calculate_explosion_intensity(float explosion_x, floa
     // Special case: If this bomber died, maximum vibration
     if (bomber_died) {
         intensity = 1.0f;
-        SDL_Log("HAPTIC: Bomber died! Maximum vibration intensity = %.3f", intensity);
+        LOG_DEBUG(INPUT, "HAPTIC: Bomber died! Maximum vibration intensity = %.3f", intensity);
     } else {
-        SDL_Log("HAPTIC: Explosion at (%.1f,%.1f) power=%.1f, bomber at (%.1f,%.1f), distance=%.1f px, intensity=%.3f", 
+        LOG_DEBUG(INPUT, "HAPTIC: Explosion at (%.1f,%.1f) power=%.1f, bomber at (%.1f,%.1f), distance=%.1f px, intensity=%.3f", 
                 explosion_x, explosion_y, explosion_power, bomber_x, bomber_y, distance, intensity);
     }
     
@@ -500,7 +501,7 @@ float Controller_Joystick::calculate_explosion_intensity(float explosion_x, floa
 void Controller_Joystick::trigger_explosion_vibration(float explosion_x, float explosion_y, float explosion_power, 
                                                     float bomber_x, float bomber_y, bool bomber_died) {
     if (!haptic_device || !gamepad) {
-        SDL_Log("HAPTIC: No gamepad rumble available (explosion at %.1f,%.1f power=%.1f)", 
+        LOG_DEBUG(INPUT, "HAPTIC: No gamepad rumble available (explosion at %.1f,%.1f power=%.1f)", 
                 explosion_x, explosion_y, explosion_power);
         return;
     }
@@ -512,7 +513,7 @@ void Controller_Joystick::trigger_explosion_vibration(float explosion_x, float e
     // Skip very weak vibrations to avoid noise - lowered for better reach
     const float MIN_VIBRATION_THRESHOLD = 0.005f;
     if (intensity < MIN_VIBRATION_THRESHOLD && !bomber_died) {
-        SDL_Log("HAPTIC: Explosion too weak (%.3f), skipping vibration", intensity);
+        LOG_DEBUG(INPUT, "HAPTIC: Explosion too weak (%.3f), skipping vibration", intensity);
         return;
     }
     
@@ -527,7 +528,7 @@ void Controller_Joystick::trigger_explosion_vibration(float explosion_x, float e
         // IMMEDIATE DEATH SHOCK: Short intense burst on both motors
         SDL_RumbleGamepad(gamepad, 65535, 65535, 150); // MAX intensity for 150ms
         
-        SDL_Log("HAPTIC: ☠️ DEATH vibration triggered - intensity=%.3f, duration=%.1fs", 
+        LOG_DEBUG(INPUT, "HAPTIC: ☠️ DEATH vibration triggered - intensity=%.3f, duration=%.1fs", 
                 vibration_state.intensity, vibration_state.duration_left);
     } else {
         // EXPLOSION VIBRATION: Direct call to SDL_RumbleGamepad (like your SDL2 example)
@@ -556,14 +557,14 @@ void Controller_Joystick::trigger_explosion_vibration(float explosion_x, float e
             duration = 200;
         }
         
-        SDL_Log("HAPTIC: 💥 Explosion rumble - intensity=%.3f, low=%d, high=%d, duration=%dms", 
+        LOG_DEBUG(INPUT, "HAPTIC: 💥 Explosion rumble - intensity=%.3f, low=%d, high=%d, duration=%dms", 
                 intensity, low_freq, high_freq, duration);
         
         // DIRECT RUMBLE CALL (like SDL2 working example)
         if (!SDL_RumbleGamepad(gamepad, low_freq, high_freq, duration)) {
-            SDL_Log("HAPTIC: Failed to rumble gamepad: %s", SDL_GetError());
+            LOG_WARN(INPUT, "HAPTIC: Failed to rumble gamepad: %s", SDL_GetError());
         } else {
-            SDL_Log("HAPTIC: ✅ Explosion rumble successful!");
+            LOG_DEBUG(INPUT, "HAPTIC: ✅ Explosion rumble successful!");
         }
     }
 }
@@ -586,7 +587,7 @@ void Controller_Joystick::update_haptic(float deltaTime) {
     if (vibration_state.duration_left <= 0.0f || vibration_state.intensity <= 0.0f) {
         vibration_state.active = false;
         vibration_state.intensity = 0.0f;
-        SDL_Log("HAPTIC: Vibration stopped");
+        LOG_DEBUG(INPUT, "HAPTIC: Vibration stopped");
     }
 }
 
@@ -599,5 +600,5 @@ void Controller_Joystick::stop_vibration() {
         SDL_RumbleGamepad(gamepad, 0, 0, 0); // Stop both motors
     }
     
-    SDL_Log("HAPTIC: Dual-motor vibration stopped manually");
+    LOG_DEBUG(INPUT, "HAPTIC: Dual-motor vibration stopped manually");
 }
\ No newline at end of file
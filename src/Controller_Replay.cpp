@@ -0,0 +1,31 @@
+#include "Controller_Replay.h"
+#include "Replay.h"
+
+Controller_Replay::Controller_Replay(std::shared_ptr<Replay> _replay, int _slot)
+    : replay(std::move(_replay)), slot(_slot) {
+    c_type = REPLAY;
+}
+
+bool Controller_Replay::has(int bit) const {
+    return replay && (replay->get_input(slot) & bit) != 0;
+}
+
+bool Controller_Replay::is_left() {
+    return has(Replay::INPUT_LEFT);
+}
+
+bool Controller_Replay::is_right() {
+    return has(Replay::INPUT_RIGHT);
+}
+
+bool Controller_Replay::is_up() {
+    return has(Replay::INPUT_UP);
+}
+
+bool Controller_Replay::is_down() {
+    return has(Replay::INPUT_DOWN);
+}
+
+bool Controller_Replay::is_bomb() {
+    return has(Replay::INPUT_BOMB);
+}
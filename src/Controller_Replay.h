@@ -0,0 +1,35 @@
+#ifndef CONTROLLER_REPLAY_H
+#define CONTROLLER_REPLAY_H
+
+#include "Controller.h"
+#include <memory>
+
+class Replay;
+
+/**
+ * Controller_Replay: devuelve las entradas grabadas de una plaza de un Replay
+ *
+ * No tiene estado propio: lee la fila del tick que Replay::get_playback_tick()
+ * indica, así que un bomber que no actúa algún tick (muerto, volando) no
+ * desincroniza al resto. Ignora active/reverse/bomb_mode: la grabación ya
+ * contiene lo que el controller original devolvía con ellos aplicados.
+ */
+class Controller_Replay : public Controller {
+public:
+    Controller_Replay(std::shared_ptr<Replay> replay, int slot);
+
+    void reset() override {}
+    bool is_left() override;
+    bool is_right() override;
+    bool is_up() override;
+    bool is_down() override;
+    bool is_bomb() override;
+
+private:
+    std::shared_ptr<Replay> replay;
+    int slot;
+
+    bool has(int bit) const;
+};
+
+#endif
@@ -21,8 +21,21 @@ struct CoordinateConfig {
     static constexpr int TILE_SIZE = 40;           // Tamaño de cada tile en pixels
     static constexpr int MAP_OFFSET_X = 0;         // Offset del mapa en X
     static constexpr int MAP_OFFSET_Y = 0;         // Offset del mapa en Y
-    static constexpr int MAX_GRID_WIDTH = 20;      // Máximo ancho del mapa en tiles
-    static constexpr int MAX_GRID_HEIGHT = 15;     // Máximo alto del mapa en tiles
+    static constexpr int MIN_GRID_WIDTH = 20;      // Tamaño clásico: los mapas más pequeños se rellenan hasta él
+    static constexpr int MIN_GRID_HEIGHT = 15;
+    static constexpr int MAX_GRID_WIDTH = 256;     // Máximo ancho del mapa en tiles
+    static constexpr int MAX_GRID_HEIGHT = 256;    // Máximo alto del mapa en tiles
+
+    // Tamaño del mapa cargado; lo fija Map al cargar cada mapa
+    static inline int grid_width = MIN_GRID_WIDTH;
+    static inline int grid_height = MIN_GRID_HEIGHT;
+
+    static void set_grid_size(int width, int height) {
+        grid_width = width;
+        grid_height = height;
+    }
+    static int get_world_width() { return grid_width * TILE_SIZE; }
+    static int get_world_height() { return grid_height * TILE_SIZE; }
 };
 
 /**
@@ -51,8 +64,8 @@ struct GridCoord {
      * @brief Verifica si la coordenada está dentro de los límites del mapa
      */
     bool is_valid() const {
-        return grid_x >= 0 && grid_x < CoordinateConfig::MAX_GRID_WIDTH &&
-               grid_y >= 0 && grid_y < CoordinateConfig::MAX_GRID_HEIGHT;
+        return grid_x >= 0 && grid_x < CoordinateConfig::grid_width &&
+               grid_y >= 0 && grid_y < CoordinateConfig::grid_height;
     }
 };
 
@@ -161,8 +174,8 @@ public:
      * @brief Fuerza una coordenada grid a estar dentro de límites válidos
      */
     static GridCoord clamp_grid(const GridCoord& grid) {
-        int clamped_x = std::max(0, std::min(grid.grid_x, CoordinateConfig::MAX_GRID_WIDTH - 1));
-        int clamped_y = std::max(0, std::min(grid.grid_y, CoordinateConfig::MAX_GRID_HEIGHT - 1));
+        int clamped_x = std::max(0, std::min(grid.grid_x, CoordinateConfig::grid_width - 1));
+        int clamped_y = std::max(0, std::min(grid.grid_y, CoordinateConfig::grid_height - 1));
         return GridCoord(clamped_x, clamped_y);
     }
     
@@ -0,0 +1,298 @@
+#include "CorpsePhysicsSystem.h"
+#include "GPUAcceleratedRenderer.h"
+#include "TileManager.h"
+#include "DecalLayer.h"
+#include "CoordinateSystem.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+    // Constantes físicas (mismas que el antiguo CorpsePart)
+    constexpr float GRAVITY = 980.0f;          // 980 pixels/s² ≈ 9.8 m/s²
+    constexpr float AIR_DENSITY = 1.225f;      // kg/m³
+    constexpr float DRAG_COEFFICIENT = 0.47f;  // Sphere approximation
+    constexpr float DRAG_PIXEL_SCALE = 0.01f;  // Real world → pixel world
+    constexpr float ANGULAR_DRAG = 0.1f;
+    constexpr float MAX_SPAWN_SPIN = 1440.0f;  // deg/s, evita valores que rompen la integración
+    constexpr float FLOOR_FRICTION = 0.7f;
+    constexpr float BLOOD_EMISSION_RATE = 20.0f;
+    constexpr float BLOOD_POOL_SIZE = 18.0f;
+    constexpr int REFRESH_MARGIN_TILES = 2;    // Una parte no cruza más de una casilla por frame
+
+    float get_part_mass(int part_type) {
+        switch (part_type % 4) {
+            case 0: return 2.5f; // Head - denser
+            case 1: return 4.0f; // Torso - heaviest
+            case 2: return 1.8f; // Arm - lighter
+            case 3: return 2.2f; // Leg - medium
+            default: return 2.0f;
+        }
+    }
+
+    float get_part_surface_area(int part_type) {
+        switch (part_type % 4) {
+            case 0: return 1.2f; // Head - compact
+            case 1: return 2.0f; // Torso - largest area
+            case 2: return 0.8f; // Arm - thin
+            case 3: return 1.0f; // Leg - medium
+            default: return 1.0f;
+        }
+    }
+}
+
+CorpsePhysicsSystem::CorpsePhysicsSystem()
+    : map_width(CoordinateConfig::grid_width), map_height(CoordinateConfig::grid_height),
+      decals(nullptr), random_gen(std::random_device{}()) {
+    blocking.assign(map_width * map_height, 0);
+}
+
+CorpsePhysicsSystem::~CorpsePhysicsSystem() {
+}
+
+bool CorpsePhysicsSystem::spawn_part(float x, float y, int part_type, float vx, float vy, float explosion_force) {
+    if (pos_x.size() >= MAX_PARTS) {
+        return false;
+    }
+
+    float mass = get_part_mass(part_type);
+    float area = get_part_surface_area(part_type);
+    float moment_of_inertia = mass * area * 0.4f; // Approximation for irregular shapes
+
+    std::uniform_real_distribution<float> rot_dist(0.0f, 360.0f);
+    std::uniform_real_distribution<float> angular_dist(-720.0f, 720.0f);
+    float spin = angular_dist(random_gen) * (explosion_force / mass); // More force = more spin
+
+    pos_x.push_back(x);
+    pos_y.push_back(y);
+    vel_x.push_back(vx);
+    vel_y.push_back(vy);
+    inv_mass.push_back(1.0f / mass);
+    drag_k.push_back(0.5f * AIR_DENSITY * DRAG_COEFFICIENT * area * DRAG_PIXEL_SCALE / mass);
+    restitution.push_back(0.3f + (part_type * 0.1f));
+    viscosity.push_back(0.8f + (part_type * 0.05f));
+    rotation.push_back(rot_dist(random_gen));
+    angular_velocity.push_back(std::clamp(spin, -MAX_SPAWN_SPIN, MAX_SPAWN_SPIN));
+    angular_k.push_back(ANGULAR_DRAG / moment_of_inertia);
+    lifetime.push_back(0.0f);
+    max_lifetime.push_back(8.0f + (part_type * 0.5f));
+    rest_timer.push_back(0.0f);
+    blood_timer.push_back(0.0f);
+    resting.push_back(0);
+    sprite.push_back(static_cast<uint8_t>(part_type % 4));
+    return true;
+}
+
+void CorpsePhysicsSystem::update(float deltaTime, TileManager* tile_manager) {
+    if (!pos_x.empty()) {
+        refresh_blocking_map(tile_manager);
+        integrate_parts(deltaTime);
+
+        for (size_t i = 0; i < pos_x.size(); i++) {
+            if (!resting[i]) {
+                resolve_collisions(i, prev_x[i], prev_y[i]);
+            }
+        }
+
+        update_rest_and_blood(deltaTime);
+        remove_expired_parts();
+    }
+}
+
+void CorpsePhysicsSystem::refresh_blocking_map(TileManager* tile_manager) {
+    if (map_width != CoordinateConfig::grid_width || map_height != CoordinateConfig::grid_height) {
+        map_width = CoordinateConfig::grid_width;
+        map_height = CoordinateConfig::grid_height;
+        blocking.assign((size_t)map_width * map_height, 0);
+    }
+
+    // Un solo barrido por frame, limitado a las casillas que las partes pueden tocar
+    auto [min_x, max_x] = std::minmax_element(pos_x.begin(), pos_x.end());
+    auto [min_y, max_y] = std::minmax_element(pos_y.begin(), pos_y.end());
+    int x0 = std::max(0, static_cast<int>(std::floor(*min_x / CoordinateConfig::TILE_SIZE)) - REFRESH_MARGIN_TILES);
+    int y0 = std::max(0, static_cast<int>(std::floor(*min_y / CoordinateConfig::TILE_SIZE)) - REFRESH_MARGIN_TILES);
+    int x1 = std::min(map_width - 1, static_cast<int>(std::floor(*max_x / CoordinateConfig::TILE_SIZE)) + REFRESH_MARGIN_TILES);
+    int y1 = std::min(map_height - 1, static_cast<int>(std::floor(*max_y / CoordinateConfig::TILE_SIZE)) + REFRESH_MARGIN_TILES);
+    for (int ty = y0; ty <= y1; ty++) {
+        for (int tx = x0; tx <= x1; tx++) {
+            blocking[ty * map_width + tx] = (tile_manager && tile_manager->is_tile_blocking_at(tx, ty)) ? 1 : 0;
+        }
+    }
+}
+
+bool CorpsePhysicsSystem::is_blocking_at(float px, float py) const {
+    int tx = static_cast<int>(std::floor(px / CoordinateConfig::TILE_SIZE));
+    int ty = static_cast<int>(std::floor(py / CoordinateConfig::TILE_SIZE));
+
+    // Fuera del mapa cuenta como pared: las partes no salen de la pantalla
+    if (tx < 0 || ty < 0 || tx >= map_width || ty >= map_height) {
+        return true;
+    }
+    return blocking[ty * map_width + tx] != 0;
+}
+
+void CorpsePhysicsSystem::integrate_parts(float deltaTime) {
+    const size_t count = pos_x.size();
+    prev_x.assign(pos_x.begin(), pos_x.end());
+    prev_y.assign(pos_y.begin(), pos_y.end());
+
+    const float half_dt2 = 0.5f * deltaTime * deltaTime;
+
+    // Pass sin ramas sobre arrays contiguos; las partes en reposo se enmascaran
+    for (size_t i = 0; i < count; i++) {
+        const float active = resting[i] ? 0.0f : 1.0f;
+
+        const float vx = vel_x[i];
+        const float vy = vel_y[i];
+        const float speed = std::sqrt(vx * vx + vy * vy);
+
+        // Drag F = 0.5 * rho * v² * Cd * A, opuesto a la velocidad
+        const float ax = -vx * speed * drag_k[i];
+        const float ay = GRAVITY - vy * speed * drag_k[i];
+
+        // Verlet-style position update
+        pos_x[i] += active * (vx * deltaTime + ax * half_dt2);
+        pos_y[i] += active * (vy * deltaTime + ay * half_dt2);
+
+        // Velocity + viscosity (resistance to motion in "blood")
+        const float damping = 1.0f - viscosity[i] * deltaTime;
+        vel_x[i] = (vx + active * ax * deltaTime) * (active * damping + (1.0f - active));
+        vel_y[i] = (vy + active * ay * deltaTime) * (active * damping + (1.0f - active));
+
+        // Angular drag proporcional a w², integrado de forma implícita (estable con spins altos)
+        float w = angular_velocity[i];
+        w /= (1.0f + active * angular_k[i] * std::fabs(w) * deltaTime);
+        angular_velocity[i] = w;
+
+        // fmod en lugar de bucles de normalización
+        float rot = std::fmod(rotation[i] + active * w * deltaTime, 360.0f);
+        rot += (rot < 0.0f) ? 360.0f : 0.0f;
+        rotation[i] = rot;
+    }
+
+    // Saneado fuera del hot loop: NaN/inf resetean la rotación
+    for (size_t i = 0; i < count; i++) {
+        if (!std::isfinite(rotation[i]) || !std::isfinite(angular_velocity[i])) {
+            rotation[i] = 0.0f;
+            angular_velocity[i] = 0.0f;
+        }
+    }
+}
+
+void CorpsePhysicsSystem::resolve_collisions(size_t i, float old_x, float old_y) {
+    // Resolución por ejes contra el bitmap: primero X, luego Y
+    if (is_blocking_at(pos_x[i], old_y)) {
+        pos_x[i] = old_x;
+        vel_x[i] = -vel_x[i] * restitution[i];
+        angular_velocity[i] += vel_y[i] * 0.1f;
+    }
+
+    if (is_blocking_at(pos_x[i], pos_y[i])) {
+        pos_y[i] = old_y;
+
+        float tangent_velocity = vel_x[i];
+        vel_y[i] = -vel_y[i] * restitution[i];
+        vel_x[i] = tangent_velocity * (1.0f - FLOOR_FRICTION);
+
+        // Transfer some linear motion to angular motion
+        angular_velocity[i] += tangent_velocity * inv_mass[i] * 50.0f;
+    }
+}
+
+void CorpsePhysicsSystem::update_rest_and_blood(float deltaTime) {
+    const size_t count = pos_x.size();
+
+    for (size_t i = 0; i < count; i++) {
+        lifetime[i] += deltaTime;
+        if (resting[i]) continue;
+
+        float speed = std::sqrt(vel_x[i] * vel_x[i] + vel_y[i] * vel_y[i]);
+
+        // Check if part has come to rest
+        if (speed < 5.0f && std::fabs(angular_velocity[i]) < 10.0f) {
+            rest_timer[i] += deltaTime;
+            if (rest_timer[i] > 1.0f) {
+                resting[i] = 1;
+                vel_x[i] = vel_y[i] = 0.0f;
+                angular_velocity[i] = 0.0f;
+                
+                // Charco bajo la parte: un único estampado
+                if (decals) {
+                    decals->stamp(pos_x[i], pos_y[i], BLOOD_POOL_SIZE, DecalLayer::BLOOD_POOL);
+                }
+            }
+        } else {
+            rest_timer[i] = 0.0f;
+        }
+
+        // Emit blood while moving fast
+        if (speed > 50.0f && lifetime[i] < 2.0f) {
+            blood_timer[i] += deltaTime;
+            if (blood_timer[i] > (1.0f / BLOOD_EMISSION_RATE)) {
+                emit_blood(pos_x[i], pos_y[i]);
+                blood_timer[i] = 0.0f;
+            }
+        }
+    }
+}
+
+void CorpsePhysicsSystem::emit_blood(float x, float y) {
+    if (!decals) {
+        return;
+    }
+
+    std::uniform_real_distribution<float> offset_dist(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> size_dist(2.0f, 6.0f);
+
+    decals->stamp(x + offset_dist(random_gen), y + offset_dist(random_gen), size_dist(random_gen), DecalLayer::BLOOD_SPLAT);
+}
+
+void CorpsePhysicsSystem::remove_expired_parts() {
+    for (size_t i = 0; i < pos_x.size();) {
+        if (lifetime[i] > max_lifetime[i]) {
+            remove_part(i);
+            continue;
+        }
+        ++i;
+    }
+}
+
+void CorpsePhysicsSystem::remove_part(size_t i) {
+    auto swap_pop = [i](auto& v) {
+        v[i] = v.back();
+        v.pop_back();
+    };
+
+    swap_pop(pos_x); swap_pop(pos_y);
+    swap_pop(vel_x); swap_pop(vel_y);
+    swap_pop(inv_mass); swap_pop(drag_k);
+    swap_pop(restitution); swap_pop(viscosity);
+    swap_pop(rotation); swap_pop(angular_velocity); swap_pop(angular_k);
+    swap_pop(lifetime); swap_pop(max_lifetime);
+    swap_pop(rest_timer); swap_pop(blood_timer);
+    swap_pop(resting); swap_pop(sprite);
+}
+
+void CorpsePhysicsSystem::render(GPUAcceleratedRenderer* renderer, unsigned int parts_texture) const {
+    if (parts_texture == 0) {
+        return;
+    }
+
+    const float tile_size = static_cast<float>(CoordinateConfig::TILE_SIZE);
+    const float half_tile = tile_size * 0.5f;
+    for (size_t i = 0; i < pos_x.size(); i++) {
+        // Posición física = centro; add_sprite espera esquina superior izquierda
+        renderer->add_sprite(pos_x[i] - half_tile, pos_y[i] - half_tile, tile_size, tile_size,
+                             parts_texture, nullptr, rotation[i], nullptr, sprite[i]);
+    }
+}
+
+void CorpsePhysicsSystem::clear() {
+    pos_x.clear(); pos_y.clear();
+    vel_x.clear(); vel_y.clear();
+    inv_mass.clear(); drag_k.clear();
+    restitution.clear(); viscosity.clear();
+    rotation.clear(); angular_velocity.clear(); angular_k.clear();
+    lifetime.clear(); max_lifetime.clear();
+    rest_timer.clear(); blood_timer.clear();
+    resting.clear(); sprite.clear();
+}
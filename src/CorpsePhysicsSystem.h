@@ -0,0 +1,85 @@
+#ifndef CORPSEPHYSICSSYSTEM_H
+#define CORPSEPHYSICSSYSTEM_H
+
+#include <SDL3/SDL.h>
+#include <vector>
+#include <random>
+#include <cstdint>
+
+class GPUAcceleratedRenderer;
+class TileManager;
+class DecalLayer;
+
+/**
+ * @brief Sistema de física para gore/debris (data-oriented)
+ *
+ * Reemplaza a CorpsePart como GameObject: todas las partes viven en arrays
+ * SoA y se integran en un único pass sin llamadas virtuales. La colisión se
+ * resuelve contra un bitmap plano de tiles bloqueantes (row-major) que se
+ * refresca una vez por frame, en vez de consultar el grid por cada parte.
+ *
+ * Es puramente cosmético: no pasa por LifecycleManager ni SpatialGrid.
+ * La sangre no se simula ni se redibuja cada frame: se estampa una vez en
+ * el DecalLayer del suelo.
+ */
+class CorpsePhysicsSystem {
+public:
+    CorpsePhysicsSystem();
+    ~CorpsePhysicsSystem();
+
+    /**
+     * @brief Añade una parte de cuerpo (o gota grande) al sistema
+     * @param part_type 0=cabeza, 1=torso, 2=brazo, 3=pierna (módulo 4)
+     * @return false si se alcanzó MAX_PARTS
+     */
+    bool spawn_part(float x, float y, int part_type, float vel_x, float vel_y, float explosion_force);
+
+    void update(float deltaTime, TileManager* tile_manager);
+    void render(GPUAcceleratedRenderer* renderer, unsigned int parts_texture) const;
+    void clear();
+
+    void set_decal_layer(DecalLayer* layer) { decals = layer; }
+
+    size_t get_part_count() const { return pos_x.size(); }
+
+    static constexpr size_t MAX_PARTS = 1024;
+
+private:
+    // === PARTS (SoA) ===
+    std::vector<float> pos_x, pos_y;
+    std::vector<float> vel_x, vel_y;
+    std::vector<float> inv_mass;          // 1/mass, para la respuesta angular en colisiones
+    std::vector<float> drag_k;            // 0.5 * rho * Cd * A * escala / mass (precalculado)
+    std::vector<float> restitution;
+    std::vector<float> viscosity;
+    std::vector<float> rotation;          // Grados, normalizado a [0, 360)
+    std::vector<float> angular_velocity;
+    std::vector<float> angular_k;         // angular_drag / moment_of_inertia
+    std::vector<float> lifetime, max_lifetime;
+    std::vector<float> rest_timer;
+    std::vector<float> blood_timer;
+    std::vector<uint8_t> resting;
+    std::vector<uint8_t> sprite;
+    std::vector<float> prev_x, prev_y;    // Scratch: posición antes de integrar (colisiones)
+
+    // === FLAT TILE BITMAP ===
+    // Solo se refresca la caja que ocupan las partes (más un margen): en
+    // mapas grandes el resto del bitmap no se toca cada frame
+    std::vector<uint8_t> blocking;        // map_width * map_height, 1 = bloquea
+    int map_width, map_height;
+
+    DecalLayer* decals;
+    std::mt19937 random_gen;
+
+    void refresh_blocking_map(TileManager* tile_manager);
+    bool is_blocking_at(float px, float py) const;
+
+    void integrate_parts(float deltaTime);
+    void resolve_collisions(size_t i, float old_x, float old_y);
+    void update_rest_and_blood(float deltaTime);
+    void remove_expired_parts();
+    void remove_part(size_t i);
+    void emit_blood(float x, float y);
+};
+
+#endif
@@ -0,0 +1,234 @@
+#include "DecalLayer.h"
+#include "Logger.h"
+#include "GPUAcceleratedRenderer.h"
+#include <SDL3/SDL.h>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+    constexpr int SPLAT_TEXTURE_SIZE = 32;
+
+    // Colores por tipo de decal (RGBA, alpha controla cuánto se acumula por estampado)
+    const float BLOOD_SPLAT_COLOR[4] = {0.45f, 0.0f, 0.0f, 0.8f};
+    const float BLOOD_POOL_COLOR[4]  = {0.35f, 0.0f, 0.0f, 0.7f};
+    const float SCORCH_COLOR[4]      = {0.05f, 0.04f, 0.03f, 0.35f};
+}
+
+DecalLayer::DecalLayer()
+    : clear_requested(false), stamped_count(0), framebuffer(0), color_texture(0), splat_texture(0),
+      target_width(0), target_height(0), world_width(0), world_height(0), needs_clear(true), target_failed(false) {
+    pending.reserve(256);
+    stamping.reserve(256);
+}
+
+DecalLayer::~DecalLayer() {
+    release_gl_resources();
+}
+
+void DecalLayer::release_gl_resources() {
+    release_target();
+    if (splat_texture != 0) {
+        glDeleteTextures(1, &splat_texture);
+        splat_texture = 0;
+    }
+}
+
+void DecalLayer::stamp(float x, float y, float size, DecalKind kind) {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    if (pending.size() >= MAX_PENDING_STAMPS) {
+        return; // Cosmetic only - drop instead of growing without bound
+    }
+    pending.push_back({x, y, size, kind});
+}
+
+void DecalLayer::clear() {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    pending.clear();
+    clear_requested = true;   // The GL side resets the target on its next render()
+}
+
+size_t DecalLayer::get_pending_count() const {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    return pending.size();
+}
+
+bool DecalLayer::ensure_target(int width, int height) {
+    if (framebuffer != 0 && width == target_width && height == target_height) {
+        return true;
+    }
+    if (target_failed || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    release_target();
+
+    glGenTextures(1, &color_texture);
+    glBindTexture(GL_TEXTURE_2D, color_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    GLint previous_fbo = 0;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous_fbo);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color_texture, 0);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_fbo));
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        LOG_WARN(RENDER, "DecalLayer: Framebuffer incomplete (0x%x), decals disabled", status);
+        release_target();
+        target_failed = true;
+        return false;
+    }
+
+    target_width = width;
+    target_height = height;
+    needs_clear = true;
+    LOG_INFO(RENDER, "DecalLayer: Created %dx%d persistent decal target", width, height);
+    return true;
+}
+
+void DecalLayer::release_target() {
+    if (framebuffer != 0) {
+        glDeleteFramebuffers(1, &framebuffer);
+        framebuffer = 0;
+    }
+    if (color_texture != 0) {
+        glDeleteTextures(1, &color_texture);
+        color_texture = 0;
+    }
+    target_width = target_height = 0;
+}
+
+GLuint DecalLayer::create_splat_texture() {
+    // Disco blanco con borde suave; el color viene del tinte del vértice
+    std::vector<unsigned char> pixels(SPLAT_TEXTURE_SIZE * SPLAT_TEXTURE_SIZE * 4);
+    const float center = (SPLAT_TEXTURE_SIZE - 1) * 0.5f;
+
+    for (int py = 0; py < SPLAT_TEXTURE_SIZE; py++) {
+        for (int px = 0; px < SPLAT_TEXTURE_SIZE; px++) {
+            float dx = (px - center) / center;
+            float dy = (py - center) / center;
+            float dist = std::sqrt(dx * dx + dy * dy);
+            float alpha = std::clamp((1.0f - dist) * 2.5f, 0.0f, 1.0f);
+
+            unsigned char* p = &pixels[(py * SPLAT_TEXTURE_SIZE + px) * 4];
+            p[0] = p[1] = p[2] = 255;
+            p[3] = static_cast<unsigned char>(alpha * 255.0f);
+        }
+    }
+
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, SPLAT_TEXTURE_SIZE, SPLAT_TEXTURE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    return texture;
+}
+
+void DecalLayer::flush_stamps(GPUAcceleratedRenderer* renderer) {
+    if (splat_texture == 0) {
+        splat_texture = create_splat_texture();
+    }
+
+    // Cualquier sprite pendiente va al framebuffer actual antes de redirigir
+    renderer->end_batch();
+
+    GLint previous_fbo = 0;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    // World coordinates over the whole target, whatever the camera is looking at
+    renderer->begin_offscreen(target_width, target_height, (float)world_width, (float)world_height);
+
+    if (needs_clear) {
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        needs_clear = false;
+    }
+
+    // Alpha se acumula sin multiplicarse por sí mismo: el target queda premultiplicado
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+    renderer->begin_batch(GPUAcceleratedRenderer::NORMAL);
+    for (const DecalStamp& s : stamping) {
+        const float* color = SCORCH_COLOR;
+        if (s.kind == BLOOD_SPLAT) color = BLOOD_SPLAT_COLOR;
+        else if (s.kind == BLOOD_POOL) color = BLOOD_POOL_COLOR;
+
+        // La proyección es top-left; el texture space es bottom-left.
+        // Se estampa espejado en Y para que el quad compuesto quede derecho.
+        float half = s.size * 0.5f;
+        float fbo_y = world_height - (s.y + half);
+        renderer->add_sprite(s.x - half, fbo_y, s.size, s.size, splat_texture, color);
+    }
+    renderer->end_batch();
+    renderer->end_offscreen();
+
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_fbo));
+
+    stamped_count += stamping.size();
+    stamping.clear();
+}
+
+void DecalLayer::render(GPUAcceleratedRenderer* renderer, int _world_width, int _world_height) {
+    if (!renderer || !renderer->is_ready()) {
+        return;
+    }
+
+    {
+        // Take the queued stamps; the simulation keeps stamping into the emptied vector
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        stamping.swap(pending);
+        pending.clear();
+        if (clear_requested) {
+            clear_requested = false;
+            stamped_count = 0;
+            needs_clear = true;
+        }
+    }
+
+    // One texel per pixel up to MAX_TARGET_SIZE (or the GL limit), then scaled down
+    static GLint max_texture_size = 0;
+    if (max_texture_size == 0) {
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+    }
+    int max_size = std::min(MAX_TARGET_SIZE, max_texture_size > 0 ? (int)max_texture_size : MAX_TARGET_SIZE);
+    float scale = std::min(1.0f, (float)max_size / (float)std::max(std::max(_world_width, _world_height), 1));
+    if (_world_width != world_width || _world_height != world_height) {
+        // New map size: the old decals belong to another map anyway
+        world_width = _world_width;
+        world_height = _world_height;
+        stamped_count = 0;
+        needs_clear = true;
+    }
+    if (!ensure_target(std::max(1, (int)(_world_width * scale)), std::max(1, (int)(_world_height * scale)))) {
+        stamping.clear();
+        return;
+    }
+
+    if (!stamping.empty() || needs_clear) {
+        flush_stamps(renderer);
+    }
+
+    if (stamped_count == 0) {
+        return; // Nothing accumulated yet - skip the composite quad
+    }
+
+    // Un único quad con toda la capa (contenido premultiplicado)
+    renderer->end_batch();
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    renderer->begin_batch(GPUAcceleratedRenderer::NORMAL);
+    renderer->add_sprite(0.0f, 0.0f, static_cast<float>(world_width), static_cast<float>(world_height), color_texture);
+    renderer->end_batch();
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
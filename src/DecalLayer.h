@@ -0,0 +1,85 @@
+#ifndef DECALLAYER_H
+#define DECALLAYER_H
+
+#include <glad/gl.h>
+#include <vector>
+#include <cstddef>
+#include <mutex>
+
+class GPUAcceleratedRenderer;
+
+/**
+ * @brief Capa persistente de decals del suelo (sangre, quemaduras)
+ *
+ * Cada decal se estampa UNA vez en un render target (FBO) que cubre todo el
+ * mundo y después la capa completa se compone como un único quad encima
+ * del mapa. El coste por frame es constante: no depende de cuánto gore se
+ * haya acumulado en el mapa. En mapas grandes el target se reduce hasta
+ * MAX_TARGET_SIZE texels por lado (los decals se ven más suaves).
+ *
+ * stamp() solo encola; el dibujado ocurre en render() con el contexto GL activo.
+ * stamp()/clear() pueden llamarse desde el hilo de simulación mientras render()
+ * corre en el hilo de render: la cola pendiente va protegida por un mutex.
+ */
+class DecalLayer {
+public:
+    enum DecalKind {
+        BLOOD_SPLAT,  // Gota pequeña de rastro
+        BLOOD_POOL,   // Charco bajo una parte en reposo
+        SCORCH        // Quemadura de explosión
+    };
+
+    DecalLayer();
+    ~DecalLayer();
+
+    void stamp(float x, float y, float size, DecalKind kind);
+
+    /**
+     * @brief Estampa los decals pendientes en el FBO y compone la capa
+     * Llamar después de dibujar el mapa y antes de los objetos, con la cámara
+     * del mundo ya puesta. world_width/height: tamaño del mapa en pixels.
+     */
+    void render(GPUAcceleratedRenderer* renderer, int world_width, int world_height);
+
+    void clear();
+
+    /**
+     * @brief Libera FBO y texturas; llamar con el contexto GL activo
+     * El destructor puede correr cuando el contexto ya no existe.
+     */
+    void release_gl_resources();
+
+    size_t get_pending_count() const;
+    size_t get_stamped_count() const { return stamped_count; }
+
+    static constexpr size_t MAX_PENDING_STAMPS = 4096;
+    static constexpr int MAX_TARGET_SIZE = 4096;
+
+private:
+    struct DecalStamp {
+        float x, y;
+        float size;
+        DecalKind kind;
+    };
+
+    mutable std::mutex pending_mutex;
+    std::vector<DecalStamp> pending;     // Protegido por pending_mutex
+    bool clear_requested;                // Protegido por pending_mutex
+    std::vector<DecalStamp> stamping;    // Solo hilo GL
+    size_t stamped_count;
+
+    GLuint framebuffer;
+    GLuint color_texture;
+    GLuint splat_texture;
+    int target_width, target_height;
+    int world_width, world_height;       // Lo que cubre el target, en pixels del mundo
+    bool needs_clear;
+    bool target_failed;
+
+    bool ensure_target(int width, int height);
+    void release_target();
+    GLuint create_splat_texture();
+    void flush_stamps(GPUAcceleratedRenderer* renderer);
+};
+
+#endif
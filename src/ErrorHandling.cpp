@@ -1,4 +1,5 @@
 #include "ErrorHandling.h"
+#include "Logger.h"
 #include <SDL3/SDL.h>
 #include <algorithm>
 #include <iostream>
@@ -77,12 +78,13 @@ void ErrorHandler::clear_error_statistics() {
 
 void ErrorHandler::log_error(const GameException& error) {
     const char* severity_str;
+    LogLevel level;
     switch (error.get_severity()) {
-        case ErrorSeverity::INFO:     severity_str = "INFO"; break;
-        case ErrorSeverity::WARNING:  severity_str = "WARNING"; break;
-        case ErrorSeverity::ERROR:    severity_str = "ERROR"; break;
-        case ErrorSeverity::CRITICAL: severity_str = "CRITICAL"; break;
-        default: severity_str = "UNKNOWN"; break;
+        case ErrorSeverity::INFO:     severity_str = "INFO"; level = LogLevel::INFO; break;
+        case ErrorSeverity::WARNING:  severity_str = "WARNING"; level = LogLevel::WARNING; break;
+        case ErrorSeverity::ERROR:    severity_str = "ERROR"; level = LogLevel::ERROR; break;
+        case ErrorSeverity::CRITICAL: severity_str = "CRITICAL"; level = LogLevel::ERROR; break;
+        default: severity_str = "UNKNOWN"; level = LogLevel::ERROR; break;
     }
     
     const char* type_str;
@@ -109,9 +111,9 @@ void ErrorHandler::log_error(const GameException& error) {
     }
     
     if (error.get_context().empty()) {
-        SDL_Log("GameError [%s] %s: %s", severity_str, type_str, error.what());
+        CLANBOMBER_LOG(level, LogCategory::CORE, "GameError [%s] %s: %s", severity_str, type_str, error.what());
     } else {
-        SDL_Log("GameError [%s] %s: %s (Context: %s)", 
+        CLANBOMBER_LOG(level, LogCategory::CORE, "GameError [%s] %s: %s (Context: %s)", 
                 severity_str, type_str, error.what(), error.get_context().c_str());
     }
 }
@@ -26,13 +26,11 @@ public:
     ObjectType get_type() const override { return EXPLOSION; }
 
 private:
-    void draw_explosion_tile(float tile_x, float tile_y);
-    static GLuint get_dummy_white_texture();
-    void show_single_quad(); // Alternativa
     void detonate_other_bombs();
     void kill_bombers();
     void explode_corpses();
     void notify_explosion_haptics();
+    void stamp_scorch_marks();
     
     // NEW ARCHITECTURE SUPPORT: Handle both MapTile and TileEntity destruction
     void destroy_tile_at(int map_x, int map_y);
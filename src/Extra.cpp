@@ -1,10 +1,11 @@
 #include "Extra.h"
+#include "Logger.h"
 #include "Timer.h"
 #include "Resources.h"
 #include "AudioMixer.h"
 #include "MapTile.h"
 #include "Bomber.h"
-#include "ParticleSystem.h"
+#include "ParticleEffectsManager.h"
 #include "GameContext.h"
 #include "SpatialPartitioning.h"
 #include "CoordinateSystem.h"
@@ -26,10 +27,10 @@ Extra::Extra(int _x, int _y, EXTRA_TYPE _type, GameContext* context)
     
     // GLOBAL CENTERING FIX: Don't override GameObject's centering system!
     // GameObject constructor already centers at tile center - no need to override
-    SDL_Log("🎁 EXTRA: Using GameObject global centering at (%.1f,%.1f)", x, y);
+    LOG_DEBUG(GAME, "🎁 EXTRA: Using GameObject global centering at (%.1f,%.1f)", x, y);
     
     const char* type_names[] = {"FLAME", "BOMB", "SPEED", "KICK", "GLOVE", "SKATE", "DISEASE", "VIAGRA", "KOKS"};
-    SDL_Log("Extra created: type=%s at pixel (%d,%d), grid (%d,%d), texture=%s", 
+    LOG_DEBUG(GAME, "Extra created: type=%s at pixel (%d,%d), grid (%d,%d), texture=%s", 
             type_names[(int)extra_type], (int)x, (int)y, get_map_x(), get_map_y(), texture_name.c_str());
 }
 
@@ -72,7 +73,7 @@ void Extra::act(float deltaTime) {
                 float dy = static_cast<float>(bomber->get_y()) - static_cast<float>(y);
                 float distance = sqrt(dx*dx + dy*dy);
                 
-                SDL_Log("EXTRA: Collected at distance %.1f by bomber at (%d,%d), extra at (%d,%d) using SpatialGrid", 
+                LOG_DEBUG(GAME, "EXTRA: Collected at distance %.1f by bomber at (%d,%d), extra at (%d,%d) using SpatialGrid", 
                         distance, bomber->get_x(), bomber->get_y(), x, y);
                 apply_effect_to_bomber(bomber);
                 collect();
@@ -81,7 +82,7 @@ void Extra::act(float deltaTime) {
         }
     } else {
         // FALLBACK: Use legacy O(n²) method if spatial grid not available
-        SDL_Log("EXTRA: SpatialGrid not available, using fallback collision detection");
+        LOG_DEBUG(GAME, "EXTRA: SpatialGrid not available, using fallback collision detection");
         for (auto& obj : ctx->get_object_lists()) {
             if (!obj || obj->get_type() != GameObject::BOMBER) continue;
             
@@ -92,7 +93,7 @@ void Extra::act(float deltaTime) {
                 float distance = sqrt(dx*dx + dy*dy);
                 
                 if (distance < 30.0f) {
-                    SDL_Log("EXTRA: Collected at distance %.1f by bomber at (%d,%d), extra at (%d,%d) using fallback", 
+                    LOG_DEBUG(GAME, "EXTRA: Collected at distance %.1f by bomber at (%d,%d), extra at (%d,%d) using fallback", 
                             distance, bomber->get_x(), bomber->get_y(), x, y);
                     apply_effect_to_bomber(bomber);
                     collect();
@@ -125,8 +126,10 @@ void Extra::collect() {
     
     collected = true;
     
-    // Create pickup particle effect using ObjectPool pattern
-    ParticleSystem* pickup_sparkles = GameObjectFactory::getInstance().create_particle_system(x, y, static_cast<int>(EXPLOSION_SPARKS), get_context());
+    // Create pickup particle effect (pooled by ParticleEffectsManager)
+    if (get_context() && get_context()->get_particle_effects()) {
+        get_context()->get_particle_effects()->spawn_emitter(x, y, EXPLOSION_SPARKS);
+    }
     
     // Play collection sound
     AudioPosition extra_pos(x, y, 0.0f);
@@ -148,57 +151,57 @@ void Extra::apply_effect_to_bomber(Bomber* bomber) {
         case BOMB:
             // Increase bomb capacity by 1
             bomber->inc_max_bombs(1);
-            SDL_Log("Bomber gained extra bomb! Max bombs: %d", bomber->get_max_bombs());
+            LOG_DEBUG(GAME, "Bomber gained extra bomb! Max bombs: %d", bomber->get_max_bombs());
             break;
             
         case FLAME:
             // Increase explosion power/range by 1
             bomber->inc_power(1);
-            SDL_Log("Bomber gained flame power! Power: %d", bomber->get_power());
+            LOG_DEBUG(GAME, "Bomber gained flame power! Power: %d", bomber->get_power());
             break;
             
         case SPEED:
             // Increase movement speed
             bomber->inc_speed(20);
-            SDL_Log("Bomber gained speed boost!");
+            LOG_DEBUG(GAME, "Bomber gained speed boost!");
             break;
             
         case KICK:
             // Allow bomb kicking
             bomber->set_can_kick(true);
-            SDL_Log("Bomber gained kick ability!");
+            LOG_DEBUG(GAME, "Bomber gained kick ability!");
             break;
             
         case GLOVE:
             // Allow bomb throwing
             bomber->set_can_throw(true);
-            SDL_Log("Bomber gained glove ability! Can now throw bombs!");
+            LOG_DEBUG(GAME, "Bomber gained glove ability! Can now throw bombs!");
             break;
             
         case SKATE:
             // Ice skates effect - increase speed but add sliding
             bomber->inc_speed(10);
-            SDL_Log("Bomber gained skates! (Basic speed boost)");
+            LOG_DEBUG(GAME, "Bomber gained skates! (Basic speed boost)");
             break;
             
         case DISEASE:
             // Constipation - reduce speed and disable bombing temporarily
             bomber->dec_speed(40);
-            SDL_Log("Bomber got constipation! Speed reduced!");
+            LOG_DEBUG(GAME, "Bomber got constipation! Speed reduced!");
             // TODO: Add temporary bomb disable
             break;
             
         case KOKS:
             // Make very fast but harder to control
             bomber->inc_speed(50);
-            SDL_Log("Bomber took speed! Very fast but harder to control!");
+            LOG_DEBUG(GAME, "Bomber took speed! Very fast but harder to control!");
             // TODO: Add uncontrollable movement effect
             break;
             
         case VIAGRA:
             // Negative effect - could make bombs stick or other penalty
             bomber->dec_speed(20);
-            SDL_Log("Bomber took viagra! Movement affected!");
+            LOG_DEBUG(GAME, "Bomber took viagra! Movement affected!");
             // TODO: Implement sticky bomb effect
             break;
     }
@@ -0,0 +1,114 @@
+#include "FramePacer.h"
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+
+FramePacer::FramePacer(const Config& _config)
+    : config(_config), frame_ticks(0), accumulator(0), frame_seconds(0.0f), dropped_steps(0),
+      jit_period_ticks(0), last_present(0), work_head(0) {
+    config.simulation_hz = std::max(config.simulation_hz, 1);
+    config.max_steps_per_frame = std::max(config.max_steps_per_frame, 1);
+
+    frequency = SDL_GetPerformanceFrequency();
+    step_ticks = frequency / config.simulation_hz;
+    step_seconds = static_cast<float>(step_ticks) / frequency;
+    set_max_fps(config.max_fps);
+    set_just_in_time(config.jit_refresh_hz);
+
+    last_frame_start = SDL_GetPerformanceCounter();
+    next_deadline = last_frame_start + frame_ticks;
+}
+
+void FramePacer::set_max_fps(int max_fps) {
+    config.max_fps = std::max(max_fps, 0);
+    frame_ticks = config.max_fps > 0 ? frequency / config.max_fps : 0;
+}
+
+void FramePacer::set_just_in_time(int refresh_hz) {
+    config.jit_refresh_hz = std::max(refresh_hz, 0);
+    jit_period_ticks = config.jit_refresh_hz > 0 ? frequency / config.jit_refresh_hz : 0;
+    std::fill(work_ticks, work_ticks + WORK_HISTORY, Uint64(0));
+    last_present = 0;
+}
+
+int FramePacer::begin_frame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 elapsed = now - last_frame_start;
+    last_frame_start = now;
+    frame_seconds = static_cast<float>(elapsed) / frequency;
+
+    accumulator += elapsed;
+    Uint64 steps = accumulator / step_ticks;
+    if (steps > static_cast<Uint64>(config.max_steps_per_frame)) {
+        // Spiral-of-death guard: drop the backlog instead of trying to catch up
+        dropped_steps += steps - config.max_steps_per_frame;
+        steps = config.max_steps_per_frame;
+        accumulator = steps * step_ticks + accumulator % step_ticks;
+    }
+    accumulator -= steps * step_ticks;
+    return static_cast<int>(steps);
+}
+
+float FramePacer::get_alpha() const {
+    return static_cast<float>(accumulator) / step_ticks;
+}
+
+void FramePacer::end_frame() {
+    Uint64 deadline = 0;
+    if (frame_ticks != 0) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (now >= next_deadline) {
+            // Frame over budget: start counting again from now, don't try to recover time
+            next_deadline = now + frame_ticks;
+        } else {
+            deadline = next_deadline;
+            next_deadline += frame_ticks;
+        }
+    }
+
+    deadline = std::max(deadline, get_jit_deadline());
+    if (deadline != 0) {
+        wait_until(deadline);
+    }
+}
+
+void FramePacer::wait_until(Uint64 deadline) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now >= deadline) {
+        return;
+    }
+    Uint64 remaining_ns = (deadline - now) * SDL_NS_PER_SECOND / frequency;
+    if (remaining_ns > SPIN_MARGIN_NS) {
+        SDL_DelayNS(remaining_ns - SPIN_MARGIN_NS);
+    }
+    while (SDL_GetPerformanceCounter() < deadline) {
+        // Spin the last stretch
+    }
+}
+
+void FramePacer::mark_submit() {
+    work_ticks[work_head] = SDL_GetPerformanceCounter() - last_frame_start;
+    work_head = (work_head + 1) % WORK_HISTORY;
+}
+
+void FramePacer::mark_presented() {
+    last_present = SDL_GetPerformanceCounter();
+}
+
+Uint64 FramePacer::predicted_work_ticks() const {
+    return *std::max_element(work_ticks, work_ticks + WORK_HISTORY);
+}
+
+float FramePacer::get_predicted_work_ms() const {
+    return predicted_work_ticks() * 1000.0f / frequency;
+}
+
+Uint64 FramePacer::get_jit_deadline() const {
+    if (jit_period_ticks == 0 || last_present == 0) {
+        return 0;
+    }
+    Uint64 needed = predicted_work_ticks() + JIT_SAFETY_NS * frequency / SDL_NS_PER_SECOND;
+    if (needed >= jit_period_ticks) {
+        return 0; // No slack to hide: render straight away
+    }
+    return last_present + jit_period_ticks - needed;
+}
@@ -0,0 +1,86 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * @brief Simulación a paso fijo con acumulador + limitador de frames
+ *
+ * Cada frame: begin_frame() mide el tiempo real transcurrido, lo suma al
+ * acumulador y devuelve cuántos pasos de get_step() segundos hay que simular.
+ * El resto que queda en el acumulador da get_alpha() (0..1), la fracción
+ * entre el penúltimo y el último estado simulado con la que se interpola el render.
+ *
+ * Espiral de la muerte: si la simulación no da abasto (o el proceso estuvo
+ * parado, p.ej. arrastrando la ventana) nunca se simulan más de
+ * max_steps_per_frame pasos; el tiempo sobrante se descarta y se cuenta en
+ * get_dropped_steps().
+ *
+ * end_frame() espera hasta el siguiente frame si hay límite de FPS: duerme
+ * con el scheduler hasta SPIN_MARGIN_NS antes del plazo y el resto lo hace
+ * en espera activa, que es lo único preciso en todos los sistemas.
+ *
+ * Render justo a tiempo (modo baja latencia): con jit_refresh_hz > 0,
+ * end_frame() espera además hasta el último momento en que aún da tiempo a
+ * simular y dibujar antes del siguiente refresco: último present + periodo
+ * - trabajo previsto - JIT_SAFETY_NS. El trabajo previsto es el máximo de los
+ * últimos WORK_HISTORY frames (de begin_frame() a mark_submit()), así que un
+ * pico aislado adelanta el despertar durante un rato en vez de perder un vsync.
+ */
+class FramePacer {
+public:
+    struct Config {
+        int simulation_hz = 60;
+        int max_fps = 0;               // 0 = sin límite (vsync decide)
+        int max_steps_per_frame = 5;
+        int jit_refresh_hz = 0;        // >0: render justo a tiempo contra este refresco
+    };
+
+    explicit FramePacer(const Config& config);
+
+    void set_max_fps(int max_fps);
+    void set_just_in_time(int refresh_hz);
+    bool is_just_in_time() const { return jit_period_ticks != 0; }
+    int get_max_fps() const { return config.max_fps; }
+    int get_simulation_hz() const { return config.simulation_hz; }
+
+    int begin_frame();
+    void end_frame();
+
+    // Alrededor de SDL_GL_SwapWindow: fin del trabajo del frame y present completado
+    void mark_submit();
+    void mark_presented();
+
+    float get_step() const { return step_seconds; }
+    float get_alpha() const;
+    float get_frame_seconds() const { return frame_seconds; }
+    Uint64 get_dropped_steps() const { return dropped_steps; }
+    float get_predicted_work_ms() const;
+
+    static constexpr Uint64 SPIN_MARGIN_NS = 2000000;   // 2 ms: holgura típica del scheduler
+    static constexpr Uint64 JIT_SAFETY_NS = 1000000;    // 1 ms entre el swap previsto y el vsync
+    static constexpr int WORK_HISTORY = 30;
+
+private:
+    Config config;
+    Uint64 frequency;
+    Uint64 step_ticks;
+    Uint64 frame_ticks;       // 0 sin límite
+    Uint64 last_frame_start;
+    Uint64 next_deadline;
+    Uint64 accumulator;
+    float step_seconds;
+    float frame_seconds;
+    Uint64 dropped_steps;
+
+    Uint64 jit_period_ticks;  // 0 sin render justo a tiempo
+    Uint64 last_present;
+    Uint64 work_ticks[WORK_HISTORY];
+    int work_head;
+
+    Uint64 predicted_work_ticks() const;
+    Uint64 get_jit_deadline() const;
+    void wait_until(Uint64 deadline);
+};
+
+#endif
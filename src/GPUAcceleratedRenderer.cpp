@@ -1,4 +1,5 @@
 #include "GPUAcceleratedRenderer.h"
+#include "Logger.h"
 #include "Resources.h"
 #include "ErrorHandling.h"
 #include <iostream>
@@ -7,12 +8,33 @@
 #include <SDL3_image/SDL_image.h>
 #include <cstring>
 #include <cmath>
+#include "Profiler.h"
+#include "RenderSnapshot.h"
+#include "CoordinateSystem.h"
+
+namespace {
+    // Non-null on the simulation thread while the render thread owns the GL context
+    thread_local RenderSnapshot* recording_snapshot = nullptr;
+}
+
+void GPUAcceleratedRenderer::set_recording(RenderSnapshot* snapshot) {
+    recording_snapshot = snapshot;
+}
+
+RenderSnapshot* GPUAcceleratedRenderer::get_recording() {
+    return recording_snapshot;
+}
 
 GPUAcceleratedRenderer::GPUAcceleratedRenderer() 
     : gl_context(nullptr), main_program(0), particle_compute_program(0), debug_program(0),
       sprite_vao(0), sprite_vbo(0), sprite_ebo(0), particle_vao(0), particle_vbo(0),
       particle_ssbo(0), particle_counter_buffer(0), max_gpu_particles(0),
-      current_quad_count(0), current_effect(NORMAL), current_texture(0), next_particle_index(0),
+      current_quad_count(0), current_effect(NORMAL), current_texture(0),
+      stream_mapped(nullptr), stream_region(0), stream_cursor(0), stream_persistent(false),
+      gpu_timer_slot(0), gpu_timer_supported(false), gpu_timer_in_frame(false), current_gpu_pass(GPU_PASS_SPRITES),
+      next_particle_index(0), frame_begin_counter(0),
+      explosion_program(0), explosion_vao(0), explosion_instance_vbo(0),
+      u_explosion_projection(-1), u_explosion_view(-1), u_explosion_time(-1),
       current_time(0.0f), camera_zoom(1.0f), debug_overlay(false) {
     
     // Initialize vectors and matrices
@@ -21,12 +43,15 @@ GPUAcceleratedRenderer::GPUAcceleratedRenderer()
     glm_vec2_copy((vec2){0.0f, 500.0f}, gravity_force); // Default gravity
     glm_vec2_zero(wind_force);
     
-    // Initialize explosion state
-    glm_vec4_zero(current_explosion_center);
-    glm_vec4_zero(current_explosion_size);
+    explosion_instances.reserve(MAX_EXPLOSION_INSTANCES);
+    for (int i = 0; i < STREAM_REGIONS; i++) {
+        stream_fences[i] = nullptr;
+    }
     
     // Initialize performance stats
     memset(&perf_stats, 0, sizeof(perf_stats));
+    memset(gpu_timer_frames, 0, sizeof(gpu_timer_frames));
+    memset(&gpu_timings, 0, sizeof(gpu_timings));
 }
 
 GPUAcceleratedRenderer::~GPUAcceleratedRenderer() {
@@ -34,20 +59,20 @@ GPUAcceleratedRenderer::~GPUAcceleratedRenderer() {
 }
 
 GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int width, int height) {
-    SDL_Log("GPU Renderer: Starting initialization...");
+    LOG_INFO(RENDER, "GPU Renderer: Starting initialization...");
     window = _window;  // Store window reference
     screen_width = width;
     screen_height = height;
     
     // Create OpenGL context (attributes already set in Game.cpp)
-    SDL_Log("GPU Renderer: Creating OpenGL context...");
+    LOG_INFO(RENDER, "GPU Renderer: Creating OpenGL context...");
     gl_context = SDL_GL_CreateContext(window);
     if (!gl_context) {
         // OPTIMIZED: Use GameResult<T> error handling instead of SDL_Log
         std::string error_msg = "Failed to create OpenGL context: " + std::string(SDL_GetError());
         
         // Try fallback to OpenGL 3.3 core
-        SDL_Log("Attempting fallback to OpenGL 3.3...");
+        LOG_INFO(RENDER, "Attempting fallback to OpenGL 3.3...");
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
         gl_context = SDL_GL_CreateContext(window);
@@ -62,10 +87,10 @@ GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int wid
             );
         }
     }
-    SDL_Log("GPU Renderer: OpenGL context created successfully");
+    LOG_INFO(RENDER, "GPU Renderer: OpenGL context created successfully");
     
     // Make context current
-    SDL_Log("GPU Renderer: Making context current...");
+    LOG_INFO(RENDER, "GPU Renderer: Making context current...");
     if (SDL_GL_MakeCurrent(window, gl_context) < 0) {
         // OPTIMIZED: Use GameResult<T> error handling instead of SDL_Log
         std::string error_msg = "Failed to make GL context current: " + std::string(SDL_GetError());
@@ -78,7 +103,7 @@ GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int wid
     }
     
     // Initialize GLAD
-    SDL_Log("GPU Renderer: Loading OpenGL extensions with GLAD...");
+    LOG_INFO(RENDER, "GPU Renderer: Loading OpenGL extensions with GLAD...");
     if (!gladLoadGL((GLADloadfunc)SDL_GL_GetProcAddress)) {
         // OPTIMIZED: Use GameResult<T> error handling instead of SDL_Log
         return GameResult<void>::error(
@@ -88,7 +113,7 @@ GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int wid
             "GPUAcceleratedRenderer::initialize() - GLAD initialization"
         );
     }
-    SDL_Log("GPU Renderer: GLAD loaded successfully");
+    LOG_INFO(RENDER, "GPU Renderer: GLAD loaded successfully");
     
     // Verify OpenGL version
     const char* version = (const char*)glGetString(GL_VERSION);
@@ -96,11 +121,11 @@ GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int wid
     const char* renderer = (const char*)glGetString(GL_RENDERER);
     const char* vendor = (const char*)glGetString(GL_VENDOR);
     
-    SDL_Log("=== OpenGL Context Information ===");
-    SDL_Log("OpenGL Version: %s", version ? version : "Unknown");
-    SDL_Log("GLSL Version: %s", glsl_version ? glsl_version : "Unknown");
-    SDL_Log("Renderer: %s", renderer ? renderer : "Unknown");
-    SDL_Log("Vendor: %s", vendor ? vendor : "Unknown");
+    LOG_INFO(RENDER, "=== OpenGL Context Information ===");
+    LOG_INFO(RENDER, "OpenGL Version: %s", version ? version : "Unknown");
+    LOG_INFO(RENDER, "GLSL Version: %s", glsl_version ? glsl_version : "Unknown");
+    LOG_INFO(RENDER, "Renderer: %s", renderer ? renderer : "Unknown");
+    LOG_INFO(RENDER, "Vendor: %s", vendor ? vendor : "Unknown");
     
     // Check for minimum OpenGL 3.3 support
     if (!GLAD_GL_VERSION_3_3) {
@@ -114,11 +139,11 @@ GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int wid
     }
     
     if (GLAD_GL_VERSION_4_6) {
-        SDL_Log("OpenGL 4.6 supported - using advanced features");
+        LOG_INFO(RENDER, "OpenGL 4.6 supported - using advanced features");
     } else if (GLAD_GL_VERSION_4_0) {
-        SDL_Log("OpenGL 4.0 supported - using most features");
+        LOG_INFO(RENDER, "OpenGL 4.0 supported - using most features");
     } else {
-        SDL_Log("OpenGL 3.3 supported - using basic features");
+        LOG_INFO(RENDER, "OpenGL 3.3 supported - using basic features");
     }
     
     // Enable advanced OpenGL features
@@ -149,6 +174,8 @@ GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int wid
     // Setup rendering systems
     setup_matrices();
     setup_sprite_rendering();
+    setup_explosion_rendering();
+    setup_gpu_timers();
     
     // Initialize particle system
     if (!init_particle_system(100000)) { // 100K particles!
@@ -172,8 +199,8 @@ GameResult<void> GPUAcceleratedRenderer::initialize(SDL_Window* _window, int wid
         );
     }
     
-    SDL_Log("GPU Accelerated Renderer initialized successfully!");
-    SDL_Log("Max particles: %d", max_gpu_particles);
+    LOG_INFO(RENDER, "GPU Accelerated Renderer initialized successfully!");
+    LOG_INFO(RENDER, "Max particles: %d", max_gpu_particles);
     
     // OPTIMIZED: Use GameResult<T> success instead of return true
     return GameResult<void>::success();
@@ -184,6 +211,19 @@ void GPUAcceleratedRenderer::shutdown() {
     if (main_program) glDeleteProgram(main_program);
     if (particle_compute_program) glDeleteProgram(particle_compute_program);
     if (debug_program) glDeleteProgram(debug_program);
+    if (explosion_program) glDeleteProgram(explosion_program);
+    
+    for (int i = 0; i < STREAM_REGIONS; i++) {
+        if (stream_fences[i]) {
+            glDeleteSync(stream_fences[i]);
+            stream_fences[i] = nullptr;
+        }
+    }
+    if (stream_mapped && sprite_vbo) {
+        glBindBuffer(GL_ARRAY_BUFFER, sprite_vbo);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        stream_mapped = nullptr;
+    }
     
     if (sprite_vao) glDeleteVertexArrays(1, &sprite_vao);
     if (sprite_vbo) glDeleteBuffers(1, &sprite_vbo);
@@ -194,6 +234,17 @@ void GPUAcceleratedRenderer::shutdown() {
     if (particle_ssbo) glDeleteBuffers(1, &particle_ssbo);
     if (particle_counter_buffer) glDeleteBuffers(1, &particle_counter_buffer);
     
+    if (explosion_vao) glDeleteVertexArrays(1, &explosion_vao);
+    if (explosion_instance_vbo) glDeleteBuffers(1, &explosion_instance_vbo);
+    
+    if (gpu_timer_supported) {
+        for (auto& frame : gpu_timer_frames) {
+            glDeleteQueries(GPU_TIMER_MAX_MARKS, frame.queries);
+            frame.pending = false;
+        }
+        gpu_timer_supported = false;
+    }
+    
     // Clean up textures
     for (auto& [name, texture] : loaded_textures) {
         glDeleteTextures(1, &texture);
@@ -205,13 +256,13 @@ void GPUAcceleratedRenderer::shutdown() {
         gl_context = nullptr;
     }
     
-    SDL_Log("GPU Accelerated Renderer shutdown complete");
+    LOG_INFO(RENDER, "GPU Accelerated Renderer shutdown complete");
 }
 
 bool GPUAcceleratedRenderer::load_all_shaders() {
     // CRITICAL FIX: Ensure our context is active before any GL operations
     if (SDL_GL_MakeCurrent(window, gl_context) < 0) {
-        SDL_Log("ERROR: Failed to make context current before loading shaders: %s", SDL_GetError());
+        LOG_ERROR(RENDER, "Failed to make context current before loading shaders: %s", SDL_GetError());
         return false;
     }
 
@@ -223,19 +274,19 @@ bool GPUAcceleratedRenderer::load_all_shaders() {
     fragment_src = preprocess_shader_includes(fragment_src);
     
     if (vertex_src.empty() || fragment_src.empty()) {
-        SDL_Log("Failed to load main shader sources");
+        LOG_WARN(RENDER, "Failed to load main shader sources");
         return false;
     }
     
     GLuint vertex_shader = compile_shader(vertex_src, GL_VERTEX_SHADER, "main_vertex");
     if (!vertex_shader) {
-        SDL_Log("ERROR: Vertex shader compilation failed!");
+        LOG_ERROR(RENDER, "Vertex shader compilation failed!");
         return false;
     }
     
     GLuint fragment_shader = compile_shader(fragment_src, GL_FRAGMENT_SHADER, "main_fragment");
     if (!fragment_shader) {
-        SDL_Log("ERROR: Fragment shader compilation failed!");
+        LOG_ERROR(RENDER, "Fragment shader compilation failed!");
         glDeleteShader(vertex_shader);
         return false;
     }
@@ -245,10 +296,10 @@ bool GPUAcceleratedRenderer::load_all_shaders() {
     glDeleteShader(fragment_shader);
     
     if (!main_program) {
-        SDL_Log("ERROR: Shader program linking failed!");
+        LOG_ERROR(RENDER, "Shader program linking failed!");
         return false;
     }
-    SDL_Log("Shaders compiled and linked successfully");
+    LOG_INFO(RENDER, "Shaders compiled and linked successfully");
     
     // Get uniform locations for main program
     glUseProgram(main_program);
@@ -256,8 +307,6 @@ bool GPUAcceleratedRenderer::load_all_shaders() {
     u_view = glGetUniformLocation(main_program, "uView");
     // u_model = glGetUniformLocation(main_program, "uModel");
     u_time = glGetUniformLocation(main_program, "uTimeData");
-    u_explosion_center = glGetUniformLocation(main_program, "uExplosionCenter");
-    u_explosion_size = glGetUniformLocation(main_program, "uExplosionSize");
     
     // Get texture uniform locations
     u_texture = glGetUniformLocation(main_program, "uTexture");
@@ -313,15 +362,63 @@ bool GPUAcceleratedRenderer::load_all_shaders() {
                 GLint u_air_density_compute = glGetUniformLocation(particle_compute_program, "uAirDensity");
                 GLint u_magnetic_compute = glGetUniformLocation(particle_compute_program, "uMagneticField");
                 
-                SDL_Log("Compute shader uniforms initialized - spectacular effects ready!");
+                LOG_INFO(RENDER, "Compute shader uniforms initialized - spectacular effects ready!");
             }
         }
     }
     
+    // Instanced explosion program is optional: without it explosions are skipped, not fatal
+    if (!load_explosion_shaders()) {
+        LOG_WARN(RENDER, "Instanced explosion shaders failed to load, explosions will not be drawn");
+    }
+    
     check_gl_error("shader loading");
     return true;
 }
 
+bool GPUAcceleratedRenderer::load_explosion_shaders() {
+    std::string vertex_src = Resources::load_shader_source("shaders/explosion_instanced_vertex.glsl");
+    std::string fragment_src = Resources::load_shader_source("shaders/explosion_instanced_fragment.glsl");
+    fragment_src = preprocess_shader_includes(fragment_src);
+    
+    if (vertex_src.empty() || fragment_src.empty()) {
+        return false;
+    }
+    
+    GLuint vertex_shader = compile_shader(vertex_src, GL_VERTEX_SHADER, "explosion_vertex");
+    if (!vertex_shader) {
+        return false;
+    }
+    
+    GLuint fragment_shader = compile_shader(fragment_src, GL_FRAGMENT_SHADER, "explosion_fragment");
+    if (!fragment_shader) {
+        glDeleteShader(vertex_shader);
+        return false;
+    }
+    
+    explosion_program = create_program(vertex_shader, fragment_shader, "explosion_program");
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    
+    if (!explosion_program) {
+        return false;
+    }
+    
+    u_explosion_projection = glGetUniformLocation(explosion_program, "uProjection");
+    u_explosion_view = glGetUniformLocation(explosion_program, "uView");
+    u_explosion_time = glGetUniformLocation(explosion_program, "uTimeData");
+    
+    // Constant for the program's lifetime, so set it once instead of per frame.
+    // Both stages declare uTileSize, so this one location feeds the vertex and fragment math
+    GLint u_tile_size = glGetUniformLocation(explosion_program, "uTileSize");
+    if (u_tile_size >= 0) {
+        glUseProgram(explosion_program);
+        glUniform1f(u_tile_size, (float)CoordinateConfig::TILE_SIZE);
+        glUseProgram(0);
+    }
+    return true;
+}
+
 GLuint GPUAcceleratedRenderer::compile_shader(const std::string& source, GLenum type, const std::string& name) {
     GLuint shader = glCreateShader(type);
     const char* src = source.c_str();
@@ -333,7 +430,7 @@ GLuint GPUAcceleratedRenderer::compile_shader(const std::string& source, GLenum
     if (!success) {
         GLchar info_log[2048];
         glGetShaderInfoLog(shader, sizeof(info_log), nullptr, info_log);
-        SDL_Log("Shader compilation error (%s): %s", name.c_str(), info_log);
+        LOG_ERROR(RENDER, "Shader compilation error (%s): %s", name.c_str(), info_log);
         glDeleteShader(shader);
         return 0;
     }
@@ -359,7 +456,7 @@ GLuint GPUAcceleratedRenderer::create_program(GLuint vertex, GLuint fragment, co
     if (!success) {
         GLchar info_log[2048];
         glGetProgramInfoLog(program, sizeof(info_log), nullptr, info_log);
-        SDL_Log("ERROR: Program linking error (%s): %s", name.c_str(), info_log);
+        LOG_ERROR(RENDER, "Program linking error (%s): %s", name.c_str(), info_log);
         
         glDeleteProgram(program);
         return 0;
@@ -379,7 +476,7 @@ GLuint GPUAcceleratedRenderer::create_compute_program(GLuint compute, const std:
     if (!success) {
         GLchar info_log[2048];
         glGetProgramInfoLog(program, sizeof(info_log), nullptr, info_log);
-        SDL_Log("Compute program linking error (%s): %s", name.c_str(), info_log);
+        LOG_ERROR(RENDER, "Compute program linking error (%s): %s", name.c_str(), info_log);
         glDeleteProgram(program);
         return 0;
     }
@@ -402,7 +499,7 @@ void GPUAcceleratedRenderer::setup_matrices() {
     glViewport(0, 0, screen_width, screen_height);
     check_gl_error("set viewport");
     
-    SDL_Log("GPU Renderer: Set up matrices and viewport for %dx%d screen (SDL coordinate system)", screen_width, screen_height);
+    LOG_INFO(RENDER, "GPU Renderer: Set up matrices and viewport for %dx%d screen (SDL coordinate system)", screen_width, screen_height);
 }
 
 void GPUAcceleratedRenderer::setup_sprite_rendering() {
@@ -413,19 +510,9 @@ void GPUAcceleratedRenderer::setup_sprite_rendering() {
     
     glBindVertexArray(sprite_vao);
     
-    // Setup dynamic vertex buffer using simple vertex structure
+    // Streaming vertex ring (persistent-mapped or orphaning, depending on the context)
     glBindBuffer(GL_ARRAY_BUFFER, sprite_vbo);
-    size_t buffer_size = MAX_QUADS * 4 * sizeof(SimpleVertex);
-    glBufferData(GL_ARRAY_BUFFER, buffer_size, nullptr, GL_DYNAMIC_DRAW);
-    
-    // Verify buffer was created successfully
-    GLint actual_buffer_size = 0;
-    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &actual_buffer_size);
-    
-    if (actual_buffer_size == 0) {
-        SDL_Log("ERROR: Failed to create VBO! OpenGL may be out of memory or context invalid");
-        check_gl_error("VBO creation failed");
-    }
+    setup_vertex_stream();
     
     // Setup index buffer
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sprite_ebo);
@@ -477,6 +564,126 @@ void GPUAcceleratedRenderer::setup_sprite_rendering() {
     check_gl_error("sprite rendering setup");
 }
 
+void GPUAcceleratedRenderer::setup_explosion_rendering() {
+    // No per-vertex attributes: corners come from gl_VertexID, params from the instance buffer
+    glGenVertexArrays(1, &explosion_vao);
+    glGenBuffers(1, &explosion_instance_vbo);
+    
+    glBindVertexArray(explosion_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, explosion_instance_vbo);
+    glBufferData(GL_ARRAY_BUFFER, MAX_EXPLOSION_INSTANCES * sizeof(ExplosionInstance), nullptr, GL_DYNAMIC_DRAW);
+    
+    // Center + age (location 0)
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(ExplosionInstance),
+                         (void*)offsetof(ExplosionInstance, center_age));
+    glEnableVertexAttribArray(0);
+    glVertexAttribDivisor(0, 1);
+    
+    // Arm lengths (location 1)
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(ExplosionInstance),
+                         (void*)offsetof(ExplosionInstance, arms));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+    
+    glBindVertexArray(0);
+    check_gl_error("explosion rendering setup");
+}
+
+void GPUAcceleratedRenderer::setup_vertex_stream() {
+    // sprite_vbo must be bound to GL_ARRAY_BUFFER
+    const GLsizeiptr ring_size = (GLsizeiptr)STREAM_REGIONS * MAX_QUADS * 4 * sizeof(AdvancedVertex);
+    
+    stream_persistent = false;
+    stream_mapped = nullptr;
+    
+    if ((GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage) && glBufferStorage) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, ring_size, nullptr, flags);
+        stream_mapped = static_cast<AdvancedVertex*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, ring_size, flags));
+        
+        if (stream_mapped) {
+            stream_persistent = true;
+        } else {
+            // Immutable storage can't be re-specified: start over with a fresh buffer
+            LOG_WARN(RENDER, "Persistent mapping of sprite VBO failed, falling back to orphaning");
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glDeleteBuffers(1, &sprite_vbo);
+            glGenBuffers(1, &sprite_vbo);
+            glBindBuffer(GL_ARRAY_BUFFER, sprite_vbo);
+        }
+    }
+    
+    if (!stream_persistent) {
+        glBufferData(GL_ARRAY_BUFFER, ring_size, nullptr, GL_STREAM_DRAW);
+    }
+    
+    stream_region = 0;
+    stream_cursor = 0;
+    
+    LOG_INFO(RENDER, "GPU Renderer: Sprite vertex ring %d x %d quads (%s)", STREAM_REGIONS, MAX_QUADS,
+            stream_persistent ? "persistent-mapped" : "orphaning");
+    check_gl_error("vertex stream setup");
+}
+
+void GPUAcceleratedRenderer::advance_stream_region() {
+    // Fence the region the GPU may still be reading, then move to the next one
+    if (stream_persistent) {
+        stream_fences[stream_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    
+    stream_region = (stream_region + 1) % STREAM_REGIONS;
+    stream_cursor = 0;
+    
+    if (stream_persistent) {
+        GLsync fence = stream_fences[stream_region];
+        if (fence) {
+            GLenum result = glClientWaitSync(fence, 0, 0);
+            if (result == GL_TIMEOUT_EXPIRED) {
+                perf_stats.stream_stalls++;
+                // Ring is STREAM_REGIONS batches deep, so this only blocks when the GPU is far behind
+                do {
+                    result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+                } while (result == GL_TIMEOUT_EXPIRED);
+            }
+            glDeleteSync(fence);
+            stream_fences[stream_region] = nullptr;
+        }
+    } else if (stream_region == 0) {
+        // Wrapped around: orphan so the driver hands us fresh storage instead of syncing
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)STREAM_REGIONS * MAX_QUADS * 4 * sizeof(AdvancedVertex),
+                     nullptr, GL_STREAM_DRAW);
+    }
+}
+
+GLint GPUAcceleratedRenderer::upload_batch_vertices() {
+    const int vertex_count = (int)batch_vertices.size();
+    const int region_vertices = MAX_QUADS * 4;
+    
+    if (vertex_count > region_vertices) {
+        LOG_ERROR(RENDER, "Batch of %d vertices exceeds stream region (%d)", vertex_count, region_vertices);
+        return -1;
+    }
+    
+    if (!stream_persistent) {
+        glBindBuffer(GL_ARRAY_BUFFER, sprite_vbo);
+    }
+    
+    if (stream_cursor + vertex_count > region_vertices) {
+        advance_stream_region();
+    }
+    
+    const GLint base_vertex = stream_region * region_vertices + stream_cursor;
+    if (stream_persistent) {
+        memcpy(stream_mapped + base_vertex, batch_vertices.data(), vertex_count * sizeof(AdvancedVertex));
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, base_vertex * sizeof(AdvancedVertex),
+                        vertex_count * sizeof(AdvancedVertex), batch_vertices.data());
+    }
+    
+    stream_cursor += vertex_count;
+    return base_vertex;
+}
+
 bool GPUAcceleratedRenderer::init_particle_system(int max_particles) {
     max_gpu_particles = max_particles;
     cpu_particles.resize(max_particles);
@@ -518,6 +725,20 @@ bool GPUAcceleratedRenderer::init_particle_system(int max_particles) {
 }
 
 void GPUAcceleratedRenderer::begin_frame() {
+    // Recycle the oldest timer slot: read it if the GPU is done, never wait
+    if (gpu_timer_supported) {
+        gpu_timer_slot = (gpu_timer_slot + 1) % GPU_TIMER_FRAMES;
+        GpuTimerFrame& frame = gpu_timer_frames[gpu_timer_slot];
+        if (frame.pending && !resolve_gpu_timer_frame(frame)) {
+            perf_stats.gpu_timer_misses++;
+        }
+        frame.pending = false;
+        frame.mark_count = 0;
+        current_gpu_pass = GPU_PASS_SPRITES;
+        gpu_timer_in_frame = true;
+        record_gpu_mark(GPU_PASS_SPRITES);
+    }
+    
     // Clear buffers
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -526,6 +747,8 @@ void GPUAcceleratedRenderer::begin_frame() {
     perf_stats.draw_calls = 0;
     perf_stats.particles_rendered = 0;
     perf_stats.vertices_rendered = 0;
+    perf_stats.stream_stalls = 0;
+    frame_begin_counter = SDL_GetPerformanceCounter();
     
     // Update time
     current_time = SDL_GetTicks() / 1000.0f;
@@ -539,6 +762,22 @@ void GPUAcceleratedRenderer::end_frame() {
         flush_batch();
     }
     
+    // Explosions queued but not explicitly rendered still get drawn this frame
+    if (!explosion_instances.empty()) {
+        render_explosions();
+    }
+    
+    if (gpu_timer_in_frame) {
+        record_gpu_mark(GPU_PASS_COUNT); // Marca final
+        gpu_timer_frames[gpu_timer_slot].pending = true;
+        gpu_timer_in_frame = false;
+    }
+    
+    if (frame_begin_counter != 0) {
+        perf_stats.cpu_time = (SDL_GetPerformanceCounter() - frame_begin_counter) * 1000.0f /
+                              (float)SDL_GetPerformanceFrequency();
+    }
+    
     check_gl_error("end frame");
 }
 
@@ -558,7 +797,7 @@ void GPUAcceleratedRenderer::check_gl_error(const std::string& operation) {
             case GL_OUT_OF_MEMORY: error_str = "GL_OUT_OF_MEMORY"; break;
             case GL_INVALID_FRAMEBUFFER_OPERATION: error_str = "GL_INVALID_FRAMEBUFFER_OPERATION"; break;
         }
-        SDL_Log("OpenGL error in %s: 0x%x (%s)", operation.c_str(), error, error_str);
+        LOG_WARN(RENDER, "OpenGL error in %s: 0x%x (%s)", operation.c_str(), error, error_str);
     }
 }
 
@@ -584,12 +823,12 @@ std::string GPUAcceleratedRenderer::preprocess_shader_includes(const std::string
         
         // Extraer el nombre del archivo
         std::string filename = result.substr(quote_start + 1, quote_end - quote_start - 1);
-        SDL_Log("Processing shader include: %s", filename.c_str());
+        LOG_DEBUG(RENDER, "Processing shader include: %s", filename.c_str());
         
         // Cargar el contenido del archivo incluido
         std::string include_content = Resources::load_shader_source("shaders/" + filename);
         if (include_content.empty()) {
-            SDL_Log("ERROR: Failed to load included shader file: %s", filename.c_str());
+            LOG_ERROR(RENDER, "Failed to load included shader file: %s", filename.c_str());
             pos++;
             continue;
         }
@@ -614,6 +853,10 @@ std::string GPUAcceleratedRenderer::preprocess_shader_includes(const std::string
 
 // Additional methods will be implemented as needed...
 void GPUAcceleratedRenderer::begin_batch(EffectType effect) {
+    if (recording_snapshot) {
+        recording_snapshot->begin_batch(effect);
+        return;
+    }
     if (current_quad_count > 0 && current_effect != effect) {
         flush_batch();
     }
@@ -624,10 +867,11 @@ void GPUAcceleratedRenderer::flush_batch() {
     if (current_quad_count == 0) {
         return;
     }
+    PROFILE_ZONE("GPU::flush_batch");
 
     // Safety checks to prevent crash
     if (!gl_context || !main_program || !sprite_vao || !sprite_vbo) {
-        SDL_Log("GPU Renderer: Critical objects not initialized, skipping batch");
+        LOG_WARN(RENDER, "GPU Renderer: Critical objects not initialized, skipping batch");
         current_quad_count = 0;
         batch_vertices.clear();
         return;
@@ -640,112 +884,38 @@ void GPUAcceleratedRenderer::flush_batch() {
     
     // Validate our data before attempting to upload
     if (batch_vertices.size() != current_quad_count * 4) {
-        SDL_Log("ERROR: Vertex count mismatch! Expected %d, got %zu", 
+        LOG_ERROR(RENDER, "Vertex count mismatch! Expected %d, got %zu", 
                 current_quad_count * 4, batch_vertices.size());
         current_quad_count = 0;
         batch_vertices.clear();
         return;
     }
     
-    // Check for valid OpenGL context
-    check_gl_error("pre-flush");
-    
-    // Upload vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, sprite_vbo);
-    check_gl_error("bind array buffer");
-    
-    // Validate buffer size before upload
-    GLint buffer_size = 0;
-    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &buffer_size);
-    size_t data_size = batch_vertices.size() * sizeof(AdvancedVertex);
-    
-    // If buffer is 0, try to recreate it
-    if (buffer_size == 0) {
-        SDL_Log("WARNING: Buffer size is 0, attempting to recreate VBO");
-        
-        // Recreate the buffer
-        size_t expected_buffer_size = MAX_QUADS * 4 * sizeof(SimpleVertex);
-        glBufferData(GL_ARRAY_BUFFER, expected_buffer_size, nullptr, GL_DYNAMIC_DRAW);
-        
-        // Check if recreation worked
-        glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &buffer_size);
-        
-        if (buffer_size == 0) {
-            SDL_Log("ERROR: Failed to recreate VBO! OpenGL context may be lost");
-            current_quad_count = 0;
-            batch_vertices.clear();
-            return;
-        }
-    }
-    
-    if (data_size > buffer_size) {
-        SDL_Log("ERROR: Data too large for buffer! Data: %zu, Buffer: %d", data_size, buffer_size);
-        current_quad_count = 0;
-        batch_vertices.clear();
-        return;
-    }
-    
-    glBufferSubData(GL_ARRAY_BUFFER, 0, data_size, batch_vertices.data());
-    check_gl_error("buffer subdata");
-    
-    // Validate shader program
-    if (!glIsProgram(main_program)) {
-        SDL_Log("ERROR: Program %d is no longer a valid OpenGL program object!", main_program);
+    // Write vertices into the streaming ring (no implicit sync with in-flight draws)
+    GLint base_vertex = upload_batch_vertices();
+    if (base_vertex < 0) {
         current_quad_count = 0;
         batch_vertices.clear();
         return;
     }
     
-    // Use main shader program
     glUseProgram(main_program);
-    check_gl_error("use program");
-    
-    // Validate program is linked
-    GLint link_status = 0;
-    glGetProgramiv(main_program, GL_LINK_STATUS, &link_status);
-    if (link_status != GL_TRUE) {
-        SDL_Log("ERROR: Shader program %d not linked properly! Link status: %d", main_program, link_status);
-        
-        // Try to get more info about the program
-        GLint info_log_length = 0;
-        glGetProgramiv(main_program, GL_INFO_LOG_LENGTH, &info_log_length);
-        if (info_log_length > 1) {
-            std::vector<char> info_log(info_log_length);
-            glGetProgramInfoLog(main_program, info_log_length, nullptr, info_log.data());
-            SDL_Log("Program info log: %s", info_log.data());
-        }
-        
-        SDL_Log("WARNING: Continuing despite link status issue...");
-    }
-    
     update_uniforms();
-    check_gl_error("update uniforms");
     
-    // Draw
+    // VAO holds the attribute/VBO bindings; no need to rebind the VBO for drawing
     glBindVertexArray(sprite_vao);
-    check_gl_error("bind vao");
-    
-    // WORKAROUND: Force rebind VBO after VAO (VAO might not be capturing VBO state correctly)
-    glBindBuffer(GL_ARRAY_BUFFER, sprite_vbo);
-    check_gl_error("force rebind vbo after vao");
     
     // CRITICAL FIX: Clean OpenGL state to prevent SDL/TTF interference
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, 0);  // Unbind any existing texture first
-    check_gl_error("clean texture state");
-    
-    // Bind the current texture for the batch
     if (current_texture != 0) {
         glBindTexture(GL_TEXTURE_2D, current_texture);
-        check_gl_error("bind current texture");
     } else {
-        SDL_Log("WARNING: No texture set for batch rendering!");
+        glBindTexture(GL_TEXTURE_2D, 0);
+        LOG_WARN(RENDER, "No texture set for batch rendering!");
     }
     
-    int triangle_count = current_quad_count * 6;
-    
-    glUseProgram(main_program); // Re-bind program right before draw call
-    glDrawElements(GL_TRIANGLES, triangle_count, GL_UNSIGNED_INT, 0);
+    // Shared index pattern (0..MAX_QUADS*4) offset into the ring by base vertex
+    glDrawElementsBaseVertex(GL_TRIANGLES, current_quad_count * 6, GL_UNSIGNED_INT, 0, base_vertex);
     glUseProgram(0); // Unbind program after draw call
     check_gl_error("draw elements");
     
@@ -803,16 +973,6 @@ void GPUAcceleratedRenderer::update_uniforms() {
         check_gl_error("uniform effect_params");
     }
     
-    if (u_explosion_center >= 0) {
-        glUniform4fv(u_explosion_center, 1, current_explosion_center);
-        check_gl_error("uniform explosion_center");
-    }
-    
-    if (u_explosion_size >= 0) {
-        glUniform4fv(u_explosion_size, 1, current_explosion_size);
-        check_gl_error("uniform explosion_size");
-    }
-    
     // SPECTACULAR effect uniforms
     if (u_explosion_data >= 0) {
         glUniform4fv(u_explosion_data, 1, explosion_data);
@@ -846,14 +1006,22 @@ void GPUAcceleratedRenderer::update_uniforms() {
 
 void GPUAcceleratedRenderer::add_sprite(float x, float y, float w, float h, GLuint texture, 
                                        const float* color, float rotation, const float* scale, int sprite_number) {
+    if (recording_snapshot) {
+        recording_snapshot->add_sprite(x, y, w, h, texture, color, rotation, scale, sprite_number);
+        return;
+    }
     add_animated_sprite(x, y, w, h, texture, color, rotation, scale, current_effect, sprite_number);
 }
 
 void GPUAcceleratedRenderer::add_animated_sprite(float x, float y, float w, float h, GLuint texture,
                                                const float* color, float rotation, const float* scale, EffectType effect, int sprite_number) {
+    if (recording_snapshot) {
+        recording_snapshot->add_animated_sprite(x, y, w, h, texture, color, rotation, scale, effect, sprite_number);
+        return;
+    }
     // Safety check: prevent crash if critical objects not initialized
     if (!gl_context || !main_program || !sprite_vao || !sprite_vbo) {
-        SDL_Log("GPU Renderer: Not ready, skipping sprite");
+        LOG_TRACE(RENDER, "GPU Renderer: Not ready, skipping sprite");
         return;
     }
     
@@ -870,6 +1038,39 @@ void GPUAcceleratedRenderer::add_animated_sprite(float x, float y, float w, floa
     }
     current_texture = texture;
 
+    // Calculate dynamic UV coordinates from sprite atlas
+    float u_start, u_end, v_start, v_end;
+    calculate_sprite_uv(texture, sprite_number, u_start, u_end, v_start, v_end);
+    
+    push_quad_vertices(x, y, w, h, u_start, v_start, u_end, v_end, color, rotation, scale, effect);
+    current_quad_count++;
+    flush_batch();
+}
+
+void GPUAcceleratedRenderer::add_textured_quad(float x, float y, float w, float h, GLuint texture,
+                                               float u0, float v0, float u1, float v1, const float* color) {
+    if (recording_snapshot || !is_ready()) {
+        return;
+    }
+    if (current_quad_count >= MAX_QUADS) {
+        flush_batch();
+    }
+    if (current_effect != NORMAL) {
+        flush_batch();
+        current_effect = NORMAL;
+    }
+    if (current_texture != 0 && current_texture != texture) {
+        flush_batch();
+    }
+    current_texture = texture;
+    
+    push_quad_vertices(x, y, w, h, u0, v0, u1, v1, color, 0.0f, nullptr, NORMAL);
+    current_quad_count++;
+    // Left pending: end_batch() or the next texture change draws the whole run at once
+}
+
+void GPUAcceleratedRenderer::push_quad_vertices(float x, float y, float w, float h, float u0, float v0, float u1, float v1,
+                                                const float* color, float rotation, const float* scale, EffectType effect) {
     // Simplified safe approach - create basic vertex structure using stack allocation
     // All rotations and effects handled entirely on GPU as requested
     
@@ -887,15 +1088,11 @@ void GPUAcceleratedRenderer::add_animated_sprite(float x, float y, float w, floa
         x,     y + h  // bottom-left
     };
     
-    // Calculate dynamic UV coordinates from sprite atlas
-    float u_start, u_end, v_start, v_end;
-    calculate_sprite_uv(texture, sprite_number, u_start, u_end, v_start, v_end);
-    
     float texcoords[8] = {
-        u_start, v_start,  // top-left
-        u_end,   v_start,  // top-right
-        u_end,   v_end,    // bottom-right
-        u_start, v_end     // bottom-left
+        u0, v0,  // top-left
+        u1, v0,  // top-right
+        u1, v1,  // bottom-right
+        u0, v1   // bottom-left
     };
     
     // Create 4 advanced vertices with EXPLICIT memory initialization
@@ -925,18 +1122,20 @@ void GPUAcceleratedRenderer::add_animated_sprite(float x, float y, float w, floa
         // Add to batch
         batch_vertices.push_back(vertex);
     }
-
-    current_quad_count++;
-    flush_batch();
 }
 
 void GPUAcceleratedRenderer::end_batch() {
+    if (recording_snapshot) {
+        recording_snapshot->end_batch();
+        return;
+    }
     flush_batch();
 }
 
 void GPUAcceleratedRenderer::update_particles_gpu(float deltaTime) {
     if (!particle_compute_program || !particle_ssbo) return;
     
+    GpuPassScope gpu_pass(this, GPU_PASS_PARTICLE_COMPUTE);
     glUseProgram(particle_compute_program);
     
     // Set SPECTACULAR compute uniforms
@@ -996,6 +1195,10 @@ void GPUAcceleratedRenderer::update_particles_gpu(float deltaTime) {
 
 void GPUAcceleratedRenderer::emit_particles(float x, float y, int count, ParticleType type, 
                                           const float* velocity, float life) {
+    if (recording_snapshot) {
+        recording_snapshot->emit_particles(x, y, count, type, velocity, life);
+        return;
+    }
     // Map buffer and find inactive particles
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, particle_ssbo);
     GPUParticle* particles = (GPUParticle*)glMapBuffer(GL_SHADER_STORAGE_BUFFER, GL_READ_WRITE);
@@ -1087,6 +1290,13 @@ void GPUAcceleratedRenderer::render_particles() {
 }
 
 void GPUAcceleratedRenderer::set_camera(const float* position, float zoom) {
+    if (recording_snapshot) {
+        recording_snapshot->set_camera(position, zoom);
+        return;
+    }
+    // Quads already batched were laid out for the previous view
+    flush_batch();
+    
     if (position) {
         camera_position[0] = position[0];
         camera_position[1] = position[1];
@@ -1099,6 +1309,22 @@ void GPUAcceleratedRenderer::set_camera(const float* position, float zoom) {
     glm_scale_uni(view_matrix, camera_zoom);
 }
 
+void GPUAcceleratedRenderer::begin_offscreen(int target_width, int target_height, float logical_width, float logical_height) {
+    flush_batch();
+    glm_mat4_copy(projection_matrix, saved_projection_matrix);
+    glm_mat4_copy(view_matrix, saved_view_matrix);
+    glm_ortho(0.0f, logical_width, logical_height, 0.0f, -1000.0f, 1000.0f, projection_matrix);
+    glm_mat4_identity(view_matrix);
+    glViewport(0, 0, target_width, target_height);
+}
+
+void GPUAcceleratedRenderer::end_offscreen() {
+    flush_batch();
+    glm_mat4_copy(saved_projection_matrix, projection_matrix);
+    glm_mat4_copy(saved_view_matrix, view_matrix);
+    glViewport(0, 0, screen_width, screen_height);
+}
+
 void GPUAcceleratedRenderer::set_global_effect_params(const float* params) {
     if (params) {
         memcpy(global_effect_params, params, 4 * sizeof(float));
@@ -1124,13 +1350,127 @@ GLuint GPUAcceleratedRenderer::create_texture_from_surface(SDL_Surface* surface)
     return texture;
 }
 
+void GPUAcceleratedRenderer::setup_gpu_timers() {
+    gpu_timer_supported = false;
+    if (!GLAD_GL_VERSION_3_3 && !GLAD_GL_ARB_timer_query) {
+        LOG_INFO(RENDER, "GPU Renderer: Timer queries not available, GPU timing disabled");
+        return;
+    }
+    
+    // Some drivers expose the entry points with a 0-bit counter
+    GLint counter_bits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counter_bits);
+    if (counter_bits == 0) {
+        LOG_INFO(RENDER, "GPU Renderer: GL_TIMESTAMP has no counter bits, GPU timing disabled");
+        return;
+    }
+    
+    for (auto& frame : gpu_timer_frames) {
+        glGenQueries(GPU_TIMER_MAX_MARKS, frame.queries);
+        frame.mark_count = 0;
+        frame.pending = false;
+    }
+    gpu_timer_slot = 0;
+    gpu_timer_supported = true;
+    check_gl_error("setup gpu timers");
+    
+    LOG_INFO(RENDER, "GPU Renderer: Timer query ring %d frames x %d marks (%d-bit timestamps)",
+            GPU_TIMER_FRAMES, GPU_TIMER_MAX_MARKS, counter_bits);
+}
+
+void GPUAcceleratedRenderer::record_gpu_mark(GpuPass pass) {
+    GpuTimerFrame& frame = gpu_timer_frames[gpu_timer_slot];
+    // Keep the last slot for the end-of-frame mark; extra switches merge into the current pass
+    int limit = pass == GPU_PASS_COUNT ? GPU_TIMER_MAX_MARKS : GPU_TIMER_MAX_MARKS - 1;
+    if (frame.mark_count >= limit) {
+        return;
+    }
+    glQueryCounter(frame.queries[frame.mark_count], GL_TIMESTAMP);
+    frame.mark_pass[frame.mark_count] = pass;
+    frame.mark_count++;
+}
+
+bool GPUAcceleratedRenderer::resolve_gpu_timer_frame(GpuTimerFrame& frame) {
+    if (frame.mark_count < 2) {
+        return true;
+    }
+    
+    // Timestamps complete in submission order: the last one being ready means all are
+    GLint available = 0;
+    glGetQueryObjectiv(frame.queries[frame.mark_count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return false;
+    }
+    
+    GLuint64 timestamps[GPU_TIMER_MAX_MARKS];
+    for (int i = 0; i < frame.mark_count; i++) {
+        glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+    
+    GpuFrameTimings result;
+    memset(&result, 0, sizeof(result));
+    for (int i = 0; i + 1 < frame.mark_count; i++) {
+        if (frame.mark_pass[i] != GPU_PASS_COUNT && timestamps[i + 1] >= timestamps[i]) {
+            result.pass_ms[frame.mark_pass[i]] += (timestamps[i + 1] - timestamps[i]) / 1000000.0f;
+        }
+    }
+    result.frame_ms = (timestamps[frame.mark_count - 1] - timestamps[0]) / 1000000.0f;
+    result.valid = true;
+    
+    gpu_timings = result;
+    perf_stats.gpu_time = result.frame_ms;
+    return true;
+}
+
+GPUAcceleratedRenderer::GpuPass GPUAcceleratedRenderer::set_gpu_pass(GpuPass pass) {
+    if (recording_snapshot) {
+        return static_cast<GpuPass>(recording_snapshot->set_gpu_pass(pass));
+    }
+    GpuPass previous = current_gpu_pass;
+    if (pass == current_gpu_pass) {
+        return previous;
+    }
+    
+    // Pending sprites belong to the pass that queued them
+    if (current_quad_count > 0) {
+        flush_batch();
+    }
+    current_gpu_pass = pass;
+    if (gpu_timer_in_frame) {
+        record_gpu_mark(pass);
+    }
+    return previous;
+}
+
+const char* GPUAcceleratedRenderer::gpu_pass_name(GpuPass pass) {
+    switch (pass) {
+        case GPU_PASS_SPRITES:          return "sprites";
+        case GPU_PASS_PARTICLE_COMPUTE: return "particle_compute";
+        case GPU_PASS_PARTICLES:        return "particles";
+        case GPU_PASS_EXPLOSIONS:       return "explosions";
+        case GPU_PASS_TEXT:             return "text";
+        case GPU_PASS_COUNT:            break;
+    }
+    return "?";
+}
+
 void GPUAcceleratedRenderer::print_performance_stats() {
-    SDL_Log("=== GPU Renderer Performance Stats ===");
-    SDL_Log("Draw calls: %d", perf_stats.draw_calls);
-    SDL_Log("Particles rendered: %d", perf_stats.particles_rendered);
-    SDL_Log("Vertices rendered: %d", perf_stats.vertices_rendered);
-    SDL_Log("GPU time: %.2f ms", perf_stats.gpu_time);
-    SDL_Log("CPU time: %.2f ms", perf_stats.cpu_time);
+    LOG_INFO(RENDER, "=== GPU Renderer Performance Stats ===");
+    LOG_INFO(RENDER, "Draw calls: %d", perf_stats.draw_calls);
+    LOG_INFO(RENDER, "Particles rendered: %d", perf_stats.particles_rendered);
+    LOG_INFO(RENDER, "Vertices rendered: %d", perf_stats.vertices_rendered);
+    LOG_INFO(RENDER, "Vertex ring: %s, stalls this frame: %d", stream_persistent ? "persistent" : "orphaning",
+            perf_stats.stream_stalls);
+    if (gpu_timings.valid) {
+        LOG_INFO(RENDER, "GPU time: %.2f ms (%d frames late, %d unread)", perf_stats.gpu_time,
+                GPU_TIMER_FRAMES - 1, perf_stats.gpu_timer_misses);
+        for (int i = 0; i < GPU_PASS_COUNT; i++) {
+            LOG_INFO(RENDER, "  %-16s %.3f ms", gpu_pass_name((GpuPass)i), gpu_timings.pass_ms[i]);
+        }
+    } else {
+        LOG_INFO(RENDER, "GPU time: %s", gpu_timer_supported ? "pending" : "timer queries unsupported");
+    }
+    LOG_INFO(RENDER, "CPU time: %.2f ms", perf_stats.cpu_time);
 }
 
 void GPUAcceleratedRenderer::register_texture_metadata(GLuint texture_id, int width, int height, int sprite_width, int sprite_height) {
@@ -1181,6 +1521,10 @@ void GPUAcceleratedRenderer::calculate_sprite_uv(GLuint texture, int sprite_numb
 // SPECTACULAR EFFECT CONTROL METHODS
 
 void GPUAcceleratedRenderer::set_explosion_effect(float center_x, float center_y, float radius, float strength) {
+    if (recording_snapshot) {
+        recording_snapshot->set_explosion_effect(center_x, center_y, radius, strength);
+        return;
+    }
     explosion_data[0] = center_x;
     explosion_data[1] = center_y;
     explosion_data[2] = radius;
@@ -1211,25 +1555,80 @@ void GPUAcceleratedRenderer::clear_effects() {
     air_density = 1.0f;
     glm_vec2_zero(magnetic_field);
     
-    SDL_Log("GPU Renderer: All spectacular effects cleared");
+    LOG_INFO(RENDER, "GPU Renderer: All spectacular effects cleared");
 }
 
-void GPUAcceleratedRenderer::set_explosion_info(float center_x, float center_y, float age, int up, int down, int left, int right) {
-    current_explosion_center[0] = center_x;
-    current_explosion_center[1] = center_y;
-    current_explosion_center[2] = age;
-    current_explosion_center[3] = 1.0f; // active
-    
-    current_explosion_size[0] = (float)up;
-    current_explosion_size[1] = (float)down;
-    current_explosion_size[2] = (float)left;
-    current_explosion_size[3] = (float)right;
-    
-    SDL_Log("DEBUG: Set explosion info - center:(%.1f,%.1f) age:%.3f active:1.0 size:(%d,%d,%d,%d)", 
-            center_x, center_y, age, up, down, left, right);
+void GPUAcceleratedRenderer::queue_explosion(float center_x, float center_y, float age, int up, int down, int left, int right) {
+    if (recording_snapshot) {
+        recording_snapshot->queue_explosion(center_x, center_y, age, up, down, left, right);
+        return;
+    }
+    if (explosion_instances.size() >= MAX_EXPLOSION_INSTANCES) {
+        return;
+    }
+    
+    ExplosionInstance instance;
+    instance.center_age[0] = center_x;
+    instance.center_age[1] = center_y;
+    instance.center_age[2] = age;
+    instance.center_age[3] = 0.0f;
+    instance.arms[0] = (float)up;
+    instance.arms[1] = (float)down;
+    instance.arms[2] = (float)left;
+    instance.arms[3] = (float)right;
+    explosion_instances.push_back(instance);
 }
 
-void GPUAcceleratedRenderer::clear_explosion_info() {
-    glm_vec4_zero(current_explosion_center);
-    glm_vec4_zero(current_explosion_size);
-}
\ No newline at end of file
+void GPUAcceleratedRenderer::render_explosions() {
+    if (recording_snapshot) {
+        recording_snapshot->render_explosions();
+        return;
+    }
+    if (explosion_instances.empty()) {
+        return;
+    }
+    
+    if (!explosion_program || !explosion_vao || !explosion_instance_vbo) {
+        explosion_instances.clear();
+        return;
+    }
+    
+    PROFILE_ZONE("GPU::render_explosions");
+    
+    // Keep painter's order: sprites queued before the explosions go first
+    // (switching pass flushes the pending batch)
+    GpuPassScope gpu_pass(this, GPU_PASS_EXPLOSIONS);
+    if (current_quad_count > 0) {
+        flush_batch();
+    }
+    
+    glBindVertexArray(explosion_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, explosion_instance_vbo);
+    
+    // Orphan + upload: no stall on the previous frame's instance data
+    size_t data_size = explosion_instances.size() * sizeof(ExplosionInstance);
+    glBufferData(GL_ARRAY_BUFFER, MAX_EXPLOSION_INSTANCES * sizeof(ExplosionInstance), nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, data_size, explosion_instances.data());
+    
+    glUseProgram(explosion_program);
+    if (u_explosion_projection >= 0) {
+        glUniformMatrix4fv(u_explosion_projection, 1, GL_FALSE, (float*)projection_matrix);
+    }
+    if (u_explosion_view >= 0) {
+        glUniformMatrix4fv(u_explosion_view, 1, GL_FALSE, (float*)view_matrix);
+    }
+    if (u_explosion_time >= 0) {
+        float time_data[4] = {current_time, sinf(current_time), cosf(current_time), current_time * 2.0f};
+        glUniform4fv(u_explosion_time, 1, time_data);
+    }
+    
+    glDrawArraysInstanced(GL_TRIANGLES, 0, EXPLOSION_VERTICES_PER_INSTANCE, (GLsizei)explosion_instances.size());
+    glUseProgram(0);
+    glBindVertexArray(0);
+    check_gl_error("draw explosions instanced");
+    
+    perf_stats.draw_calls++;
+    perf_stats.vertices_rendered += (int)explosion_instances.size() * EXPLOSION_VERTICES_PER_INSTANCE;
+    
+    explosion_instances.clear();
+}
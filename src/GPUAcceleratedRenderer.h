@@ -10,6 +10,7 @@
 
 // Forward declarations
 template<typename T> class GameResult;
+class RenderSnapshot;
 
 // Modern OpenGL 4.6 renderer with advanced features
 class GPUAcceleratedRenderer {
@@ -64,6 +65,40 @@ public:
         BLOOD = 2,
         FIRE = 3
     };
+    
+    // Pases medidos con timer queries; todo lo que no declara pase cuenta como SPRITES
+    enum GpuPass {
+        GPU_PASS_SPRITES = 0,
+        GPU_PASS_PARTICLE_COMPUTE,
+        GPU_PASS_PARTICLES,
+        GPU_PASS_EXPLOSIONS,
+        GPU_PASS_TEXT,
+        GPU_PASS_COUNT
+    };
+    
+    struct GpuFrameTimings {
+        float frame_ms;                  // Primer a último timestamp del frame
+        float pass_ms[GPU_PASS_COUNT];
+        bool valid;                      // false hasta la primera lectura (o sin soporte)
+    };
+    
+    /**
+     * @brief Atribuye el trabajo GPU siguiente a un pase (RAII)
+     * Restaura el pase anterior al salir del scope.
+     */
+    class GpuPassScope {
+    public:
+        GpuPassScope(GPUAcceleratedRenderer* renderer, GpuPass pass)
+            : owner(renderer), previous(renderer ? renderer->set_gpu_pass(pass) : GPU_PASS_SPRITES) {}
+        ~GpuPassScope() { if (owner) owner->set_gpu_pass(previous); }
+        
+        GpuPassScope(const GpuPassScope&) = delete;
+        GpuPassScope& operator=(const GpuPassScope&) = delete;
+        
+    private:
+        GPUAcceleratedRenderer* owner;
+        GpuPass previous;
+    };
 
 public:
     GPUAcceleratedRenderer();
@@ -92,9 +127,19 @@ public:
                            const float* color, float rotation, const float* scale, EffectType effect, int sprite_number = 0);
     void end_batch();
     
-    // Explosion control
-    void set_explosion_info(float center_x, float center_y, float age, int up, int down, int left, int right);
-    void clear_explosion_info();
+    /**
+     * @brief Quad con UV explícitas (glifos del atlas de texto)
+     * A diferencia de add_sprite no vacía el batch en cada quad: una cadena
+     * entera sale en un draw call. No se graba en RenderSnapshot; el texto
+     * se graba antes, en RenderingFacade::render_text.
+     */
+    void add_textured_quad(float x, float y, float w, float h, GLuint texture,
+                           float u0, float v0, float u1, float v1, const float* color = nullptr);
+    
+    // Instanced explosions: one record per explosion, all drawn in a single instanced call
+    void queue_explosion(float center_x, float center_y, float age, int up, int down, int left, int right);
+    void render_explosions();
+    size_t get_queued_explosion_count() const { return explosion_instances.size(); }
     
     // GPU particle system
     bool init_particle_system(int max_particles = 100000);
@@ -104,7 +149,21 @@ public:
     void render_particles();
     
     // SPECTACULAR effect controls
+    /**
+     * @brief Desplaza la vista del mundo: lo dibujado después se ve desde `position`
+     * Vacía el batch pendiente (se dibujó con la vista anterior). Se graba en el snapshot.
+     */
     void set_camera(const float* position, float zoom = 1.0f);
+    const float* get_camera_position() const { return camera_position; }
+    float get_camera_zoom() const { return camera_zoom; }
+    
+    /**
+     * @brief Dibuja en el FBO ya enlazado, de target_width x target_height texels,
+     * que cubre logical_width x logical_height unidades del mundo, sin cámara
+     * end_offscreen() restaura proyección, vista y viewport. Solo hilo GL.
+     */
+    void begin_offscreen(int target_width, int target_height, float logical_width, float logical_height);
+    void end_offscreen();
     void set_explosion_effect(float center_x, float center_y, float radius, float strength);
     void set_vortex_effect(float center_x, float center_y, float radius, float strength);
     void set_environmental_effects(float air_density, const float* magnetic_field);
@@ -119,6 +178,34 @@ public:
     // Debug and profiling
     void enable_debug_overlay(bool enable) { debug_overlay = enable; }
     void print_performance_stats();
+    float get_cpu_frame_time_ms() const { return perf_stats.cpu_time; }
+    int get_frame_draw_calls() const { return perf_stats.draw_calls; }      // Se reinician en begin_frame()
+    int get_frame_vertices() const { return perf_stats.vertices_rendered; }
+    
+    /**
+     * @brief Cambia el pase al que se atribuye el trabajo GPU
+     * Vacía el batch pendiente para que cada draw call caiga en su pase.
+     * @return El pase activo hasta ahora
+     */
+    GpuPass set_gpu_pass(GpuPass pass);
+    
+    // Tiempos GPU de un frame completado hace GPU_TIMER_FRAMES - 1 frames
+    const GpuFrameTimings& get_gpu_timings() const { return gpu_timings; }
+    bool is_gpu_timing_supported() const { return gpu_timer_supported; }
+    static const char* gpu_pass_name(GpuPass pass);
+    
+    int get_screen_width() const { return screen_width; }
+    int get_screen_height() const { return screen_height; }
+    
+    bool is_vertex_stream_persistent() const { return stream_persistent; }
+    
+    /**
+     * @brief Graba en `snapshot` las llamadas de dibujo de ESTE hilo en vez de ejecutarlas
+     * Lo usa el hilo de simulación cuando el render va en su propio hilo (RenderThread).
+     * nullptr vuelve a la ejecución directa. El estado es por hilo (thread_local).
+     */
+    static void set_recording(RenderSnapshot* snapshot);
+    static RenderSnapshot* get_recording();
     
     // Safety checks
     bool is_ready() const { return gl_context && main_program && sprite_vao && sprite_vbo; }
@@ -148,13 +235,14 @@ private:
     mat4 projection_matrix;
     mat4 view_matrix;
     mat4 model_matrix;
+    mat4 saved_projection_matrix;   // Mientras dura begin_offscreen()
+    mat4 saved_view_matrix;
     
     // Uniform locations
     // Rendering uniforms
     GLint u_projection, u_view, u_model, u_time;
     GLint u_effect_type, u_effect_params;
     GLint u_texture, u_resolution;
-    GLint u_explosion_center, u_explosion_size;
     
     // SPECTACULAR effect uniforms
     GLint u_explosion_data;      // x,y=center, z=radius, w=strength
@@ -176,6 +264,42 @@ private:
     GLuint current_texture;  // Track current texture to flush on change
     static const int MAX_QUADS = 1000;  // Reasonable batch size
     
+    // Streaming sprite VBO: ring of STREAM_REGIONS regions, each holding one full batch.
+    // GL 4.4+ (ARB_buffer_storage): persistently mapped, a fence per region gates reuse.
+    // GL 3.3: same ring, filled with glBufferSubData and orphaned on wrap-around.
+    static const int STREAM_REGIONS = 3;
+    AdvancedVertex* stream_mapped;   // nullptr en modo orphaning
+    GLsync stream_fences[STREAM_REGIONS];
+    int stream_region;               // Región en la que se escribe ahora
+    int stream_cursor;               // Siguiente vértice libre dentro de la región
+    bool stream_persistent;
+    
+    void setup_vertex_stream();
+    GLint upload_batch_vertices();   // Devuelve el base vertex del batch o -1
+    void advance_stream_region();
+    
+    // GPU timing: una marca GL_TIMESTAMP en cada cambio de pase. Los resultados se
+    // leen al reutilizar el slot del ring, GPU_TIMER_FRAMES - 1 frames después,
+    // y solo si ya están disponibles: nunca se espera a la GPU.
+    static const int GPU_TIMER_FRAMES = 4;
+    static const int GPU_TIMER_MAX_MARKS = 64;   // Marcas por frame (incluida la final)
+    struct GpuTimerFrame {
+        GLuint queries[GPU_TIMER_MAX_MARKS];
+        GpuPass mark_pass[GPU_TIMER_MAX_MARKS];  // Pase que empieza en cada marca
+        int mark_count;
+        bool pending;
+    };
+    GpuTimerFrame gpu_timer_frames[GPU_TIMER_FRAMES];
+    int gpu_timer_slot;
+    bool gpu_timer_supported;
+    bool gpu_timer_in_frame;
+    GpuPass current_gpu_pass;
+    GpuFrameTimings gpu_timings;
+    
+    void setup_gpu_timers();
+    void record_gpu_mark(GpuPass pass);
+    bool resolve_gpu_timer_frame(GpuTimerFrame& frame);
+    
     // Particle system
     int max_gpu_particles;
     std::vector<GPUParticle> cpu_particles; // For initialization
@@ -186,9 +310,21 @@ private:
     vec2 camera_position;
     float camera_zoom;
     
-    // Explosion state
-    vec4 current_explosion_center; // x,y=center, z=age, w=active
-    vec4 current_explosion_size;   // x=up, y=down, z=left, w=right
+    // Instanced explosion renderer
+    struct ExplosionInstance {
+        float center_age[4]; // x,y=center, z=age, w=unused
+        float arms[4];       // x=up, y=down, z=left, w=right (tiles)
+    };
+    static const int MAX_EXPLOSION_INSTANCES = 256;
+    static const int EXPLOSION_VERTICES_PER_INSTANCE = 18; // 3 quads: horizontal beam + up/down arms
+    std::vector<ExplosionInstance> explosion_instances;
+    GLuint explosion_program;
+    GLuint explosion_vao, explosion_instance_vbo;
+    GLint u_explosion_projection, u_explosion_view, u_explosion_time;
+    
+    bool load_explosion_shaders();
+    void setup_explosion_rendering();
+    
     vec4 global_effect_params;
     vec2 gravity_force;
     vec2 wind_force;
@@ -207,9 +343,12 @@ private:
         int draw_calls;
         int particles_rendered;
         int vertices_rendered;
+        int stream_stalls;       // Fence waits on the vertex ring that actually blocked
+        int gpu_timer_misses;    // Frames whose timer results were not ready when recycled
         float gpu_time;
-        float cpu_time;
+        float cpu_time;          // begin_frame -> end_frame on the CPU (ms)
     } perf_stats;
+    Uint64 frame_begin_counter;
     
     // Helper functions
     void setup_matrices();
@@ -217,6 +356,8 @@ private:
     void setup_particle_rendering();
     void update_uniforms();
     void flush_batch();
+    void push_quad_vertices(float x, float y, float w, float h, float u0, float v0, float u1, float v1,
+                            const float* color, float rotation, const float* scale, EffectType effect);
     void check_gl_error(const std::string& operation);
     void calculate_sprite_uv(GLuint texture, int sprite_number, float& u_start, float& u_end, float& v_start, float& v_end);
     std::string preprocess_shader_includes(const std::string& source);
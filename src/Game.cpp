@@ -1,4 +1,5 @@
 #include "Game.h"
+#include "Logger.h"
 #include "Resources.h"
 #include "Timer.h"
 #include "MainMenuScreen.h"
@@ -10,10 +11,23 @@
 #include "RenderingFacade.h"
 #include "GameContext.h"
 #include "Controller_Joystick.h"
+#include "Profiler.h"
+#include "AllocTracker.h"
+#include "FramePacer.h"
+#include "RenderThread.h"
+#include "Replay.h"
+#include "InputLatency.h"
+#include "ParticleEffectsManager.h"
+#include "AudioMixer.h"
+#include <algorithm>
+#include <cstdlib>
 
-Game::Game() {
+// Upload time per loading-screen frame; decoding continues on the pool meanwhile
+static constexpr double LOADING_UPLOAD_BUDGET_MS = 8.0;
+
+Game::Game() : render_thread(nullptr), low_latency(false) {
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
-        SDL_Log("Unable to initialize SDL: %s", SDL_GetError());
+        LOG_ERROR(CORE, "Unable to initialize SDL: %s", SDL_GetError());
         exit(1);
     }
 
@@ -31,7 +45,7 @@ Game::Game() {
     window = SDL_CreateWindow("ClanBomber Modern", 800, 600, 
                              SDL_WINDOW_RESIZABLE | SDL_WINDOW_OPENGL);
     if (!window) {
-        SDL_Log("Unable to create window: %s", SDL_GetError());
+        LOG_ERROR(CORE, "Unable to create window: %s", SDL_GetError());
         SDL_Quit();
         exit(1);
     }
@@ -47,15 +61,15 @@ Game::Game() {
     // Initialize TextRenderer for hybrid SDL3_ttf + OpenGL text rendering
     app.text_renderer = new TextRenderer();
     if (!app.text_renderer->initialize()) {
-        SDL_Log("Failed to initialize TextRenderer, text will not be available");
+        LOG_WARN(CORE, "Failed to initialize TextRenderer, text will not be available");
         delete app.text_renderer;
         app.text_renderer = nullptr;
     } else {
-        SDL_Log("TextRenderer initialized successfully");
+        LOG_INFO(CORE, "TextRenderer initialized successfully");
     }
 
     // REMOVED: Legacy GPU renderer - now RenderingFacade handles all rendering
-    SDL_Log("Legacy GPU renderer removed - RenderingFacade will handle all rendering");
+    LOG_INFO(CORE, "Legacy GPU renderer removed - RenderingFacade will handle all rendering");
     
     // Initialize GameContext now that systems are ready
     app.initialize_game_context();
@@ -65,16 +79,22 @@ Game::Game() {
         RenderingFacade* facade = app.game_context->get_rendering_facade();
         auto init_result = facade->initialize(window, 800, 600);
         if (init_result.is_ok()) {
-            SDL_Log("Game::Game() - RenderingFacade initialized successfully");
+            LOG_INFO(CORE, "Game::Game() - RenderingFacade initialized successfully");
         } else {
-            SDL_Log("Game::Game() - Failed to initialize RenderingFacade: %s (%s)", 
+            LOG_WARN(CORE, "Game::Game() - Failed to initialize RenderingFacade: %s (%s)", 
                 init_result.get_error_message().c_str(),
                 init_result.get_error_context().c_str());
         }
     }
     
     // CRITICAL: Initialize Resources AFTER OpenGL context is ready
-    Resources::init();  // Now OpenGL context exists
+    // PNG/WAV decoding runs on a thread pool; this thread only uploads, a few ms per frame
+    Resources::begin_loading([this](int loaded, int total, const std::string&) {
+        draw_loading_screen(total > 0 ? (float)loaded / total : 1.0f);
+    });
+    while (!Resources::pump_loading(LOADING_UPLOAD_BUDGET_MS)) {
+        SDL_PumpEvents(); // Keep the window responsive
+    }
     
     // CRITICAL: Register texture metadata for sprite atlases
     if (app.game_context && app.game_context->get_rendering_facade()) {
@@ -93,13 +113,13 @@ Game::Game() {
             Resources::register_gl_texture_metadata("bombs", gpu_renderer);
             Resources::register_gl_texture_metadata("explosion", gpu_renderer);
             Resources::register_gl_texture_metadata("extras", gpu_renderer);
-            SDL_Log("Texture metadata registered for sprite atlases");
+            LOG_INFO(CORE, "Texture metadata registered for sprite atlases");
         } else {
-            SDL_Log("WARNING: No GPU renderer available for texture metadata registration");
+            LOG_WARN(CORE, "No GPU renderer available for texture metadata registration");
         }
     }
     
-    SDL_Log("All rendering systems operational!");
+    LOG_INFO(CORE, "All rendering systems operational!");
     
     // Load fonts for TextRenderer
     if (app.text_renderer) {
@@ -108,19 +128,19 @@ Game::Game() {
         
         // Try to load DejaVu Sans font (common on Linux systems)
         if (app.text_renderer->load_font("big", base_path + "data/fonts/DejaVuSans-Bold.ttf", 28)) {
-            SDL_Log("Loaded big font successfully");
+            LOG_INFO(CORE, "Loaded big font successfully");
         } else {
-            SDL_Log("Failed to load big font, trying fallback...");
+            LOG_WARN(CORE, "Failed to load big font, trying fallback...");
             // Fallback to system font if available
             if (app.text_renderer->load_font("big", "/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf", 28)) {
-                SDL_Log("Loaded big font from system path");
+                LOG_INFO(CORE, "Loaded big font from system path");
             } else {
-                SDL_Log("WARNING: No fonts available - text rendering will not work");
+                LOG_WARN(CORE, "No fonts available - text rendering will not work");
             }
         }
         
         if (app.text_renderer->load_font("small", base_path + "data/fonts/DejaVuSans-Bold.ttf", 18)) {
-            SDL_Log("Loaded small font successfully");
+            LOG_INFO(CORE, "Loaded small font successfully");
         }
     }
 
@@ -135,9 +155,42 @@ Game::Game() {
     current_screen = new MainMenuScreen(app.text_renderer, app.game_context);
 }
 
+void Game::draw_loading_screen(float progress) {
+    // Nothing else is ready yet (no textures, no fonts): a scissored clear is enough for a bar
+    int width = 0, height = 0;
+    SDL_GetWindowSizeInPixels(window, &width, &height);
+    int bar_width = width / 2;
+    int bar_height = height / 40 + 1;
+    int bar_x = (width - bar_width) / 2;
+    int bar_y = height / 2 - bar_height / 2;
+
+    glViewport(0, 0, width, height);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(bar_x, bar_y, bar_width, bar_height);
+    glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glScissor(bar_x, bar_y, (int)(bar_width * std::clamp(progress, 0.0f, 1.0f)), bar_height);
+    glClearColor(0.9f, 0.6f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+    SDL_GL_SwapWindow(window);
+}
+
 Game::~Game() {
+    if (render_thread) {
+        render_thread->stop();
+        delete render_thread;
+        render_thread = nullptr;
+    }
     delete current_screen;
     
+    // app outlives the window, so free its GL textures while the context is current
+    if (app.particle_effects) {
+        app.particle_effects->release_gl_resources();
+    }
+    
     // Cleanup TextRenderer
     if (app.text_renderer) {
         delete app.text_renderer;
@@ -151,27 +204,164 @@ Game::~Game() {
     SDL_Quit();
 }
 
+FramePacer::Config Game::make_pacer_config() {
+    FramePacer::Config config;
+
+    // CLANBOMBER_FPS_CAP=<fps> forces a cap (0 = uncapped). Otherwise only cap
+    // when vsync is not available, at the display refresh rate, so we never busy-spin
+    const char* cap = std::getenv("CLANBOMBER_FPS_CAP");
+    if (cap) {
+        config.max_fps = std::atoi(cap);
+        return config;
+    }
+
+    int interval = 0;
+    if (SDL_GL_GetSwapInterval(&interval) && interval != 0) {
+        config.max_fps = 0;
+        return config;
+    }
+
+    config.max_fps = get_display_refresh_hz();
+    return config;
+}
+
+int Game::get_display_refresh_hz() {
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(window));
+    return (mode && mode->refresh_rate > 0.0f) ? static_cast<int>(mode->refresh_rate + 0.5f) : 60;
+}
+
 void Game::run() {
+    PROFILE_THREAD_NAME("main");
+
+    FramePacer pacer(make_pacer_config());
+    LOG_INFO(CORE, "Frame pacing: %d Hz fixed-step simulation, fps cap %d (0 = none)",
+             pacer.get_simulation_hz(), pacer.get_max_fps());
+
+    // CLANBOMBER_RENDER_THREAD=1: GL lives on its own thread, this one records snapshots
+    const char* threaded = std::getenv("CLANBOMBER_RENDER_THREAD");
+    if (threaded && std::atoi(threaded) != 0) {
+        if (!start_render_thread()) {
+            LOG_WARN(CORE, "Render thread unavailable, rendering on the main thread");
+        } else if (pacer.get_max_fps() == 0 && !std::getenv("CLANBOMBER_FPS_CAP")) {
+            // Vsync now blocks the render thread, not this one, and publish() never waits
+            pacer.set_max_fps(get_display_refresh_hz());
+            LOG_INFO(CORE, "Frame pacing: render thread owns the swap, capping recording at %d fps",
+                     pacer.get_max_fps());
+        }
+    }
+
+    const char* low_latency_env = std::getenv("CLANBOMBER_LOW_LATENCY");
+    low_latency = low_latency_env && std::atoi(low_latency_env) != 0;
+    apply_latency_mode(pacer);
+    bool applied_low_latency = low_latency;
+
     while (running) {
-        Timer::tick();
-        handle_events();
-        update(Timer::time_elapsed());
-        render();
+        PROFILE_FRAME_BEGIN();
+        {
+            PROFILE_ZONE("Frame");
+            Timer::tick();
+            int steps = pacer.begin_frame();
+            handle_events();
+            if (low_latency != applied_low_latency) {
+                apply_latency_mode(pacer);  // F2 toggled it
+                applied_low_latency = low_latency;
+            }
+
+            // Input waits for the frame whose simulation consumes it
+            Uint64 input_ns = steps > 0 ? InputLatency::take_pending() : 0;
+
+            // Fixed-step simulation: same dt every step, whatever the frame rate
+            for (int i = 0; i < steps && running; i++) {
+                if (i > 0 && low_latency) {
+                    handle_events();  // Catch-up steps see input that arrived meanwhile
+                }
+                Timer::set_time_elapsed(pacer.get_step());
+                update(pacer.get_step());
+            }
+
+            Timer::set_interpolation_alpha(pacer.get_alpha());
+            if (render_thread) {
+                record_frame(input_ns);
+            } else {
+                render();
+                present(pacer, input_ns);
+            }
+        }
+        {
+            PROFILE_ZONE("FramePacer::wait");
+            pacer.end_frame();
+        }
+        PROFILE_FRAME_END();
+        ALLOC_FRAME_END();
+    }
+
+    if (render_thread) {
+        render_thread->stop();
+        delete render_thread;
+        render_thread = nullptr;
+    }
+}
+
+bool Game::start_render_thread() {
+    if (!app.game_context || !app.game_context->get_rendering_facade()) {
+        return false;
+    }
+    RenderingFacade* facade = app.game_context->get_rendering_facade();
+
+    // Everything that lazily creates GL objects from the simulation side must exist first
+    Resources::upload_all_gl_textures();
+    if (app.particle_effects) {
+        app.particle_effects->get_white_texture();
+    }
+
+    if (!render_thread) {
+        render_thread = new RenderThread();
+    }
+    if (!render_thread->start(window, SDL_GL_GetCurrentContext(), facade)) {
+        delete render_thread;
+        render_thread = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void Game::record_frame(Uint64 input_ns) {
+    PROFILE_ZONE("Game::record_frame");
+    ALLOC_SCOPE(ALLOC_TAG_RENDER);
+    render_thread->begin_snapshot()->note_input_timestamp(input_ns);
+    if (current_screen) {
+        current_screen->render(nullptr);  // Recorded, replayed by the render thread
     }
+    render_thread->publish();
 }
 
 void Game::handle_events() {
+    PROFILE_ZONE("Game::handle_events");
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+        InputLatency::note_event(event);
         if (event.type == SDL_EVENT_QUIT) {
             running = false;
         }
+        // F2: low-latency mode (late input sampling + just-in-time rendering)
+        if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_F2 && !event.key.repeat) {
+            low_latency = !low_latency;
+        }
+#if CLANBOMBER_PROFILER
+        // F11: dump the profiler rings (last few seconds) as a Chrome/Perfetto trace
+        if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_F11 && !event.key.repeat) {
+            Profiler::write_chrome_trace("clanbomber_trace.json");
+        }
+#endif
         current_screen->handle_events(event);
     }
     Controller_Keyboard::update_keyboard_state();
 }
 
 void Game::update(float deltaTime) {
+    PROFILE_ZONE("Game::update");
+    ALLOC_SCOPE(ALLOC_TAG_GAME);
+    AudioMixer::begin_tick();
     current_screen->update(deltaTime);
     
     if (dynamic_cast<MainMenuScreen*>(current_screen)) {
@@ -195,6 +385,8 @@ void Game::update(float deltaTime) {
 }
 
 void Game::render() {
+    PROFILE_ZONE("Game::render");
+    ALLOC_SCOPE(ALLOC_TAG_RENDER);
     // UNIFIED RENDERING: All rendering through RenderingFacade
     
     // Initialize and begin RenderingFacade frame
@@ -209,17 +401,43 @@ void Game::render() {
                 current_screen->render(nullptr);  // All rendering goes through RenderingFacade
             }
             
-            // End frame and present
+            // End frame; present() swaps
             facade->end_frame();
-            
-            // Present the frame via OpenGL context swap
-            SDL_GL_SwapWindow(window);
     } else {
-        SDL_Log("WARNING: No RenderingFacade available - cannot render");
+        LOG_WARN(CORE, "No RenderingFacade available - cannot render");
+    }
+}
+
+void Game::present(FramePacer& pacer, Uint64 input_ns) {
+    PROFILE_ZONE("SDL_GL_SwapWindow");
+    pacer.mark_submit();
+    SDL_GL_SwapWindow(window);
+    if (low_latency) {
+        // Block until the GPU is done so the driver can't queue frames ahead of the display
+        glFinish();
     }
+    pacer.mark_presented();
+    InputLatency::record_presented(input_ns, SDL_GetTicksNS());
+}
+
+void Game::apply_latency_mode(FramePacer& pacer) {
+    // Just-in-time rendering needs this thread to own the swap
+    bool jit = low_latency && !render_thread;
+    pacer.set_just_in_time(jit ? (pacer.get_max_fps() > 0 ? pacer.get_max_fps() : get_display_refresh_hz()) : 0);
+    InputLatency::set_low_latency_mode(low_latency);
+    InputLatency::reset();
+    LOG_INFO(CORE, "Low-latency mode %s%s", low_latency ? "on" : "off",
+             low_latency && render_thread ? " (no just-in-time rendering with the render thread)" : "");
 }
 
 void Game::change_screen(GameState next_state) {
+    // Snapshots in flight may reference the old screen's systems, and the new
+    // screen may create GL objects: take the context back while switching
+    bool restart_render_thread = render_thread && render_thread->is_running();
+    if (restart_render_thread) {
+        render_thread->stop();
+    }
+
     if (current_screen) {
         delete current_screen;
         current_screen = nullptr;
@@ -227,10 +445,22 @@ void Game::change_screen(GameState next_state) {
 
     // REMOVED: Legacy GPU renderer context management - handled by RenderingFacade
     // OpenGL context is now managed entirely by RenderingFacade
-    SDL_Log("Game::change_screen() - OpenGL context managed by RenderingFacade");
+    LOG_INFO(CORE, "Game::change_screen() - OpenGL context managed by RenderingFacade");
 
     if (next_state == GameState::GAMEPLAY) {
-        current_screen = new GameplayScreen(&app);
+        // CLANBOMBER_REPLAY=<file> plays a recorded match, CLANBOMBER_REPLAY_RECORD=<file> records one
+        std::shared_ptr<Replay> playback;
+        if (const char* replay_path = std::getenv("CLANBOMBER_REPLAY")) {
+            auto load_result = Replay::load(replay_path);
+            if (load_result.is_ok()) {
+                playback = load_result.get_value();
+            } else {
+                LOG_ERROR(CORE, "Cannot play replay: %s (%s)", load_result.get_error_message().c_str(),
+                          load_result.get_error_context().c_str());
+            }
+        }
+        const char* record_path = std::getenv("CLANBOMBER_REPLAY_RECORD");
+        current_screen = new GameplayScreen(&app, playback, record_path ? record_path : "");
     }
     else if (next_state == GameState::SETTINGS) {
         current_screen = new SettingsScreen(renderer);
@@ -242,4 +472,8 @@ void Game::change_screen(GameState next_state) {
         running = false;
         current_screen = nullptr;
     }
+
+    if (restart_render_thread && running && !start_render_thread()) {
+        LOG_WARN(CORE, "Render thread could not restart, rendering on the main thread");
+    }
 }
\ No newline at end of file
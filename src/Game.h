@@ -10,6 +10,9 @@
 #include "GameState.h"
 #include "Screen.h"
 #include "GPUAcceleratedRenderer.h"
+#include "FramePacer.h"
+
+class RenderThread;
 
 class Game {
 public:
@@ -22,7 +25,14 @@ private:
     void handle_events();
     void update(float deltaTime);
     void render();
-
+    void present(FramePacer& pacer, Uint64 input_ns);
+    FramePacer::Config make_pacer_config();
+    int get_display_refresh_hz();
+    void apply_latency_mode(FramePacer& pacer);
+    bool start_render_thread();
+    void record_frame(Uint64 input_ns);
+
+    void draw_loading_screen(float progress);
     void start_game();
     void change_screen(GameState next_state);
 
@@ -30,6 +40,8 @@ private:
     SDL_Renderer* renderer;
     bool running;
     Screen* current_screen;
+    RenderThread* render_thread;   // Solo con CLANBOMBER_RENDER_THREAD=1
+    bool low_latency;              // CLANBOMBER_LOW_LATENCY=1 o F2
 
     // Game-specific objects
     ClanBomberApplication app;
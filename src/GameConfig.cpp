@@ -17,6 +17,7 @@
  */
 
 #include <iostream>
+#include "Logger.h"
 
 #include <filesystem>
 #include <fstream>
@@ -563,9 +564,9 @@ void GameConfig::set_fullscreen(bool val)
 
 bool GameConfig::save(bool init)
 {
-	SDL_Log("GameConfig::save(init=%s)", init ? "true" : "false");
+	LOG_INFO(CORE, "GameConfig::save(init=%s)", init ? "true" : "false");
 	if (init) {
-		SDL_Log("GameConfig::save() - Initializing default bomber configuration");
+		LOG_INFO(CORE, "GameConfig::save() - Initializing default bomber configuration");
 		for (int i=0; i<8; i++) {
 			bomber[i].set_skin(i);
 		}
@@ -648,10 +649,10 @@ bool GameConfig::save(bool init)
 bool GameConfig::load()
 {
   std::ifstream configfile(path / filename);
-  SDL_Log("GameConfig::load() - Attempting to load config from: %s", (path / filename).c_str());
+  LOG_INFO(CORE, "GameConfig::load() - Attempting to load config from: %s", (path / filename).c_str());
 
   if (configfile.fail()) {
-    SDL_Log("GameConfig::load() - Config file not found, creating new config with default settings");
+    LOG_WARN(CORE, "GameConfig::load() - Config file not found, creating new config with default settings");
     configfile.close();
     save(true);
     return false;
@@ -716,11 +717,11 @@ bool GameConfig::load()
     bomber[i].set_team(version);
 
     configfile >> version;
-    SDL_Log("Bomber %d: setting controller=%d", i, version);
+    LOG_DEBUG(CORE, "Bomber %d: setting controller=%d", i, version);
     bomber[i].set_controller(version);
 
     configfile >> version;
-    SDL_Log("Bomber %d: setting enabled=%d", i, version);
+    LOG_DEBUG(CORE, "Bomber %d: setting enabled=%d", i, version);
     bomber[i].set_enabled(version != 0);
 
     configfile >> version;
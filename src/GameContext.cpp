@@ -1,4 +1,5 @@
 #include "GameContext.h"
+#include "Logger.h"
 #include "LifecycleManager.h"
 #include "TileManager.h"
 #include "ParticleEffectsManager.h"
@@ -33,18 +34,18 @@ GameContext::GameContext(LifecycleManager* lifecycle,
     
     // Initialize spatial grid for collision optimization
     spatial_grid = new SpatialGrid(TILE_SIZE); // TILE_SIZE pixels = tile size
-    SDL_Log("GameContext: Created SpatialGrid with %d-pixel cells", TILE_SIZE);
+    LOG_INFO(CORE, "GameContext: Created SpatialGrid with %d-pixel cells", TILE_SIZE);
     
     // ARCHITECTURE FIX: Set up LifecycleManager coordination
     if (lifecycle_manager) {
         lifecycle_manager->set_game_context(this);
-        SDL_Log("GameContext: Coordinated with LifecycleManager for proper cleanup");
+        LOG_DEBUG(CORE, "GameContext: Coordinated with LifecycleManager for proper cleanup");
     }
     
     // Initialize rendering facade if not provided
     if (!rendering_facade) {
         rendering_facade = new RenderingFacade();
-        SDL_Log("GameContext: Created default RenderingFacade");
+        LOG_INFO(CORE, "GameContext: Created default RenderingFacade");
         
         // TODO: Initialize RenderingFacade properly - needs SDL_Window reference
         // For now, we'll initialize it when needed in the render loop
@@ -54,11 +55,11 @@ GameContext::GameContext(LifecycleManager* lifecycle,
 GameContext::~GameContext() {
     delete spatial_grid;
     spatial_grid = nullptr;
-    SDL_Log("GameContext: Cleaned up SpatialGrid");
+    LOG_INFO(CORE, "GameContext: Cleaned up SpatialGrid");
     
     delete rendering_facade;
     rendering_facade = nullptr;
-    SDL_Log("GameContext: Cleaned up RenderingFacade");
+    LOG_INFO(CORE, "GameContext: Cleaned up RenderingFacade");
 }
 
 bool GameContext::is_position_blocked(int map_x, int map_y) const {
@@ -92,7 +93,7 @@ void GameContext::remove_from_spatial_systems(GameObject* obj) const {
     // COLLISION FIX: Remove from SpatialGrid when destroying objects
     if (spatial_grid && obj) {
         spatial_grid->remove_object(obj);
-        SDL_Log("GameContext: Removed object %p (type=%d) from SpatialGrid", obj, obj->get_type());
+        LOG_DEBUG(CORE, "GameContext: Removed object %p (type=%d) from SpatialGrid", obj, obj->get_type());
     }
 }
 
@@ -106,19 +107,19 @@ void GameContext::register_object(GameObject* obj) const {
     // COLLISION FIX: Also add to SpatialGrid for optimized collision detection
     if (spatial_grid && obj) {
         spatial_grid->add_object(obj);
-        SDL_Log("GameContext: Added object %p (type=%d) to SpatialGrid at (%d,%d)", 
+        LOG_DEBUG(CORE, "GameContext: Added object %p (type=%d) to SpatialGrid at (%d,%d)", 
                 obj, obj->get_type(), obj->get_x(), obj->get_y());
     }
 }
 
 void GameContext::set_object_lists(std::list<std::unique_ptr<GameObject>>* objects) {
     render_objects = objects;
-    SDL_Log("GameContext: Render objects list set to %p", render_objects);
+    LOG_DEBUG(CORE, "GameContext: Render objects list set to %p", render_objects);
 }
 
 void GameContext::set_map(Map* new_map) {
     map = new_map;
-    SDL_Log("GameContext: Map set to %p", map);
+    LOG_DEBUG(CORE, "GameContext: Map set to %p", map);
 }
 
 void GameContext::update_object_position_in_spatial_grid(GameObject* obj, float old_x, float old_y) const {
@@ -1,4 +1,5 @@
 #include "GameLogic.h"
+#include "Logger.h"
 #include "GameObject.h"
 #include "Bomb.h"
 #include "Explosion.h"
@@ -11,7 +12,7 @@
 GameLogic::GameLogic(GameContext* context) 
     : game_context(context), is_paused(false), frame_counter(0) {
     if (!game_context) {
-        SDL_Log("ERROR: GameLogic initialized with null GameContext");
+        LOG_ERROR(GAME, "GameLogic initialized with null GameContext");
     }
 }
 
@@ -47,7 +48,7 @@ void GameLogic::update_all_objects(float deltaTime) {
         try {
             obj->act(deltaTime);
         } catch (const std::exception& e) {
-            SDL_Log("ERROR: Exception in object update: %s", e.what());
+            LOG_ERROR(GAME, "Exception in object update: %s", e.what());
             // Mark object for deletion to prevent further errors
             obj->delete_me = true;
         }
@@ -76,7 +77,7 @@ void GameLogic::render_all_objects() {
         try {
             obj->show();
         } catch (const std::exception& e) {
-            SDL_Log("ERROR: Exception in object rendering: %s", e.what());
+            LOG_ERROR(GAME, "Exception in object rendering: %s", e.what());
         }
     }
 }
@@ -116,12 +117,12 @@ size_t GameLogic::count_active_objects() const {
 void GameLogic::clear_all_objects() {
     if (!game_context || !game_context->get_lifecycle_manager()) return;
     
-    SDL_Log("GameLogic: Clearing all game objects");
+    LOG_INFO(GAME, "GameLogic: Clearing all game objects");
     game_context->get_lifecycle_manager()->clear_all();
 }
 
 void GameLogic::reset_game_state() {
-    SDL_Log("GameLogic: Resetting game state");
+    LOG_INFO(GAME, "GameLogic: Resetting game state");
     
     // Clear all objects
     clear_all_objects();
@@ -168,7 +169,7 @@ GameLogic::GameStats GameLogic::get_game_statistics() const {
 void GameLogic::log_frame_statistics() const {
     auto stats = get_game_statistics();
     
-    SDL_Log("GameLogic Stats - Frame: %llu, Objects: %zu (Bombers: %zu, Bombs: %zu, Explosions: %zu, Extras: %zu)",
+    LOG_DEBUG(GAME, "GameLogic Stats - Frame: %llu, Objects: %zu (Bombers: %zu, Bombs: %zu, Explosions: %zu, Extras: %zu)",
         static_cast<unsigned long long>(frame_counter),
         stats.total_objects,
         stats.active_bombers, 
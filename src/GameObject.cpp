@@ -1,4 +1,5 @@
 #include <set>
+#include "Logger.h"
 #include <SDL3/SDL.h>
 
 /* This file is part of ClanBomber <http://www.nongnu.org/clanbomber>.
@@ -96,6 +97,8 @@ GameObject::GameObject( int _x, int _y, GameContext* context )
 	// This unifies the coordinate system throughout the game
 	x = orig_x = _x;  // Center X coordinate
 	y = orig_y = _y;  // Center Y coordinate
+	prev_x = x;
+	prev_y = y;
 	z = 0;
 
 	opacity = 0xff;
@@ -282,9 +285,9 @@ bool GameObject::is_blocked(float check_x, float check_y) {
                 Bomb* bomb = static_cast<Bomb*>(bomb_obj);
                 if (bomber->can_ignore_bomb_collision(bomb)) {
                     should_ignore_bomb = true;
-                    SDL_Log("🎯 BOMB ESCAPE: Ignoring collision - bomber on top of placed bomb at (%d,%d)", bomb_obj->get_x(), bomb_obj->get_y());
+                    LOG_TRACE(GAME, "🎯 BOMB ESCAPE: Ignoring collision - bomber on top of placed bomb at (%d,%d)", bomb_obj->get_x(), bomb_obj->get_y());
                 } else {
-                    SDL_Log("⚠️  BOMB COLLISION ENABLED: Bomber at (%d,%d), bomb at (%d,%d)", (int)check_x, (int)check_y, bomb_obj->get_x(), bomb_obj->get_y());
+                    LOG_TRACE(GAME, "⚠️  BOMB COLLISION ENABLED: Bomber at (%d,%d), bomb at (%d,%d)", (int)check_x, (int)check_y, bomb_obj->get_x(), bomb_obj->get_y());
                 }
             }
             
@@ -298,7 +301,7 @@ bool GameObject::is_blocked(float check_x, float check_y) {
                 int bomb_tile_y = bomb_grid.grid_y;
                 
                 if (bomber_tile_x == bomb_tile_x && bomber_tile_y == bomb_tile_y) {
-                    SDL_Log("🚫 BOMB COLLISION: Bomber at tile (%d,%d) blocked by bomb at tile (%d,%d)", 
+                    LOG_TRACE(GAME, "🚫 BOMB COLLISION: Bomber at tile (%d,%d) blocked by bomb at tile (%d,%d)", 
                             bomber_tile_x, bomber_tile_y, bomb_tile_x, bomb_tile_y);
                     return true; // Only block if bomber is in exact same tile as bomb
                 }
@@ -351,23 +354,23 @@ bool GameObject::move_dist(float distance, Direction dir) {
            case DIR_UP:    move_y = -distance; break;
            case DIR_DOWN:  move_y =  distance; break;
            default: 
-               SDL_Log("🚫 MOVE: Invalid direction %d", (int)dir);
+               LOG_TRACE(GAME, "🚫 MOVE: Invalid direction %d", (int)dir);
                return false;
        }
    
        float next_x = x + move_x;
        float next_y = y + move_y;
        
-       SDL_Log("🎯 MOVE: Target position (%.1f,%.1f)", next_x, next_y);
+       LOG_TRACE(GAME, "🎯 MOVE: Target position (%.1f,%.1f)", next_x, next_y);
    
        if (!is_blocked(next_x, next_y)) {
            // Direct path is clear
-           SDL_Log("✅ MOVE: Direct path clear - moving to (%.1f,%.1f)", next_x, next_y);
+           LOG_TRACE(GAME, "✅ MOVE: Direct path clear - moving to (%.1f,%.1f)", next_x, next_y);
            x = next_x;
            y = next_y;
            moved = true;
        } else {
-           SDL_Log("🚫 MOVE: Direct path blocked - trying partial movement");
+           LOG_TRACE(GAME, "🚫 MOVE: Direct path blocked - trying partial movement");
        }
    
        // Path is blocked, try partial movement first (for wiggling)
@@ -420,7 +423,7 @@ bool GameObject::move_dist(float distance, Direction dir) {
        if (moved) {
            GameContext* context = get_context();
            if (context) {
-               SDL_Log("SPATIAL DEBUG: Updating object type=%d position from (%.1f,%.1f) to (%.1f,%.1f)", 
+               LOG_TRACE(GAME, "SPATIAL DEBUG: Updating object type=%d position from (%.1f,%.1f) to (%.1f,%.1f)", 
                        get_type(), old_x, old_y, x, y);
                context->update_object_position_in_spatial_grid(this, old_x, old_y);
            }
@@ -670,8 +673,8 @@ int GameObject::get_map_x() const
 	if (tmp < 0) {
 		tmp = 0;
 	}
-	else if (tmp >= MAP_WIDTH) {
-		tmp = MAP_WIDTH-1;
+	else if (tmp >= CoordinateConfig::grid_width) {
+		tmp = CoordinateConfig::grid_width-1;
 	}
 	return tmp;
 }
@@ -684,8 +687,8 @@ int GameObject::get_map_y() const
 	if (tmp < 0) {
         tmp = 0; 
     }
-    else if (tmp >= MAP_HEIGHT) {
-        tmp = MAP_HEIGHT-1;
+    else if (tmp >= CoordinateConfig::grid_height) {
+        tmp = CoordinateConfig::grid_height-1;
     }
     return tmp;
 }
@@ -745,7 +748,7 @@ MapTile* GameObject::get_tile() const
 	// GAMECONTEXT MIGRATION: Use GameContext instead of direct app access
 	GameContext* context = get_context();
 	if (!context || !context->get_map()) {
-		SDL_Log("ERROR: get_tile called with null context or map");
+		LOG_ERROR(GAME, "get_tile called with null context or map");
 		return nullptr;
 	}
 	Map* map = context->get_map();
@@ -761,7 +764,7 @@ MapTile* GameObject::get_legacy_tile() const
 	// GAMECONTEXT MIGRATION: Use GameContext instead of direct app access
 	GameContext* context = get_context();
 	if (!context || !context->get_map()) {
-		SDL_Log("ERROR: get_legacy_tile called with null context or map");
+		LOG_ERROR(GAME, "get_legacy_tile called with null context or map");
 		return nullptr;
 	}
 	Map* map = context->get_map();
@@ -777,7 +780,7 @@ TileEntity* GameObject::get_tile_entity() const
 	// GAMECONTEXT MIGRATION: Use GameContext instead of direct app access
 	GameContext* context = get_context();
 	if (!context || !context->get_map()) {
-		SDL_Log("ERROR: get_tile_entity called with null context or map");
+		LOG_ERROR(GAME, "get_tile_entity called with null context or map");
 		return nullptr;
 	}
 	Map* map = context->get_map();
@@ -793,7 +796,7 @@ int GameObject::get_tile_type_at(int pixel_x, int pixel_y) const
 	// GAMECONTEXT MIGRATION: Use GameContext instead of direct app access
 	GameContext* context = get_context();
 	if (!context || !context->get_map()) {
-		SDL_Log("ERROR: get_tile_type_at called with null context or map");
+		LOG_ERROR(GAME, "get_tile_type_at called with null context or map");
 		return MapTile::GROUND;
 	}
 	Map* map = context->get_map();
@@ -823,7 +826,7 @@ bool GameObject::is_tile_blocking_at(int pixel_x, int pixel_y) const
 	// GAMECONTEXT ONLY: No fallback needed - all objects use GameContext
 	GameContext* context = get_context();
 	if (!context || !context->get_map()) {
-		SDL_Log("ERROR: is_tile_blocking_at called with null context or map");
+		LOG_ERROR(GAME, "is_tile_blocking_at called with null context or map");
 		return false;
 	}
 	
@@ -838,7 +841,7 @@ bool GameObject::has_bomb_at(int pixel_x, int pixel_y) const
 	// GAMECONTEXT ONLY: No fallback needed - all objects use GameContext
 	GameContext* context = get_context();
 	if (!context || !context->get_map()) {
-		SDL_Log("ERROR: has_bomb_at called with null context or map");
+		LOG_ERROR(GAME, "has_bomb_at called with null context or map");
 		return false;
 	}
 	
@@ -853,7 +856,7 @@ bool GameObject::has_bomber_at(int pixel_x, int pixel_y) const
 	// GAMECONTEXT MIGRATION: Use GameContext instead of direct app access
 	GameContext* context = get_context();
 	if (!context || !context->get_map()) {
-		SDL_Log("ERROR: has_bomber_at called with null context or map");
+		LOG_ERROR(GAME, "has_bomber_at called with null context or map");
 		return false;
 	}
 	Map* map = context->get_map();
@@ -884,12 +887,12 @@ bool GameObject::has_bomber_at(int pixel_x, int pixel_y) const
 
 void GameObject::set_bomb_on_tile(Bomb* bomb) const {
     // NO-OP: Legacy function removed - SpatialGrid automatically handles bomb positioning
-    SDL_Log("GameObject: set_bomb_on_tile() called but legacy system removed - SpatialGrid handles collision");
+    LOG_DEBUG(GAME, "GameObject: set_bomb_on_tile() called but legacy system removed - SpatialGrid handles collision");
 }
 
 void GameObject::remove_bomb_from_tile(Bomb* bomb) const {
     // NO-OP: Legacy function removed - SpatialGrid automatically handles bomb cleanup via delete_me flag
-    SDL_Log("GameObject: remove_bomb_from_tile() called but legacy system removed - SpatialGrid handles cleanup");
+    LOG_DEBUG(GAME, "GameObject: remove_bomb_from_tile() called but legacy system removed - SpatialGrid handles cleanup");
 }
 
 void GameObject::show()
@@ -901,7 +904,7 @@ void GameObject::show()
     // GAMECONTEXT ONLY: LifecycleManager controls rendering
     GameContext* context = get_context();
     if (!context || !context->get_lifecycle_manager()) {
-        SDL_Log("ERROR: show() called with null context or lifecycle_manager");
+        LOG_ERROR(GAME, "show() called with null context or lifecycle_manager");
         return;
     }
     
@@ -925,28 +928,41 @@ void GameObject::show()
             // Dynamic objects (BOMBER, BOMB, etc.): Convert center→top-left for rendering
             const int SPRITE_WIDTH = TILE_SIZE;
             const int SPRITE_HEIGHT = TILE_SIZE;
-            render_x = static_cast<float>(get_x()) - (SPRITE_WIDTH / 2);   // Center → top-left
-            render_y = static_cast<float>(get_y()) - (SPRITE_HEIGHT / 2);  // Center → top-left
+            PixelCoord center = get_interpolated_position();
+            render_x = static_cast<float>(static_cast<int>(center.pixel_x)) - (SPRITE_WIDTH / 2);   // Center → top-left
+            render_y = static_cast<float>(static_cast<int>(center.pixel_y)) - (SPRITE_HEIGHT / 2);  // Center → top-left
         }
         
         PixelCoord position(render_x, render_y);
         
         auto result = facade->render_sprite(texture_name, position, sprite_nr, 0.0f, opacity_scaled);
         if (!result.is_ok()) {
-            SDL_Log("WARNING: GameObject::show() failed to render sprite '%s': %s (Context: %s)", 
+            LOG_WARN(GAME, "GameObject::show() failed to render sprite '%s': %s (Context: %s)", 
                 texture_name.c_str(), result.get_error_message().c_str(), result.get_error_context().c_str());
             
             // NO FALLBACK: RenderingFacade is the only rendering system
-            SDL_Log("ERROR: GameObject::show() - RenderingFacade failed to render sprite '%s'", 
+            LOG_ERROR(GAME, "GameObject::show() - RenderingFacade failed to render sprite '%s'", 
                 texture_name.c_str());
         }
     } else {
         // NO FALLBACK: RenderingFacade is the only rendering system
-        SDL_Log("ERROR: GameObject::show() - RenderingFacade not available, cannot render sprite '%s'", 
+        LOG_ERROR(GAME, "GameObject::show() - RenderingFacade not available, cannot render sprite '%s'", 
             texture_name.c_str());
     }
 }
 
+PixelCoord GameObject::get_interpolated_position() const
+{
+    // Larger jumps than a tile per step are teleports (respawn, pooled reuse): no blend
+    float dx = x - prev_x;
+    float dy = y - prev_y;
+    if (dx > TILE_SIZE || dx < -TILE_SIZE || dy > TILE_SIZE || dy < -TILE_SIZE) {
+        return PixelCoord(x, y);
+    }
+    float alpha = Timer::interpolation_alpha();
+    return PixelCoord(prev_x + dx * alpha, prev_y + dy * alpha);
+}
+
 void GameObject::show(int _x, int _y) const
 {
 }
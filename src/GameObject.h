@@ -195,6 +195,13 @@ public:
 
   static const char* objecttype2string(ObjectType t);
 
+  /**
+   * Saves the current position as the previous simulation state.
+   * Called at the start of every fixed simulation step; show() interpolates
+   * between this and the current position (see FramePacer).
+   */
+  void save_previous_position() { prev_x = x; prev_y = y; }
+
   virtual ObjectType	get_type() const = 0;
   virtual void		stop(bool by_arrow = false);
   virtual void		show();
@@ -208,7 +215,7 @@ public:
   
   /**
    * @brief Indicates if this object supports ObjectPool reuse
-   * Override in derived classes that can be pooled (e.g., ParticleSystem)
+   * Override in derived classes that can be pooled
    */
   virtual bool		supports_object_pooling() const { return false; }
 
@@ -270,6 +277,11 @@ protected:
 	
   float x;
   float y;
+  /**
+   * Position at the start of the current simulation step (render interpolation).
+   */
+  float prev_x;
+  float prev_y;
 public:
   int z;
 protected:
@@ -315,6 +327,7 @@ protected:
   int server_y;
   void reset_next_fly_job();
 private:
+  PixelCoord get_interpolated_position() const;
   bool is_blocked(float check_x, float check_y);
   bool is_next_fly_job();
   int next_fly_job[3];
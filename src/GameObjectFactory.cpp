@@ -1,50 +1,14 @@
 #include "MemoryManagement.h"
-#include "ParticleSystem.h"
 #include "GameObject.h"
 #include "GameContext.h"
 
-ParticleSystem* GameObjectFactory::create_particle_system(int x, int y, int particle_type, GameContext* context) {
-    // Cast int back to ParticleType enum
-    ParticleType type = static_cast<ParticleType>(particle_type);
-    
-    auto& pool = get_pool<ParticleSystem>();
-    auto particle_system = pool.acquire();
-    
-    if (particle_system) {
-        // Reuse existing object by reinitializing it
-        SDL_Log("🔄 POOL HIT: Reusing ParticleSystem from pool (type=%d, pool_size=%zu)", 
-                particle_type, pool.size());
-        particle_system->reinitialize(x, y, type, context);
-    } else {
-        // Create new object if pool is empty
-        SDL_Log("🆕 POOL MISS: Creating new ParticleSystem (type=%d, pool_size=%zu)", 
-                particle_type, pool.size());
-        particle_system = std::make_unique<ParticleSystem>(x, y, type, context);
-    }
-    
-    auto* raw_ptr = particle_system.release(); // Transfer ownership to GameContext
-    context->register_object(raw_ptr);
-    return raw_ptr;
-}
-
 bool GameObjectFactory::try_return_to_pool(GameObject* obj) {
     if (!obj || !obj->supports_object_pooling()) {
         return false; // Not poolable, should be deleted normally
     }
     
-    // Type-specific pool return (only ParticleSystem supported for now)
-    if (auto* particle_system = dynamic_cast<ParticleSystem*>(obj)) {
-        auto unique_obj = std::unique_ptr<ParticleSystem>(particle_system);
-        auto& pool = get_pool<ParticleSystem>();
-        size_t pool_size_before = pool.size();
-        
-        return_to_pool(std::move(unique_obj));
-        
-        SDL_Log("♻️  POOL RETURN: ParticleSystem returned to pool (pool_size: %zu -> %zu)", 
-                pool_size_before, pool.size());
-        return true;
-    }
-    
+    // No GameObject type is pooled at the moment; particle emitters live in
+    // ParticleEffectsManager's own pool outside the GameObject world
     return false; // Unknown poolable type, should be deleted normally
 }
 
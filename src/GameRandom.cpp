@@ -0,0 +1,47 @@
+#include "GameRandom.h"
+#include <SDL3/SDL_timer.h>
+
+uint64_t GameRandom::state = 0x9E3779B97F4A7C15ULL;
+uint32_t GameRandom::current_seed = 0;
+bool GameRandom::has_fixed_seed = false;
+uint32_t GameRandom::fixed_seed = 0;
+
+void GameRandom::seed(uint32_t seed) {
+    current_seed = seed;
+    // splitmix64 of the seed: never zero, and nearby seeds give unrelated streams
+    uint64_t z = seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    state = (z ^ (z >> 31)) | 1;
+}
+
+uint32_t GameRandom::make_seed() {
+    if (has_fixed_seed) {
+        return fixed_seed;
+    }
+    Uint64 counter = SDL_GetPerformanceCounter();
+    return static_cast<uint32_t>(counter ^ (counter >> 32));
+}
+
+void GameRandom::set_fixed_seed(uint32_t seed) {
+    has_fixed_seed = true;
+    fixed_seed = seed;
+}
+
+void GameRandom::clear_fixed_seed() {
+    has_fixed_seed = false;
+}
+
+uint32_t GameRandom::next_u32() {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return static_cast<uint32_t>((state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+int GameRandom::next_int(int bound) {
+    if (bound <= 1) {
+        return 0;
+    }
+    return static_cast<int>(next_u32() % static_cast<uint32_t>(bound));
+}
@@ -0,0 +1,39 @@
+#ifndef GAMERANDOM_H
+#define GAMERANDOM_H
+
+#include <cstdint>
+
+/**
+ * @brief Generador aleatorio de la simulación (mapa, extras), sembrable
+ *
+ * Todo lo que cambia el resultado de una partida sale de aquí y no de rand()
+ * ni de std::random_device: con la misma semilla y las mismas entradas la
+ * partida se repite exactamente (ver Replay). La IA y los efectos cosméticos
+ * siguen usando sus propios generadores, que no afectan a la reproducción.
+ *
+ * xorshift64* en vez de std::mt19937 + distribuciones: el resultado de las
+ * distribuciones de la STL depende de la implementación, y una repetición
+ * grabada en un sistema debe reproducirse igual en otro.
+ */
+class GameRandom {
+public:
+    static void seed(uint32_t seed);
+    static uint32_t get_seed() { return current_seed; }
+
+    // Semilla nueva para una partida sin repetición (reloj de alta resolución),
+    // o la fijada con set_fixed_seed() (benchmarks, pruebas reproducibles)
+    static uint32_t make_seed();
+    static void set_fixed_seed(uint32_t seed);
+    static void clear_fixed_seed();
+
+    static uint32_t next_u32();
+    static int next_int(int bound);   // [0, bound)
+
+private:
+    static uint64_t state;
+    static uint32_t current_seed;
+    static bool has_fixed_seed;
+    static uint32_t fixed_seed;
+};
+
+#endif
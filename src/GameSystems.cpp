@@ -1,8 +1,10 @@
 #include "GameSystems.h"
+#include "Logger.h"
 #include "GameContext.h"
 #include "GameObject.h"
 #include "Bomber.h"
 #include "Timer.h"
+#include "Profiler.h"
 #include <SDL3/SDL.h>
 #include <memory>
 
@@ -10,16 +12,17 @@ GameSystems::GameSystems(GameContext* context)
     : context(context)
     , objects_ref(nullptr)
     , bombers_ref(nullptr) {
-    SDL_Log("GameSystems: Initialized modular game systems");
+    LOG_INFO(GAME, "GameSystems: Initialized modular game systems");
 }
 
 GameSystems::~GameSystems() {
-    SDL_Log("GameSystems: Shutdown complete");
+    LOG_INFO(GAME, "GameSystems: Shutdown complete");
 }
 
 void GameSystems::update_all_systems(float deltaTime) {
+    PROFILE_ZONE("GameSystems::update_all_systems");
     if (!systems_initialized) {
-        SDL_Log("WARNING: GameSystems not initialized, skipping update");
+        LOG_WARN(GAME, "GameSystems not initialized, skipping update");
         return;
     }
     
@@ -51,10 +54,12 @@ void GameSystems::render_all_systems() {
 }
 
 void GameSystems::update_input_system(float deltaTime) {
+    PROFILE_ZONE("GameSystems::update_input_system");
     // TODO: Extract input processing from individual objects
 }
 
 void GameSystems::update_physics_system(float deltaTime) {
+    PROFILE_ZONE("GameSystems::update_physics_system");
     // Update object physics/movement
     if (!objects_ref) return;
     
@@ -66,6 +71,7 @@ void GameSystems::update_physics_system(float deltaTime) {
 }
 
 void GameSystems::update_ai_system(float deltaTime) {
+    PROFILE_ZONE("GameSystems::update_ai_system");
     // Update bomber AI and behaviors
     if (!bombers_ref) return;
     
@@ -77,10 +83,12 @@ void GameSystems::update_ai_system(float deltaTime) {
 }
 
 void GameSystems::update_collision_system(float deltaTime) {
+    PROFILE_ZONE("GameSystems::update_collision_system");
     // TODO: Extract collision detection logic
 }
 
 void GameSystems::update_animation_system(float deltaTime) {
+    PROFILE_ZONE("GameSystems::update_animation_system");
     // TODO: Extract animation logic
 }
 
@@ -100,36 +108,37 @@ void GameSystems::set_object_references(std::list<std::unique_ptr<GameObject>>*
                                         std::list<std::unique_ptr<Bomber>>* bombers) {
     objects_ref = objects;
     bombers_ref = bombers;
-    SDL_Log("GameSystems: Object references set successfully");
+    LOG_INFO(GAME, "GameSystems: Object references set successfully");
 }
 
 void GameSystems::init_all_systems() {
     if (!context) {
-        SDL_Log("ERROR: GameSystems cannot initialize without GameContext");
+        LOG_ERROR(GAME, "GameSystems cannot initialize without GameContext");
         return;
     }
     
     if (!objects_ref || !bombers_ref) {
-        SDL_Log("ERROR: GameSystems cannot initialize without object references");
+        LOG_ERROR(GAME, "GameSystems cannot initialize without object references");
         return;
     }
     
     // Initialize individual systems here
     systems_initialized = true;
-    SDL_Log("GameSystems: All systems initialized successfully");
+    LOG_INFO(GAME, "GameSystems: All systems initialized successfully");
 }
 
 void GameSystems::register_object(GameObject* obj) {
     // NOTE: Objects should be managed by their creator, not by GameSystems
-    SDL_Log("GameSystems: Object registration noted but object management is handled by creator");
+    LOG_DEBUG(GAME, "GameSystems: Object registration noted but object management is handled by creator");
 }
 
 void GameSystems::register_bomber(Bomber* bomber) {
     // NOTE: Bombers should be managed by their creator, not by GameSystems
-    SDL_Log("GameSystems: Bomber registration noted but object management is handled by creator");
+    LOG_DEBUG(GAME, "GameSystems: Bomber registration noted but object management is handled by creator");
 }
 
 void GameSystems::cleanup_destroyed_objects() {
+    PROFILE_ZONE("GameSystems::cleanup_destroyed_objects");
     // CRITICAL FIX: GameSystems should NOT delete objects directly!
     // This was causing use-after-free because LifecycleManager still held references
     // to objects that GameSystems was deleting.
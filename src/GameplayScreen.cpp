@@ -1,4 +1,5 @@
 #include "GameplayScreen.h"
+#include "Logger.h"
 #include "Bomber.h"
 #include "Timer.h"
 #include "Controller_Keyboard.h"
@@ -12,17 +13,34 @@
 #include "TileEntity.h"
 #include "GameContext.h"
 #include "GameLogic.h"
+#include "ParticleEffectsManager.h"
+#include "RenderingFacade.h"
 #include "CoordinateSystem.h"
+#include "PerfHUD.h"
+#include "GameRandom.h"
+#include "Replay.h"
+#include "Controller_Replay.h"
 #include <algorithm>
+#include <cmath>
 #include <set>
 #include <vector>
 #include <string>
 #include <memory>
 #include "GameObject.h"
 
-GameplayScreen::GameplayScreen(ClanBomberApplication* app) : app(app), game_systems(nullptr), game_logic(nullptr) {
-    SDL_Log("GameplayScreen::GameplayScreen() - Loading game configuration...");
+GameplayScreen::GameplayScreen(ClanBomberApplication* app, std::shared_ptr<Replay> _playback, const std::string& _record_path)
+    : app(app), game_systems(nullptr), game_logic(nullptr), perf_hud(nullptr),
+      camera_x(0.0f), camera_y(0.0f), prev_camera_x(0.0f), prev_camera_y(0.0f), camera_placed(false), match_seed(0), simulated_ticks(0), replay_desync_reported(false), playback(std::move(_playback)), record_path(_record_path) {
+    LOG_INFO(GAME, "GameplayScreen::GameplayScreen() - Loading game configuration...");
     GameConfig::load(); // Load game configuration before initializing
+    if (playback) {
+        playback->apply_config(); // In memory only, clanbomber.cfg is untouched
+        playback->set_playback_tick(0);
+        LOG_INFO(GAME, "GameplayScreen: playing back replay (%zu ticks)", playback->get_tick_count());
+    }
+    if (!record_path.empty()) {
+        recording = std::make_unique<Replay>();
+    }
     
     // Clear any pending keyboard events to prevent menu input bleeding into gameplay
     SDL_PumpEvents();
@@ -30,9 +48,17 @@ GameplayScreen::GameplayScreen(ClanBomberApplication* app) : app(app), game_syst
     
     init_game();
     next_state = GameState::GAMEPLAY;
+    perf_hud = new PerfHUD(app);
 }
 
 GameplayScreen::~GameplayScreen() {
+    if (recording && recording->get_tick_count() > 0) {
+        auto save_result = recording->save(record_path);
+        if (!save_result.is_ok()) {
+            LOG_ERROR(GAME, "GameplayScreen: could not save replay: %s (%s)",
+                      save_result.get_error_message().c_str(), save_result.get_error_context().c_str());
+        }
+    }
     if (game_systems) {
         delete game_systems;
         game_systems = nullptr;
@@ -41,6 +67,10 @@ GameplayScreen::~GameplayScreen() {
         delete game_logic;
         game_logic = nullptr;
     }
+    if (perf_hud) {
+        delete perf_hud;
+        perf_hud = nullptr;
+    }
     deinit_game();
 }
 
@@ -49,11 +79,7 @@ GameState GameplayScreen::get_next_state() {
 }
 
 void GameplayScreen::init_game() {
-    frame_count = 0;
-    frame_time = 0;
-    fps = 0;
     pause_game = false;
-    show_fps = false;
     
     // Initialize controller activation delay (wait for fly-to animations to complete)
     controller_activation_timer = 2.0f; // 2 second delay to allow animations to finish
@@ -74,21 +100,27 @@ void GameplayScreen::init_game() {
     if (!app->game_context) {
         app->initialize_game_context();
     } else {
-        SDL_Log("GameplayScreen: Using existing GameContext with initialized RenderingFacade");
+        LOG_INFO(GAME, "GameplayScreen: Using existing GameContext with initialized RenderingFacade");
     }
     
     // CRITICAL FIX: Connect GameContext to rendering lists so TileEntity objects are rendered
     if (app->game_context) {
         app->game_context->set_object_lists(&app->objects);
-        SDL_Log("GameplayScreen: Connected GameContext to rendering lists");
+        LOG_INFO(GAME, "GameplayScreen: Connected GameContext to rendering lists");
     }
     
+    // Everything random that affects the match comes from GameRandom from here on
+    match_seed = playback ? playback->get_seed() : GameRandom::make_seed();
+    GameRandom::seed(match_seed);
+
     app->map = new Map(app->game_context);
     if (!app->map->any_valid_map()) {
-        SDL_Log("No valid maps found.");
+        LOG_WARN(GAME, "No valid maps found.");
     }
 
-    if (GameConfig::get_random_map_order()) {
+    if (playback && app->map->load_by_name(playback->get_map_name())) {
+        // Replays store the map by name: map indices depend on the local map folder
+    } else if (GameConfig::get_random_map_order()) {
         app->map->load_random_valid();
     } else {
         if (GameConfig::get_start_map() > app->map->get_map_count() - 1) {
@@ -108,14 +140,16 @@ void GameplayScreen::init_game() {
 
     int j = 0;
     for (int i = 0; i < 8; i++) {
-        SDL_Log("Bomber %d: enabled=%d, controller=%d", i, GameConfig::bomber[i].is_enabled(), GameConfig::bomber[i].get_controller());
+        LOG_DEBUG(GAME, "Bomber %d: enabled=%d, controller=%d", i, GameConfig::bomber[i].is_enabled(), GameConfig::bomber[i].get_controller());
         if (GameConfig::bomber[i].is_enabled()) {
             CL_Vector pos = app->map->get_bomber_pos(j++);
             int controller_type = GameConfig::bomber[i].get_controller();
-            SDL_Log("Creating controller type %d for bomber %d", controller_type, i);
-            Controller* controller = Controller::create(static_cast<Controller::CONTROLLER_TYPE>(controller_type));
+            LOG_DEBUG(GAME, "Creating controller type %d for bomber %d", controller_type, i);
+            Controller* controller = playback
+                ? new Controller_Replay(playback, i)
+                : Controller::create(static_cast<Controller::CONTROLLER_TYPE>(controller_type));
             if (!controller) {
-                SDL_Log("Failed to create controller for bomber %d, skipping", i);
+                LOG_WARN(GAME, "Failed to create controller for bomber %d, skipping", i);
                 continue;
             }
             
@@ -124,7 +158,7 @@ void GameplayScreen::init_game() {
             PixelCoord center = CoordinateSystem::grid_to_pixel(grid);
             int final_x = static_cast<int>(center.pixel_x);
             int final_y = static_cast<int>(center.pixel_y);
-            SDL_Log("Creating bomber %d: controller=%d, pos=(%f,%f) -> direct spawn at (%d,%d)", 
+            LOG_DEBUG(GAME, "Creating bomber %d: controller=%d, pos=(%f,%f) -> direct spawn at (%d,%d)", 
                    i, GameConfig::bomber[i].get_controller(), pos.x, pos.y, final_x, final_y);
             
             auto bomber = std::make_unique<Bomber>(final_x, final_y, static_cast<Bomber::COLOR>(GameConfig::bomber[i].get_skin()), controller, *app->game_context);
@@ -138,10 +172,6 @@ void GameplayScreen::init_game() {
                 app->game_context->register_object(bomber.get());
             }
             
-            app->bomber_objects.push_back(std::move(bomber));
-            
-            // No fly-to animation needed - spawn directly at correct position
-            
             // Delay controller activation to prevent menu input bleeding
             if (bomber->get_controller()) {
                 bomber->get_controller()->deactivate(); // Start deactivated
@@ -150,6 +180,9 @@ void GameplayScreen::init_game() {
             
             // Set appropriate Z-order for visual layering
             bomber->z = 10 + i;
+            
+            // No fly-to animation needed - spawn directly at correct position
+            app->bomber_objects.push_back(std::move(bomber));
         }
     }
 
@@ -179,13 +212,13 @@ void GameplayScreen::init_game() {
         game_systems = new GameSystems(app->game_context);
         game_systems->set_object_references(&app->objects, &app->bomber_objects);
         game_systems->init_all_systems();
-        SDL_Log("GameSystems initialized in GameplayScreen");
+        LOG_INFO(GAME, "GameSystems initialized in GameplayScreen");
         
         // OPTIMIZED: Initialize GameLogic facade for centralized game logic
         game_logic = new GameLogic(app->game_context);
-        SDL_Log("GameLogic facade initialized in GameplayScreen");
+        LOG_INFO(GAME, "GameLogic facade initialized in GameplayScreen");
     } else {
-        SDL_Log("WARNING: GameContext not available, using legacy act_all()");
+        LOG_WARN(GAME, "GameContext not available, using legacy act_all()");
     }
 }
 
@@ -197,11 +230,16 @@ void GameplayScreen::deinit_game() {
     // ARCHITECTURE DECISION: LifecycleManager has exclusive responsibility for object deletion
     // GameplayScreen only clears its references, doesn't delete the objects
     
-    SDL_Log("GameplayScreen: deinit_game() - clearing references (LifecycleManager will handle deletion)");
+    LOG_INFO(GAME, "GameplayScreen: deinit_game() - clearing references (LifecycleManager will handle deletion)");
     
     // Clear references without deleting - LifecycleManager will handle cleanup
     app->objects.clear();
     app->bomber_objects.clear();
+    
+    // Cosmetic emitters and gore are owned by ParticleEffectsManager, just recycle them
+    if (app->particle_effects) {
+        app->particle_effects->clear_effects();
+    }
 
     // Map deletion is safe as it's not managed by LifecycleManager
     delete app->map;
@@ -220,13 +258,25 @@ void GameplayScreen::handle_events(SDL_Event& event) {
                 pause_game = !pause_game;
                 break;
             case SDLK_F1:
-                show_fps = !show_fps;
+                if (perf_hud) {
+                    perf_hud->toggle();
+                }
                 break;
         }
     }
 }
 
 void GameplayScreen::update(float deltaTime) {
+    // Start of a simulation step: current positions become the interpolation origin
+    for (auto& obj : app->objects) {
+        if (obj) obj->save_previous_position();
+    }
+    for (auto& bomber : app->bomber_objects) {
+        if (bomber) bomber->save_previous_position();
+    }
+    prev_camera_x = camera_x;
+    prev_camera_y = camera_y;
+    
     // OPTIMIZED: Use GameLogic facade for pause handling
     if (game_logic) {
         game_logic->set_paused(pause_game);
@@ -236,6 +286,11 @@ void GameplayScreen::update(float deltaTime) {
         return;
     }
 
+    // Replay controllers read the row of the tick being simulated
+    if (playback) {
+        playback->set_playback_tick(simulated_ticks);
+    }
+
     // Handle controller activation delay
     if (!controllers_activated) {
         controller_activation_timer -= deltaTime;
@@ -247,12 +302,13 @@ void GameplayScreen::update(float deltaTime) {
                     bomber->get_controller()->activate();
                 }
             }
-            SDL_Log("Controllers activated after delay");
+            LOG_DEBUG(GAME, "Controllers activated after delay");
         }
     }
 
     // Update 3D audio listener position based on active players
     update_audio_listener();
+    update_camera(deltaTime);
 
     // observer->act();
     // if (observer->end_of_game_requested()) {
@@ -281,11 +337,18 @@ void GameplayScreen::update(float deltaTime) {
         act_all();  // Legacy fallback
     }
     
+    // Cosmetic particles: own pool and update pass, outside LifecycleManager/SpatialGrid
+    if (app->particle_effects) {
+        app->particle_effects->update(deltaTime);
+    }
+    
     // Final cleanup of dead objects (GameLogic also handles this but ensure it's done)
     if (app->lifecycle_manager) {
         app->lifecycle_manager->cleanup_dead_objects();
     }
     
+    end_replay_tick(deltaTime);
+    
     // Handle gore delay and victory checking
     if (!game_over) {
         // Check if we need to start gore delay
@@ -301,7 +364,7 @@ void GameplayScreen::update(float deltaTime) {
             // Start gore delay timer
             checking_victory = true;
             gore_delay_timer = 2.0f; // 2 seconds to enjoy the gore
-            SDL_Log("Starting gore delay...");
+            LOG_DEBUG(GAME, "Starting gore delay...");
         }
         
         if (checking_victory) {
@@ -318,18 +381,42 @@ void GameplayScreen::update(float deltaTime) {
         game_over_timer += deltaTime;
         // Return to menu after 8 seconds (more time to enjoy victory)
         if (game_over_timer > 8.0f) {
-            SDL_Log("Game over timer expired, should return to menu");
+            LOG_INFO(GAME, "Game over timer expired, should return to menu");
             next_state = GameState::MAIN_MENU;
         }
     }
+}
 
-    frame_time += Timer::time_elapsed();
-    if (frame_time > 2) {
-        fps = (int)(frame_count / frame_time + 0.5f);
-        frame_time = 0;
-        frame_count = 0;
+void GameplayScreen::end_replay_tick(float deltaTime) {
+    bool checksum_tick = (simulated_ticks + 1) % Replay::CHECKSUM_INTERVAL == 0;
+
+    if (recording) {
+        if (simulated_ticks == 0) {
+            recording->begin(match_seed, app->map ? app->map->get_name() : std::string(), deltaTime);
+        }
+        // What each bomber's controller answered during this tick
+        recording->record_tick(app->bomber_objects);
+        if (checksum_tick) {
+            recording->record_checksum(Replay::compute_checksum(app->bomber_objects));
+        }
     }
-    frame_count++;
+
+    if (playback) {
+        if (simulated_ticks == 0 && deltaTime != playback->get_step_seconds()) {
+            LOG_WARN(GAME, "Replay: recorded with a %.9f s step, playing at %.9f s: expect desyncs",
+                     playback->get_step_seconds(), deltaTime);
+        }
+        if (checksum_tick && !replay_desync_reported &&
+            !playback->verify_checksum(Replay::compute_checksum(app->bomber_objects))) {
+            LOG_WARN(GAME, "Replay: desync at tick %zu, the match no longer matches the recording", simulated_ticks);
+            replay_desync_reported = true;
+        }
+        if (simulated_ticks + 1 == playback->get_tick_count()) {
+            LOG_INFO(GAME, "Replay: end of recorded input at tick %zu", simulated_ticks);
+        }
+    }
+
+    simulated_ticks++;
 }
 
 void GameplayScreen::update_audio_listener() {
@@ -353,7 +440,65 @@ void GameplayScreen::update_audio_listener() {
     }
 }
 
+void GameplayScreen::update_camera(float deltaTime) {
+    RenderingFacade* facade = app->game_context ? app->game_context->get_rendering_facade() : nullptr;
+    if (!facade) return;
+    
+    RenderingFacade::ViewportBounds viewport = facade->get_viewport_bounds();
+    float max_x = static_cast<float>(std::max(0, CoordinateConfig::get_world_width() - viewport.width));
+    float max_y = static_cast<float>(std::max(0, CoordinateConfig::get_world_height() - viewport.height));
+    if (max_x == 0.0f && max_y == 0.0f) {
+        // The whole map fits on screen: classic fixed view
+        camera_x = camera_y = 0.0f;
+        prev_camera_x = prev_camera_y = 0.0f;
+        return;
+    }
+    
+    // Follow the local players; with only bots left, the centre of all of them
+    float total_x = 0.0f, total_y = 0.0f, bot_x = 0.0f, bot_y = 0.0f;
+    int player_count = 0, bot_count = 0;
+    for (auto& bomber : app->bomber_objects) {
+        if (!bomber || bomber->delete_me || bomber->is_dead()) continue;
+        Controller* controller = bomber->get_controller();
+        bool is_bot = controller && (controller->get_type() == Controller::AI || controller->get_type() == Controller::AI_mass);
+        (is_bot ? bot_x : total_x) += bomber->get_x();
+        (is_bot ? bot_y : total_y) += bomber->get_y();
+        (is_bot ? bot_count : player_count)++;
+    }
+    if (player_count == 0) {
+        if (bot_count == 0) return;
+        total_x = bot_x;
+        total_y = bot_y;
+        player_count = bot_count;
+    }
+    
+    const float half_tile = CoordinateConfig::TILE_SIZE * 0.5f;
+    float target_x = std::clamp(total_x / player_count + half_tile - viewport.width * 0.5f, 0.0f, max_x);
+    float target_y = std::clamp(total_y / player_count + half_tile - viewport.height * 0.5f, 0.0f, max_y);
+    
+    if (!camera_placed) {
+        camera_x = prev_camera_x = target_x;
+        camera_y = prev_camera_y = target_y;
+        camera_placed = true;
+        return;
+    }
+    // Ease towards the target instead of snapping when the group splits or someone dies
+    const float follow_rate = 6.0f;
+    float t = std::min(1.0f, deltaTime * follow_rate);
+    camera_x += (target_x - camera_x) * t;
+    camera_y += (target_y - camera_y) * t;
+}
+
 void GameplayScreen::render(SDL_Renderer* renderer) {
+    RenderingFacade* facade = app->game_context ? app->game_context->get_rendering_facade() : nullptr;
+    if (facade) {
+        // Same interpolation as the sprites, then whole pixels so they stay crisp while the camera glides
+        float alpha = Timer::interpolation_alpha();
+        float view_x = prev_camera_x + (camera_x - prev_camera_x) * alpha;
+        float view_y = prev_camera_y + (camera_y - prev_camera_y) * alpha;
+        facade->set_camera(PixelCoord(std::floor(view_x), std::floor(view_y)));
+    }
+    
     // OPTIMIZED: Use GameLogic facade for centralized rendering if available
     if (game_logic) {
         // GameLogic handles object rendering, but we still need map rendering
@@ -362,22 +507,47 @@ void GameplayScreen::render(SDL_Renderer* renderer) {
             app->map->show(); // Always draw map first as background
         }
         
+        // Accumulated blood/scorch decals: one composited quad over the floor
+        if (app->particle_effects) {
+            app->particle_effects->render_floor_decals();
+        }
+        
         game_logic->render_all_objects(); // Renders all game objects in proper order
         
+        // Every live explosion in one instanced draw call, above the objects
+        if (app->game_context && app->game_context->get_rendering_facade()) {
+            app->game_context->get_rendering_facade()->render_explosion_batch();
+        }
+        
+        // Particles on top of objects in a single batch (not part of the z-sorted list)
+        if (app->particle_effects) {
+            app->particle_effects->render();
+        }
+        
+        // Overlays and HUD are drawn in screen space
+        if (facade) {
+            facade->set_camera(PixelCoord(0.0f, 0.0f));
+        }
+        
         // Show victory/defeat overlay
         if (game_over) {
             render_victory_screen();
         }
     } else {
         show_all(); // Legacy fallback
+        if (facade) {
+            facade->set_camera(PixelCoord(0.0f, 0.0f));
+        }
     }
 
     if (pause_game) {
         // Render pause message
     }
 
-    if (show_fps) {
-        // Render FPS
+    // Last, so the HUD draws over everything else
+    if (perf_hud) {
+        perf_hud->sample(Timer::frame_time() * 1000.0f);
+        perf_hud->render();
     }
 }
 
@@ -418,14 +588,14 @@ void GameplayScreen::delete_some() {
     app->objects.remove_if([this](const std::unique_ptr<GameObject>& obj) {
         LifecycleManager::ObjectState state = app->lifecycle_manager->get_object_state(obj.get());
         if (state == LifecycleManager::ObjectState::DELETED) {
-            SDL_Log("GameplayScreen: Removing object %p from render list (LifecycleManager will delete)", obj.get());
+            LOG_DEBUG(GAME, "GameplayScreen: Removing object %p from render list (LifecycleManager will delete)", obj.get());
             
             // CRITICAL: Clear Map grid pointer for TileEntity before LifecycleManager deletes it
             if (obj->get_type() == GameObject::MAPTILE && app->map) {
                 TileEntity* tile_entity = static_cast<TileEntity*>(obj.get());
                 int map_x = tile_entity->get_map_x();
                 int map_y = tile_entity->get_map_y();
-                SDL_Log("GameplayScreen: Clearing Map grid pointer for TileEntity at (%d,%d)", map_x, map_y);
+                LOG_DEBUG(GAME, "GameplayScreen: Clearing Map grid pointer for TileEntity at (%d,%d)", map_x, map_y);
                 app->map->clear_tile_entity_at(map_x, map_y);
             }
             
@@ -438,7 +608,7 @@ void GameplayScreen::delete_some() {
     app->bomber_objects.remove_if([this](const std::unique_ptr<Bomber>& bomber) {
         LifecycleManager::ObjectState state = app->lifecycle_manager->get_object_state(bomber.get());
         if (state == LifecycleManager::ObjectState::DELETED) {
-            SDL_Log("GameplayScreen: Removing bomber %p from render list (LifecycleManager will delete)", bomber.get());
+            LOG_DEBUG(GAME, "GameplayScreen: Removing bomber %p from render list (LifecycleManager will delete)", bomber.get());
             // DON'T DELETE - LifecycleManager owns the object lifecycle
             return true;  // Remove from list only
         }
@@ -510,9 +680,9 @@ void GameplayScreen::check_victory_conditions() {
             // Play game over sound (only once) - with error protection
             AudioPosition center_pos(400, 300, 0.0f);
             if (!AudioMixer::play_sound_3d("time_over", center_pos, 800.0f)) {
-                SDL_Log("Failed to play time_over sound - continuing without audio");
+                LOG_WARN(GAME, "Failed to play time_over sound - continuing without audio");
             }
-            SDL_Log("Game Over: Draw!");
+            LOG_INFO(GAME, "Game Over: Draw!");
         }
         
     } else if (alive_bombers.size() == 1 && alive_teams.size() <= 1) {
@@ -532,9 +702,9 @@ void GameplayScreen::check_victory_conditions() {
             // Play victory sound (only once) - with error protection
             AudioPosition winner_pos(winner->get_x(), winner->get_y(), 0.0f);
             if (!AudioMixer::play_sound_3d("winlevel", winner_pos, 800.0f)) {
-                SDL_Log("Failed to play winlevel sound - continuing without audio");
+                LOG_WARN(GAME, "Failed to play winlevel sound - continuing without audio");
             }
-            SDL_Log("Game Over: %s", winning_player.c_str());
+            LOG_INFO(GAME, "Game Over: %s", winning_player.c_str());
         }
     }
 }
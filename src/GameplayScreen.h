@@ -5,13 +5,22 @@
 #include "ClanBomber.h"
 #include "Map.h"
 #include "GameState.h"
+#include <memory>
+#include <string>
 
 class GameSystems;
 class GameLogic;
+class PerfHUD;
+class Replay;
 
 class GameplayScreen : public Screen {
 public:
-    GameplayScreen(ClanBomberApplication* app);
+    /**
+     * @param playback Repetición a reproducir (sustituye configuración, mapa y controllers)
+     * @param record_path Si no está vacío, la partida se graba ahí al salir de la pantalla
+     */
+    GameplayScreen(ClanBomberApplication* app, std::shared_ptr<Replay> playback = nullptr,
+                   const std::string& record_path = "");
     ~GameplayScreen();
 
     void handle_events(SDL_Event& event) override;
@@ -27,8 +36,10 @@ private:
     void show_all();
     void delete_some();
     void update_audio_listener();
+    void update_camera(float deltaTime);
     void check_victory_conditions();
     void render_victory_screen();
+    void end_replay_tick(float deltaTime);
     
     // Victory/defeat state
     bool game_over;
@@ -47,15 +58,27 @@ private:
 
     ClanBomberApplication* app;
     bool pause_game;
-    bool show_fps;
-    int fps;
-    int frame_count;
-    float frame_time;
     GameState next_state;
     
     // OPTIMIZED: Modern architectural components
     GameSystems* game_systems;
     GameLogic* game_logic;
+    
+    // F1: frame-time graph + subsystem counters
+    PerfHUD* perf_hud;
+
+    // Cámara del mundo (esquina superior izquierda); solo se mueve si el mapa no cabe en pantalla
+    float camera_x, camera_y;
+    float prev_camera_x, prev_camera_y;  // Al inicio del paso fijo; render() interpola como los sprites
+    bool camera_placed;
+
+    // Repeticiones: semilla de GameRandom y ticks simulados (sin contar pausa)
+    uint32_t match_seed;
+    size_t simulated_ticks;
+    bool replay_desync_reported;
+    std::shared_ptr<Replay> playback;
+    std::unique_ptr<Replay> recording;
+    std::string record_path;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "InputLatency.h"
+#include <SDL3/SDL.h>
+#include <atomic>
+
+namespace {
+    Uint64 pending_input_ns = 0;                  // Main thread only
+    std::atomic<Uint64> bucket_counts[InputLatency::BUCKETS];
+    std::atomic<Uint64> sample_count(0);
+    std::atomic<Uint64> total_us(0);
+    std::atomic<Uint64> last_us(0);
+    std::atomic<bool> low_latency_mode(false);
+}
+
+void InputLatency::note_event(const SDL_Event& event) {
+    bool press = (event.type == SDL_EVENT_KEY_DOWN && !event.key.repeat) ||
+                 event.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN;
+    if (press && pending_input_ns == 0) {
+        pending_input_ns = event.common.timestamp;
+    }
+}
+
+Uint64 InputLatency::take_pending() {
+    Uint64 input_ns = pending_input_ns;
+    pending_input_ns = 0;
+    return input_ns;
+}
+
+void InputLatency::record_presented(Uint64 input_ns, Uint64 present_ns) {
+    if (input_ns == 0 || present_ns < input_ns) {
+        return;
+    }
+    Uint64 latency_us = (present_ns - input_ns) / 1000;
+    int bucket = static_cast<int>(latency_us / (BUCKET_MS * 1000));
+    if (bucket >= BUCKETS) {
+        bucket = BUCKETS - 1;
+    }
+    bucket_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    total_us.fetch_add(latency_us, std::memory_order_relaxed);
+    last_us.store(latency_us, std::memory_order_relaxed);
+    sample_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void InputLatency::get_histogram(Histogram& out) {
+    for (int i = 0; i < BUCKETS; i++) {
+        out.counts[i] = bucket_counts[i].load(std::memory_order_relaxed);
+    }
+    out.samples = sample_count.load(std::memory_order_relaxed);
+    out.last_ms = last_us.load(std::memory_order_relaxed) / 1000.0f;
+    out.mean_ms = out.samples ? (total_us.load(std::memory_order_relaxed) / 1000.0f) / out.samples : 0.0f;
+}
+
+void InputLatency::reset() {
+    for (auto& count : bucket_counts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    sample_count.store(0, std::memory_order_relaxed);
+    total_us.store(0, std::memory_order_relaxed);
+    last_us.store(0, std::memory_order_relaxed);
+}
+
+void InputLatency::set_low_latency_mode(bool enabled) {
+    low_latency_mode.store(enabled, std::memory_order_relaxed);
+}
+
+bool InputLatency::is_low_latency_mode() {
+    return low_latency_mode.load(std::memory_order_relaxed);
+}
+
+float InputLatency::Histogram::percentile(float fraction) const {
+    Uint64 total = 0;
+    for (Uint64 count : counts) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0.0f;
+    }
+    Uint64 target = static_cast<Uint64>(fraction * (total - 1)) + 1;
+    Uint64 seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+        seen += counts[i];
+        if (seen >= target) {
+            return static_cast<float>((i + 1) * BUCKET_MS);
+        }
+    }
+    return static_cast<float>(BUCKETS * BUCKET_MS);
+}
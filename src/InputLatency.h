@@ -0,0 +1,58 @@
+#ifndef INPUTLATENCY_H
+#define INPUTLATENCY_H
+
+#include <SDL3/SDL_stdinc.h>
+
+union SDL_Event;
+
+/**
+ * @brief Latencia entrada → imagen: del timestamp del evento al SDL_GL_SwapWindow que la muestra
+ *
+ * Game::handle_events() pasa cada evento a note_event(); las pulsaciones (tecla
+ * o botón de mando, sin autorepetición) dejan pendiente el timestamp más antiguo.
+ * Cuando un frame ha simulado al menos un paso con esa entrada, Game la saca con
+ * take_pending() y, al volver el swap de ese frame, record_presented() añade la
+ * muestra al histograma. Con el hilo de render el timestamp viaja en el
+ * RenderSnapshot y la muestra la registra ese hilo.
+ *
+ * El retorno del swap es una cota inferior de la latencia real: el driver puede
+ * encolar frames. En modo baja latencia Game hace glFinish() tras el swap y la
+ * medida queda a la altura del inicio del escaneo.
+ *
+ * Histograma de BUCKETS cubos de BUCKET_MS; el último acumula todo lo mayor.
+ * Los contadores son atómicos: se escriben desde el hilo que presenta y el HUD
+ * los lee desde el principal.
+ */
+class InputLatency {
+public:
+    static constexpr int BUCKETS = 32;
+    static constexpr int BUCKET_MS = 2;
+
+    struct Histogram {
+        Uint64 counts[BUCKETS];
+        Uint64 samples;
+        float last_ms;
+        float mean_ms;
+
+        float percentile(float fraction) const;   // Cota superior del cubo, en ms
+    };
+
+    static void note_event(const SDL_Event& event);
+
+    /**
+     * @brief Timestamp (SDL_GetTicksNS) de la entrada más antigua sin presentar, 0 si no hay
+     * La deja consumida: llamar solo en frames que han simulado.
+     */
+    static Uint64 take_pending();
+
+    static void record_presented(Uint64 input_ns, Uint64 present_ns);
+
+    static void get_histogram(Histogram& out);
+    static void reset();
+
+    // Solo informativo (HUD): lo fija Game al cambiar de modo
+    static void set_low_latency_mode(bool enabled);
+    static bool is_low_latency_mode();
+};
+
+#endif
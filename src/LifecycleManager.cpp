@@ -1,20 +1,23 @@
 #include "LifecycleManager.h"
+#include "Logger.h"
 #include "GameObject.h"
 #include "MapTile.h"
 #include "MapTile_Box.h"
 #include "TileEntity.h"
 #include "GameContext.h"
 #include "MemoryManagement.h"
+#include "Profiler.h"
+#include "AllocTracker.h"
 #include <algorithm>
 #include <SDL3/SDL.h>
 
 LifecycleManager::LifecycleManager() : game_context(nullptr) {
-    SDL_Log("LifecycleManager: Initialized unified object lifecycle system");
+    LOG_INFO(LIFECYCLE, "LifecycleManager: Initialized unified object lifecycle system");
 }
 
 LifecycleManager::~LifecycleManager() {
     clear_all();
-    SDL_Log("LifecycleManager: Shutdown complete");
+    LOG_INFO(LIFECYCLE, "LifecycleManager: Shutdown complete");
 }
 
 void LifecycleManager::register_object(GameObject* obj) {
@@ -22,12 +25,12 @@ void LifecycleManager::register_object(GameObject* obj) {
     
     // Check if already registered
     if (find_managed_object(obj)) {
-        SDL_Log("LifecycleManager: Object %p already registered", obj);
+        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Object %p already registered", obj);
         return;
     }
     
     managed_objects.emplace_back(obj);
-    SDL_Log("LifecycleManager: Registered object %p (total: %zu)", obj, managed_objects.size());
+    LOG_DEBUG(LIFECYCLE, "LifecycleManager: Registered object %p (total: %zu)", obj, managed_objects.size());
 }
 
 void LifecycleManager::register_tile(MapTile* tile, int map_x, int map_y) {
@@ -35,12 +38,12 @@ void LifecycleManager::register_tile(MapTile* tile, int map_x, int map_y) {
     
     // Check if already registered
     if (find_managed_tile(tile)) {
-        SDL_Log("LifecycleManager: Tile %p already registered", tile);
+        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Tile %p already registered", tile);
         return;
     }
     
     managed_tiles.emplace_back(tile, map_x, map_y);
-    SDL_Log("LifecycleManager: Registered tile %p at (%d,%d) (total: %zu)", tile, map_x, map_y, managed_tiles.size());
+    LOG_DEBUG(LIFECYCLE, "LifecycleManager: Registered tile %p at (%d,%d) (total: %zu)", tile, map_x, map_y, managed_tiles.size());
 }
 
 void LifecycleManager::register_tile_entity(TileEntity* tile_entity) {
@@ -48,7 +51,7 @@ void LifecycleManager::register_tile_entity(TileEntity* tile_entity) {
     
     // TileEntity hereda de GameObject, así que lo registramos como objeto normal
     register_object(tile_entity);
-    SDL_Log("LifecycleManager: Registered TileEntity %p as GameObject", tile_entity);
+    LOG_DEBUG(LIFECYCLE, "LifecycleManager: Registered TileEntity %p as GameObject", tile_entity);
 }
 
 void LifecycleManager::mark_for_destruction(GameObject* obj) {
@@ -56,14 +59,14 @@ void LifecycleManager::mark_for_destruction(GameObject* obj) {
     
     ManagedObject* managed = find_managed_object(obj);
     if (!managed) {
-        SDL_Log("LifecycleManager: Cannot mark unregistered object %p for destruction", obj);
+        LOG_WARN(LIFECYCLE, "LifecycleManager: Cannot mark unregistered object %p for destruction", obj);
         return;
     }
     
     if (managed->state == ObjectState::ACTIVE) {
         managed->state = ObjectState::DYING;
         managed->state_timer = 0.0f;
-        SDL_Log("LifecycleManager: Object %p marked for destruction (ACTIVE → DYING)", obj);
+        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Object %p marked for destruction (ACTIVE → DYING)", obj);
         
         if (managed->on_state_change) {
             managed->on_state_change();
@@ -76,7 +79,7 @@ void LifecycleManager::mark_tile_for_destruction(MapTile* tile, MapTile* replace
     
     ManagedTile* managed = find_managed_tile(tile);
     if (!managed) {
-        SDL_Log("LifecycleManager: Cannot mark unregistered tile %p for destruction", tile);
+        LOG_WARN(LIFECYCLE, "LifecycleManager: Cannot mark unregistered tile %p for destruction", tile);
         return;
     }
     
@@ -84,7 +87,7 @@ void LifecycleManager::mark_tile_for_destruction(MapTile* tile, MapTile* replace
         managed->state = ObjectState::DYING;
         managed->state_timer = 0.0f;
         managed->replacement = replacement;
-        SDL_Log("LifecycleManager: Tile %p at (%d,%d) marked for destruction (ACTIVE → DYING)", 
+        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Tile %p at (%d,%d) marked for destruction (ACTIVE → DYING)", 
                 tile, managed->map_x, managed->map_y);
     }
 }
@@ -94,10 +97,12 @@ void LifecycleManager::mark_tile_entity_for_destruction(TileEntity* tile_entity)
     
     // TileEntity hereda de GameObject, usa el método estándar
     mark_for_destruction(tile_entity);
-    SDL_Log("LifecycleManager: TileEntity %p marked for destruction", tile_entity);
+    LOG_DEBUG(LIFECYCLE, "LifecycleManager: TileEntity %p marked for destruction", tile_entity);
 }
 
 void LifecycleManager::update_states(float deltaTime) {
+    PROFILE_ZONE("LifecycleManager::update_states");
+    ALLOC_SCOPE(ALLOC_TAG_LIFECYCLE);
     // Update all object states
     for (auto& managed : managed_objects) {
         if (managed.state != ObjectState::DELETED) {
@@ -122,7 +127,7 @@ void LifecycleManager::update_object_state(ManagedObject& managed, float deltaTi
             if (managed.object->delete_me) {
                 managed.state = ObjectState::DYING;
                 managed.state_timer = 0.0f;
-                SDL_Log("LifecycleManager: Object %p self-marked for destruction", managed.object);
+                LOG_DEBUG(LIFECYCLE, "LifecycleManager: Object %p self-marked for destruction", managed.object);
             }
             break;
             
@@ -132,14 +137,14 @@ void LifecycleManager::update_object_state(ManagedObject& managed, float deltaTi
             if (managed.state_timer >= 0.1f) {  // 0.1s default dying time
                 managed.state = ObjectState::DEAD;
                 managed.state_timer = 0.0f;
-                SDL_Log("LifecycleManager: Object %p death animation complete (DYING → DEAD)", managed.object);
+                LOG_DEBUG(LIFECYCLE, "LifecycleManager: Object %p death animation complete (DYING → DEAD)", managed.object);
             }
             break;
             
         case ObjectState::DEAD:
             // Ready for cleanup
             managed.state = ObjectState::DELETED;
-            SDL_Log("LifecycleManager: Object %p ready for deletion (DEAD → DELETED)", managed.object);
+            LOG_DEBUG(LIFECYCLE, "LifecycleManager: Object %p ready for deletion (DEAD → DELETED)", managed.object);
             break;
             
         case ObjectState::DELETED:
@@ -157,7 +162,7 @@ void LifecycleManager::update_tile_state(ManagedTile& managed, float deltaTime)
             if (managed.tile->delete_me) {
                 managed.state = ObjectState::DYING;
                 managed.state_timer = 0.0f;
-                SDL_Log("LifecycleManager: Tile %p at (%d,%d) self-marked for destruction", 
+                LOG_DEBUG(LIFECYCLE, "LifecycleManager: Tile %p at (%d,%d) self-marked for destruction", 
                         managed.tile, managed.map_x, managed.map_y);
             }
             break;
@@ -176,7 +181,7 @@ void LifecycleManager::update_tile_state(ManagedTile& managed, float deltaTime)
                 if (managed.state_timer >= dying_duration) {
                     managed.state = ObjectState::DEAD;
                     managed.state_timer = 0.0f;
-                    SDL_Log("LifecycleManager: Tile %p destruction animation complete (DYING → DEAD)", managed.tile);
+                    LOG_DEBUG(LIFECYCLE, "LifecycleManager: Tile %p destruction animation complete (DYING → DEAD)", managed.tile);
                 }
                 break;
             }
@@ -184,7 +189,7 @@ void LifecycleManager::update_tile_state(ManagedTile& managed, float deltaTime)
         case ObjectState::DEAD:
             // Ready for cleanup and replacement
             managed.state = ObjectState::DELETED;
-            SDL_Log("LifecycleManager: Tile %p ready for replacement (DEAD → DELETED)", managed.tile);
+            LOG_DEBUG(LIFECYCLE, "LifecycleManager: Tile %p ready for replacement (DEAD → DELETED)", managed.tile);
             break;
             
         case ObjectState::DELETED:
@@ -194,12 +199,14 @@ void LifecycleManager::update_tile_state(ManagedTile& managed, float deltaTime)
 }
 
 void LifecycleManager::cleanup_dead_objects() {
+    PROFILE_ZONE("LifecycleManager::cleanup_dead_objects");
+    ALLOC_SCOPE(ALLOC_TAG_LIFECYCLE);
     // ARCHITECTURE FIX: Coordinate with GameContext for proper SpatialGrid cleanup
     auto it = std::remove_if(managed_objects.begin(), managed_objects.end(),
         [this](const ManagedObject& managed) {
             if (managed.state == ObjectState::DELETED) {
                 try {
-                    SDL_Log("LifecycleManager: Cleaning up object %p during cleanup", managed.object);
+                    LOG_DEBUG(LIFECYCLE, "LifecycleManager: Cleaning up object %p during cleanup", managed.object);
                     
                     // CRITICAL FIX: Remove from GameContext systems BEFORE cleanup
                     if (game_context) {
@@ -209,13 +216,13 @@ void LifecycleManager::cleanup_dead_objects() {
                     // Try to return to ObjectPool first, then delete if not poolable
                     bool returned_to_pool = GameObjectFactory::getInstance().try_return_to_pool(managed.object);
                     if (returned_to_pool) {
-                        SDL_Log("LifecycleManager: Returned object %p to ObjectPool for reuse", managed.object);
+                        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Returned object %p to ObjectPool for reuse", managed.object);
                     } else {
-                        SDL_Log("LifecycleManager: Deleting object %p (not poolable)", managed.object);
+                        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Deleting object %p (not poolable)", managed.object);
                         delete managed.object;
                     }
                 } catch (...) {
-                    SDL_Log("ERROR: Exception during object cleanup %p - continuing", managed.object);
+                    LOG_ERROR(LIFECYCLE, "Exception during object cleanup %p - continuing", managed.object);
                 }
                 return true;
             }
@@ -226,14 +233,14 @@ void LifecycleManager::cleanup_dead_objects() {
     managed_objects.erase(it, managed_objects.end());
     
     if (objects_removed > 0) {
-        SDL_Log("LifecycleManager: Cleaned up %zu objects", objects_removed);
+        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Cleaned up %zu objects", objects_removed);
     }
     
     // Remove deleted tiles from tracking (don't delete the tiles themselves!)
     auto tile_it = std::remove_if(managed_tiles.begin(), managed_tiles.end(),
         [](const ManagedTile& managed) {
             if (managed.state == ObjectState::DELETED) {
-                SDL_Log("LifecycleManager: Removing tile %p at (%d,%d) from tracking", 
+                LOG_DEBUG(LIFECYCLE, "LifecycleManager: Removing tile %p at (%d,%d) from tracking", 
                         managed.tile, managed.map_x, managed.map_y);
                 return true;
             }
@@ -244,7 +251,7 @@ void LifecycleManager::cleanup_dead_objects() {
     managed_tiles.erase(tile_it, managed_tiles.end());
     
     if (tiles_removed > 0) {
-        SDL_Log("LifecycleManager: Removed %zu tiles from tracking", tiles_removed);
+        LOG_DEBUG(LIFECYCLE, "LifecycleManager: Removed %zu tiles from tracking", tiles_removed);
     }
 }
 
@@ -279,24 +286,24 @@ bool LifecycleManager::is_dying_or_dead(TileEntity* tile_entity) const {
 }
 
 void LifecycleManager::clear_all() {
-    SDL_Log("LifecycleManager: Clearing all managed objects and tiles");
+    LOG_INFO(LIFECYCLE, "LifecycleManager: Clearing all managed objects and tiles");
     
     // LifecycleManager OWNS the lifecycle - should handle deletion with protection
-    SDL_Log("LifecycleManager: Deleting %zu managed objects", managed_objects.size());
+    LOG_INFO(LIFECYCLE, "LifecycleManager: Deleting %zu managed objects", managed_objects.size());
     for (const auto& managed : managed_objects) {
         if (managed.object) {
             try {
                 // SDL_Log("LifecycleManager: Deleting object %p", managed.object);
                 delete managed.object;
             } catch (...) {
-                SDL_Log("ERROR: Exception during object deletion %p - continuing", managed.object);
+                LOG_ERROR(LIFECYCLE, "Exception during object deletion %p - continuing", managed.object);
             }
         }
     }
     managed_objects.clear();
     
     // Clear tiles (don't delete - Map owns them)
-    SDL_Log("LifecycleManager: Clearing %zu tile references (tiles owned by Map)", managed_tiles.size());
+    LOG_INFO(LIFECYCLE, "LifecycleManager: Clearing %zu tile references (tiles owned by Map)", managed_tiles.size());
     managed_tiles.clear();
 }
 
@@ -307,6 +314,17 @@ size_t LifecycleManager::get_active_object_count() const {
         });
 }
 
+LifecycleManager::QueueStats LifecycleManager::get_queue_stats() const {
+    QueueStats stats;
+    for (const auto& managed : managed_objects) {
+        stats.objects[static_cast<int>(managed.state)]++;
+    }
+    for (const auto& managed : managed_tiles) {
+        stats.tiles[static_cast<int>(managed.state)]++;
+    }
+    return stats;
+}
+
 size_t LifecycleManager::get_active_tile_count() const {
     return std::count_if(managed_tiles.begin(), managed_tiles.end(),
         [](const ManagedTile& managed) {
@@ -80,6 +80,12 @@ public:
     void clear_all();
     size_t get_active_object_count() const;
     size_t get_active_tile_count() const;
+    
+    struct QueueStats {
+        size_t objects[4] = {};  // Indexado por ObjectState
+        size_t tiles[4] = {};
+    };
+    QueueStats get_queue_stats() const;
 
 private:
     std::vector<ManagedObject> managed_objects;
@@ -0,0 +1,327 @@
+#include "Logger.h"
+#include <SDL3/SDL.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+namespace {
+    constexpr size_t QUEUE_CAPACITY = 4096;   // Potencia de 2
+    constexpr size_t MESSAGE_SIZE = 256;      // Mensajes más largos se truncan
+
+    struct LogSlot {
+        std::atomic<size_t> sequence;
+        LogLevel level;
+        LogCategory category;
+        uint32_t suppressed;
+        char text[MESSAGE_SIZE];
+    };
+
+    /**
+     * Cola acotada multi-productor / un consumidor (esquema de Vyukov):
+     * cada slot lleva un número de secuencia que indica si está libre o listo.
+     */
+    LogSlot queue_slots[QUEUE_CAPACITY];
+    std::atomic<size_t> enqueue_pos{0};
+    size_t dequeue_pos = 0;                   // Solo lo toca el hilo escritor (y shutdown tras el join)
+
+    std::thread writer_thread;
+    std::atomic<bool> writer_running{false};
+    std::atomic<int> producers_in_flight{0};  // Hilos dentro de write() con la cola activa
+    std::mutex wake_mutex;
+    std::condition_variable wake_cv;
+
+    std::atomic<uint64_t> written_count{0};
+    std::atomic<uint64_t> dropped_count{0};
+    std::atomic<uint64_t> suppressed_count{0};
+
+    const auto clock_epoch = std::chrono::steady_clock::now();
+
+    uint64_t now_ms() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - clock_epoch).count());
+    }
+
+    SDL_LogPriority to_sdl_priority(LogLevel level) {
+        switch (level) {
+            case LogLevel::WARNING: return SDL_LOG_PRIORITY_WARN;
+            case LogLevel::ERROR:   return SDL_LOG_PRIORITY_ERROR;
+            // TRACE/DEBUG ya pasaron nuestro filtro: no dejar que el de SDL los oculte
+            default:                return SDL_LOG_PRIORITY_INFO;
+        }
+    }
+
+    void emit(LogLevel level, LogCategory category, uint32_t suppressed, const char* text) {
+        if (suppressed > 0) {
+            SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, to_sdl_priority(level), "[%s] %s (+%u suppressed)",
+                           Logger::category_name(category), text, suppressed);
+        } else {
+            SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, to_sdl_priority(level), "[%s] %s",
+                           Logger::category_name(category), text);
+        }
+        written_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool try_enqueue(LogLevel level, LogCategory category, uint32_t suppressed, const char* fmt, va_list args) {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        LogSlot* slot;
+        for (;;) {
+            slot = &queue_slots[pos & (QUEUE_CAPACITY - 1)];
+            size_t seq = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Cola llena
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->level = level;
+        slot->category = category;
+        slot->suppressed = suppressed;
+        vsnprintf(slot->text, MESSAGE_SIZE, fmt, args);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool drain_one() {
+        LogSlot& slot = queue_slots[dequeue_pos & (QUEUE_CAPACITY - 1)];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq != dequeue_pos + 1) {
+            return false;
+        }
+
+        emit(slot.level, slot.category, slot.suppressed, slot.text);
+        slot.sequence.store(dequeue_pos + QUEUE_CAPACITY, std::memory_order_release);
+        dequeue_pos++;
+        return true;
+    }
+
+    void writer_loop() {
+        while (writer_running.load(std::memory_order_acquire)) {
+            if (!drain_one()) {
+                // Los productores no bloquean para despertarnos: sondeo con espera corta
+                std::unique_lock<std::mutex> lock(wake_mutex);
+                wake_cv.wait_for(lock, std::chrono::milliseconds(10));
+            }
+        }
+        while (drain_one()) {
+        }
+    }
+
+    bool parse_level(const std::string& text, LogLevel& out) {
+        static const char* names[] = {"trace", "debug", "info", "warning", "error"};
+        for (int i = 0; i < 5; i++) {
+            if (text == names[i]) {
+                out = static_cast<LogLevel>(i);
+                return true;
+            }
+        }
+        if (text == "warn") {
+            out = LogLevel::WARNING;
+            return true;
+        }
+        return false;
+    }
+}
+
+// INFO para todas las categorías hasta que init()/configure() digan otra cosa
+std::atomic<int> Logger::category_levels[static_cast<int>(LogCategory::COUNT)] = {
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+static_assert(static_cast<int>(LogCategory::COUNT) == 10, "Update the default level table");
+static_assert(static_cast<int>(LogLevel::INFO) == 2, "Default level table assumes INFO == 2");
+
+bool LogRateLimiter::allow(uint32_t& suppressed_out) {
+    uint64_t now = now_ms();
+    uint64_t start = window_start_ms.load(std::memory_order_relaxed);
+
+    if (now - start >= 1000) {
+        // Nueva ventana de un segundo; si otro hilo gana la carrera, usamos la suya
+        if (window_start_ms.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+            window_count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    if (window_count.fetch_add(1, std::memory_order_relaxed) < LOG_RATE_LIMIT_PER_SECOND) {
+        suppressed_out = suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    suppressed.fetch_add(1, std::memory_order_relaxed);
+    suppressed_count.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void Logger::init() {
+    if (writer_running.load()) {
+        return;
+    }
+
+    for (size_t i = 0; i < QUEUE_CAPACITY; i++) {
+        queue_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueue_pos.store(0, std::memory_order_relaxed);
+    dequeue_pos = 0;
+
+    const char* spec = std::getenv("CLANBOMBER_LOG");
+    if (spec) {
+        configure(spec);
+    }
+
+    writer_running.store(true, std::memory_order_release);
+    writer_thread = std::thread(writer_loop);
+}
+
+void Logger::shutdown() {
+    if (writer_running.exchange(false)) {
+        // Un productor que vio writer_running == true puede estar llenando un slot:
+        // esperarlo para que su mensaje quede publicado antes del drenado final
+        while (producers_in_flight.load() > 0) {
+            std::this_thread::yield();
+        }
+        wake_cv.notify_one();
+        if (writer_thread.joinable()) {
+            writer_thread.join();
+        }
+        // Sin hilo escritor dequeue_pos es nuestro: vaciar lo que quedó en la cola
+        while (drain_one()) {
+        }
+        size_t leftover = enqueue_pos.load() - dequeue_pos;
+        if (leftover > 0) {
+            dropped_count.fetch_add(leftover, std::memory_order_relaxed);
+        }
+    }
+    if (dropped_count.load() > 0 || suppressed_count.load() > 0) {
+        SDL_Log("Logger: %llu messages dropped (queue full), %llu suppressed by rate limiting",
+                (unsigned long long)dropped_count.load(), (unsigned long long)suppressed_count.load());
+    }
+}
+
+void Logger::set_level(LogCategory category, LogLevel level) {
+    if (category == LogCategory::COUNT) return;
+    category_levels[static_cast<int>(category)].store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+void Logger::set_level_all(LogLevel level) {
+    for (auto& entry : category_levels) {
+        entry.store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+}
+
+void Logger::configure(const char* spec) {
+    std::string text(spec ? spec : "");
+    size_t start = 0;
+
+    while (start <= text.size()) {
+        size_t end = text.find(',', start);
+        if (end == std::string::npos) end = text.size();
+        std::string token = text.substr(start, end - start);
+        start = end + 1;
+        if (token.empty()) continue;
+
+        LogLevel level;
+        size_t eq = token.find('=');
+        if (eq == std::string::npos) {
+            if (parse_level(token, level)) {
+                set_level_all(level);
+            } else {
+                SDL_Log("Logger: Unknown level '%s' in CLANBOMBER_LOG", token.c_str());
+            }
+            continue;
+        }
+
+        std::string name = token.substr(0, eq);
+        if (!parse_level(token.substr(eq + 1), level)) {
+            SDL_Log("Logger: Unknown level in '%s'", token.c_str());
+            continue;
+        }
+
+        bool found = false;
+        for (int i = 0; i < static_cast<int>(LogCategory::COUNT); i++) {
+            if (name == category_name(static_cast<LogCategory>(i))) {
+                set_level(static_cast<LogCategory>(i), level);
+                found = true;
+            }
+        }
+        if (!found) {
+            SDL_Log("Logger: Unknown category '%s' in CLANBOMBER_LOG", name.c_str());
+        }
+    }
+}
+
+void Logger::write(LogLevel level, LogCategory category, uint32_t suppressed, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+
+    // seq_cst frente al exchange de shutdown(): o vemos el escritor parado,
+    // o shutdown() nos ve en vuelo y espera a que publiquemos
+    producers_in_flight.fetch_add(1);
+    if (!writer_running.load()) {
+        producers_in_flight.fetch_sub(1);
+        // Sin hilo escritor (arranque/cierre): escritura directa
+        char text[MESSAGE_SIZE];
+        vsnprintf(text, sizeof(text), fmt, args);
+        emit(level, category, suppressed, text);
+    } else {
+        bool queued = try_enqueue(level, category, suppressed, fmt, args);
+        producers_in_flight.fetch_sub(1);
+        if (!queued) {
+            dropped_count.fetch_add(1, std::memory_order_relaxed);
+        } else if (level == LogLevel::ERROR) {
+            wake_cv.notify_one(); // Los errores salen cuanto antes
+        }
+    }
+
+    va_end(args);
+}
+
+uint64_t Logger::get_written_count() {
+    return written_count.load(std::memory_order_relaxed);
+}
+
+uint64_t Logger::get_dropped_count() {
+    return dropped_count.load(std::memory_order_relaxed);
+}
+
+uint64_t Logger::get_suppressed_count() {
+    return suppressed_count.load(std::memory_order_relaxed);
+}
+
+const char* Logger::level_name(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE:   return "trace";
+        case LogLevel::DEBUG:   return "debug";
+        case LogLevel::INFO:    return "info";
+        case LogLevel::WARNING: return "warning";
+        case LogLevel::ERROR:   return "error";
+    }
+    return "?";
+}
+
+const char* Logger::category_name(LogCategory category) {
+    switch (category) {
+        case LogCategory::CORE:      return "core";
+        case LogCategory::RENDER:    return "render";
+        case LogCategory::AUDIO:     return "audio";
+        case LogCategory::INPUT:     return "input";
+        case LogCategory::AI:        return "ai";
+        case LogCategory::GAME:      return "game";
+        case LogCategory::LIFECYCLE: return "lifecycle";
+        case LogCategory::MAP:       return "map";
+        case LogCategory::SPATIAL:   return "spatial";
+        case LogCategory::RESOURCE:  return "resource";
+        case LogCategory::COUNT:     break;
+    }
+    return "?";
+}
@@ -0,0 +1,131 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Sistema de logging asíncrono con filtros y rate limiting
+ *
+ * El hilo que loguea solo formatea el mensaje en un slot de una cola lock-free
+ * (MPSC acotada); un hilo escritor en segundo plano la vacía hacia SDL_LogMessage.
+ * Ningún hot path hace I/O síncrona.
+ *
+ * Filtros:
+ * - Compilación: CLANBOMBER_LOG_MIN_LEVEL (0=TRACE .. 4=ERROR) elimina las llamadas
+ *   por debajo del nivel.
+ * - Runtime: nivel mínimo por categoría. Por defecto INFO; configurable con la
+ *   variable de entorno CLANBOMBER_LOG, p.ej. "warning,lifecycle=debug,render=trace".
+ * - Rate limiting por call site: cada LOG_* admite LOG_RATE_LIMIT_PER_SECOND
+ *   mensajes por segundo; el resto se descarta y se informa como "(+N suppressed)"
+ *   en el siguiente mensaje que pase.
+ *
+ * Uso: LOG_INFO(RENDER, "Loaded %d textures", count);
+ */
+#ifndef CLANBOMBER_LOG_MIN_LEVEL
+#define CLANBOMBER_LOG_MIN_LEVEL 0
+#endif
+
+enum class LogLevel {
+    TRACE = 0,
+    DEBUG,
+    INFO,
+    WARNING,
+    ERROR
+};
+
+enum class LogCategory {
+    CORE = 0,
+    RENDER,
+    AUDIO,
+    INPUT,
+    AI,
+    GAME,
+    LIFECYCLE,
+    MAP,
+    SPATIAL,
+    RESOURCE,
+    COUNT
+};
+
+/**
+ * @brief Límite de mensajes por segundo de un call site concreto
+ */
+class LogRateLimiter {
+public:
+    static constexpr uint32_t LOG_RATE_LIMIT_PER_SECOND = 20;
+
+    /**
+     * @return true si el mensaje debe emitirse; suppressed_out recibe cuántos
+     *         mensajes de este call site se descartaron desde el último emitido
+     */
+    bool allow(uint32_t& suppressed_out);
+
+private:
+    std::atomic<uint64_t> window_start_ms{0};
+    std::atomic<uint32_t> window_count{0};
+    std::atomic<uint32_t> suppressed{0};
+};
+
+class Logger {
+public:
+    /**
+     * @brief Arranca el hilo escritor y lee CLANBOMBER_LOG
+     * Antes de init() y después de shutdown() los mensajes se escriben de forma síncrona.
+     */
+    static void init();
+
+    /**
+     * @brief Vacía la cola y detiene el hilo escritor
+     */
+    static void shutdown();
+
+    static bool is_enabled(LogCategory category, LogLevel level) {
+        return static_cast<int>(level) >=
+               category_levels[static_cast<int>(category)].load(std::memory_order_relaxed);
+    }
+
+    static void set_level(LogCategory category, LogLevel level);
+    static void set_level_all(LogLevel level);
+
+    /**
+     * @brief Aplica una configuración "nivel,categoria=nivel,..." (formato de CLANBOMBER_LOG)
+     */
+    static void configure(const char* spec);
+
+    static void write(LogLevel level, LogCategory category, uint32_t suppressed, const char* fmt, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 4, 5)))
+#endif
+        ;
+
+    // Estadísticas (para overlays de depuración)
+    static uint64_t get_written_count();
+    static uint64_t get_dropped_count();     // Cola llena
+    static uint64_t get_suppressed_count();  // Rate limiting
+
+    static const char* level_name(LogLevel level);
+    static const char* category_name(LogCategory category);
+
+private:
+    static std::atomic<int> category_levels[static_cast<int>(LogCategory::COUNT)];
+};
+
+#define CLANBOMBER_LOG(level, category, ...) \
+    do { \
+        if (static_cast<int>(level) >= CLANBOMBER_LOG_MIN_LEVEL && Logger::is_enabled(category, level)) { \
+            static LogRateLimiter clanbomber_log_limiter; \
+            uint32_t clanbomber_log_suppressed = 0; \
+            if (clanbomber_log_limiter.allow(clanbomber_log_suppressed)) { \
+                Logger::write(level, category, clanbomber_log_suppressed, __VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define LOG_TRACE(category, ...) CLANBOMBER_LOG(LogLevel::TRACE, LogCategory::category, __VA_ARGS__)
+#define LOG_DEBUG(category, ...) CLANBOMBER_LOG(LogLevel::DEBUG, LogCategory::category, __VA_ARGS__)
+#define LOG_INFO(category, ...)  CLANBOMBER_LOG(LogLevel::INFO, LogCategory::category, __VA_ARGS__)
+#define LOG_WARN(category, ...)  CLANBOMBER_LOG(LogLevel::WARNING, LogCategory::category, __VA_ARGS__)
+#define LOG_ERROR(category, ...) CLANBOMBER_LOG(LogLevel::ERROR, LogCategory::category, __VA_ARGS__)
+
+#endif
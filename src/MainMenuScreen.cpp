@@ -1,4 +1,5 @@
 #include "MainMenuScreen.h"
+#include "Logger.h"
 #include "Resources.h"
 #include "TextRenderer.h"
 #include "GameContext.h"
@@ -21,7 +22,7 @@ MainMenuScreen::MainMenuScreen(TextRenderer* text_renderer, GameContext* game_co
     if (Controller_Joystick::get_joystick_count() > 0) {
         menu_joystick = new Controller_Joystick(0);
         menu_joystick->activate();
-        SDL_Log("MainMenuScreen: Created joystick controller for menu navigation");
+        LOG_INFO(INPUT, "MainMenuScreen: Created joystick controller for menu navigation");
     }
 }
 
@@ -1,13 +1,14 @@
 #include "Map.h"
+#include "Logger.h"
 #include "MapTile.h"
 #include "TileEntity.h"
 #include "MapTile_Pure.h"
 #include "MapEntry.h"
+#include "MapIndex.h"
 #include "GameContext.h"
 #include "CoordinateSystem.h"
+#include "GameRandom.h"
 #include <algorithm>
-#include <random>
-#include <filesystem>
 #include <SDL3/SDL.h>
 
 // Import CoordinateConfig constants for refactoring Phase 1
@@ -18,13 +19,8 @@ Map::Map(GameContext* _context) {
     current_map_index = 0;
     current_map = nullptr;
     
-    // Initialize both arrays
-    for (int x = 0; x < MAP_WIDTH; x++) {
-        for (int y = 0; y < MAP_HEIGHT; y++) {
-            maptiles[x][y] = nullptr;  // Legacy compatibility
-            tile_entities[x][y] = nullptr;  // NEW: TileEntity storage
-        }
-    }
+    // Classic arena until a map is loaded
+    resize(CoordinateConfig::MIN_GRID_WIDTH, CoordinateConfig::MIN_GRID_HEIGHT);
     
     enumerate_maps();
 }
@@ -32,39 +28,14 @@ Map::Map(GameContext* _context) {
 Map::~Map() {
     clear();
     
-    // Clean up map list
-    for (auto& map_entry : map_list) {
-        delete map_entry;
-    }
+    // Entries belong to MapIndex and outlive this round
     map_list.clear();
 }
 
 void Map::enumerate_maps() {
-    map_list.clear();
-    
-    std::filesystem::path maps_dir = "data/maps";
-    if (!std::filesystem::exists(maps_dir)) {
-        SDL_Log("Maps directory not found: %s", maps_dir.string().c_str());
-        return;
-    }
-    
-    for (const auto& entry : std::filesystem::directory_iterator(maps_dir)) {
-        if (entry.is_regular_file() && entry.path().extension() == ".map") {
-            MapEntry* map_entry = new MapEntry(entry.path().string());
-            if (map_entry->load()) {
-                map_list.push_back(map_entry);
-            } else {
-                delete map_entry;
-            }
-        }
-    }
-    
-    if (map_list.empty()) {
-        SDL_Log("No valid maps found");
-    } else {
-        SDL_Log("Found %zu maps", map_list.size());
-        current_map = map_list[0];
-    }
+    // Built once per process from the on-disk index; bodies load when a map is picked
+    map_list = MapIndex::get_maps();
+    current_map = map_list.empty() ? nullptr : map_list[0];
 }
 
 void Map::load() {
@@ -78,20 +49,23 @@ void Map::load() {
 
 void Map::clear() {
     // Clear legacy tiles
-    for (int x = 0; x < MAP_WIDTH; x++) {
-        for (int y = 0; y < MAP_HEIGHT; y++) {
-            if (maptiles[x][y]) {
-                delete maptiles[x][y];
-                maptiles[x][y] = nullptr;
-            }
-            
-            // Clear TileEntity (registered with LifecycleManager, don't delete directly)
-            if (tile_entities[x][y]) {
-                // TileEntity cleanup handled by LifecycleManager
-                tile_entities[x][y] = nullptr;
-            }
-        }
+    for (MapTile*& tile : maptiles) {
+        delete tile;
+        tile = nullptr;
     }
+    
+    // Clear TileEntity (registered with LifecycleManager, don't delete directly)
+    std::fill(tile_entities.begin(), tile_entities.end(), nullptr);
+}
+
+void Map::resize(int new_width, int new_height) {
+    width = new_width;
+    height = new_height;
+    maptiles.assign((size_t)width * height, nullptr);
+    tile_entities.assign((size_t)width * height, nullptr);
+    
+    // Grid validity, clamping and the per-system grids all follow the loaded map
+    CoordinateConfig::set_grid_size(width, height);
 }
 
 void Map::reload() {
@@ -99,10 +73,15 @@ void Map::reload() {
     
     clear();
     
-    SDL_Log("Map: Loading with NEW TileEntity architecture");
+    if (!current_map->load()) {
+        LOG_WARN(MAP, "Map: '%s' could not be read, using an empty arena", current_map->get_name().c_str());
+    }
+    resize(current_map->get_width(), current_map->get_height());
+    
+    LOG_INFO(MAP, "Map: Loading with NEW TileEntity architecture");
     
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-        for (int x = 0; x < MAP_WIDTH; x++) {
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
             char tile_char = current_map->get_data(x, y);
             
             MapTile_Pure::TILE_TYPE tile_type;
@@ -122,7 +101,7 @@ void Map::reload() {
                     break;
                 case 'R':
                     // Random box
-                    tile_type = (rand() % 3) ? MapTile_Pure::BOX : MapTile_Pure::GROUND;
+                    tile_type = GameRandom::next_int(3) ? MapTile_Pure::BOX : MapTile_Pure::GROUND;
                     break;
                 default:
                     tile_type = MapTile_Pure::GROUND;
@@ -131,22 +110,23 @@ void Map::reload() {
             
             // Create NEW architecture: MapTile_Pure + TileEntity
             MapTile_Pure* tile_data = MapTile_Pure::create(tile_type, x, y);
+            size_t index = index_of(x, y);
             
             if (tile_type == MapTile_Pure::BOX) {
                 // Use specialized TileEntity_Box for box tiles
-                tile_entities[x][y] = new TileEntity_Box(tile_data, context);
+                tile_entities[index] = new TileEntity_Box(tile_data, context);
             } else {
                 // Use base TileEntity for other tiles
-                tile_entities[x][y] = new TileEntity(tile_data, context);
+                tile_entities[index] = new TileEntity(tile_data, context);
             }
             
             // Register TileEntity with GameContext (LifecycleManager + render list)
             if (context) {
-                context->register_object(tile_entities[x][y]);
+                context->register_object(tile_entities[index]);
             }
             
             // Legacy compatibility: also create old MapTile
-            maptiles[x][y] = MapTile::create(
+            maptiles[index] = MapTile::create(
                 tile_type == MapTile_Pure::GROUND ? MapTile::GROUND :
                 tile_type == MapTile_Pure::WALL ? MapTile::WALL :
                 MapTile::BOX, 
@@ -154,7 +134,7 @@ void Map::reload() {
         }
     }
     
-    SDL_Log("Map: Created %d TileEntities with new architecture", MAP_WIDTH * MAP_HEIGHT);
+    LOG_INFO(MAP, "Map: Created %d TileEntities (%dx%d) with new architecture", width * height, width, height);
 }
 
 void Map::show() {
@@ -162,12 +142,10 @@ void Map::show() {
     // No need to render here - TileEntities are in app->objects and render automatically
     
     // Legacy compatibility: still show old tiles if needed
-    for (int x = 0; x < MAP_WIDTH; x++) {
-        for (int y = 0; y < MAP_HEIGHT; y++) {
-            if (maptiles[x][y] && !tile_entities[x][y]) {
-                // Only show legacy tiles if no TileEntity exists
-                maptiles[x][y]->show();
-            }
+    for (size_t i = 0; i < maptiles.size(); i++) {
+        if (maptiles[i] && !tile_entities[i]) {
+            // Only show legacy tiles if no TileEntity exists
+            maptiles[i]->show();
         }
     }
 }
@@ -175,55 +153,55 @@ void Map::show() {
 // === PURE GRID MANAGER FUNCTIONS ===
 
 MapTile* Map::get_tile(int tx, int ty) {
-    if (tx >= 0 && tx < MAP_WIDTH && ty >= 0 && ty < MAP_HEIGHT) {
-        return maptiles[tx][ty];
+    if (in_bounds(tx, ty)) {
+        return maptiles[index_of(tx, ty)];
     }
     return nullptr;
 }
 
 TileEntity* Map::get_tile_entity(int tx, int ty) {
-    if (tx >= 0 && tx < MAP_WIDTH && ty >= 0 && ty < MAP_HEIGHT) {
-        return tile_entities[tx][ty];
+    if (in_bounds(tx, ty)) {
+        return tile_entities[index_of(tx, ty)];
     }
     return nullptr;
 }
 
 void Map::set_tile(int tx, int ty, MapTile* tile) {
-    if (tx < 0 || tx >= MAP_WIDTH || ty < 0 || ty >= MAP_HEIGHT) {
-        SDL_Log("Map::set_tile() - Invalid position (%d,%d)", tx, ty);
+    if (!in_bounds(tx, ty)) {
+        LOG_WARN(MAP, "Map::set_tile() - Invalid position (%d,%d)", tx, ty);
         return;
     }
     
-    SDL_Log("Map: Setting legacy tile at (%d,%d) to %p", tx, ty, tile);
-    maptiles[tx][ty] = tile;
+    LOG_DEBUG(MAP, "Map: Setting legacy tile at (%d,%d) to %p", tx, ty, tile);
+    maptiles[index_of(tx, ty)] = tile;
 }
 
 void Map::set_tile_entity(int tx, int ty, TileEntity* tile_entity) {
-    if (tx < 0 || tx >= MAP_WIDTH || ty < 0 || ty >= MAP_HEIGHT) {
-        SDL_Log("Map::set_tile_entity() - Invalid position (%d,%d)", tx, ty);
+    if (!in_bounds(tx, ty)) {
+        LOG_WARN(MAP, "Map::set_tile_entity() - Invalid position (%d,%d)", tx, ty);
         return;
     }
     
-    SDL_Log("Map: Setting TileEntity at (%d,%d) to %p", tx, ty, tile_entity);
-    tile_entities[tx][ty] = tile_entity;
+    LOG_DEBUG(MAP, "Map: Setting TileEntity at (%d,%d) to %p", tx, ty, tile_entity);
+    tile_entities[index_of(tx, ty)] = tile_entity;
 }
 
 void Map::clear_tile_entity_at(int tx, int ty) {
-    if (tx < 0 || tx >= MAP_WIDTH || ty < 0 || ty >= MAP_HEIGHT) {
-        SDL_Log("Map::clear_tile_entity_at() - Invalid position (%d,%d)", tx, ty);
+    if (!in_bounds(tx, ty)) {
+        LOG_WARN(MAP, "Map::clear_tile_entity_at() - Invalid position (%d,%d)", tx, ty);
         return;
     }
     
-    if (tile_entities[tx][ty]) {
-        SDL_Log("Map: Clearing TileEntity pointer at (%d,%d) - was %p", tx, ty, tile_entities[tx][ty]);
-        tile_entities[tx][ty] = nullptr;
+    if (tile_entities[index_of(tx, ty)]) {
+        LOG_DEBUG(MAP, "Map: Clearing TileEntity pointer at (%d,%d) - was %p", tx, ty, tile_entities[index_of(tx, ty)]);
+        tile_entities[index_of(tx, ty)] = nullptr;
     }
 }
 
 void Map::load_random_valid() {
     if (map_list.empty()) return;
     
-    current_map_index = rand() % map_list.size();
+    current_map_index = GameRandom::next_int(static_cast<int>(map_list.size()));
     current_map = map_list[current_map_index];
     reload();
 }
@@ -241,6 +219,19 @@ void Map::load_next_valid(int map_nr) {
     reload();
 }
 
+bool Map::load_by_name(const std::string& name) {
+    for (size_t i = 0; i < map_list.size(); i++) {
+        if (map_list[i]->get_name() == name) {
+            current_map_index = static_cast<int>(i);
+            current_map = map_list[i];
+            reload();
+            return true;
+        }
+    }
+    LOG_WARN(MAP, "Map: no map named '%s'", name.c_str());
+    return false;
+}
+
 void Map::act() {
     // Map is now a PURE GRID MANAGER - NO coordination logic!
     // TileManager handles ALL coordination between systems
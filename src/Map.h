@@ -5,9 +5,6 @@
 #include <string>
 #include "UtilsCL_Vector.h"
 
-#define MAP_WIDTH 20
-#define MAP_HEIGHT 15
-
 class MapTile;
 class TileEntity;
 class MapTile_Pure;
@@ -23,6 +20,7 @@ public:
     void load();
     void load_random_valid();
     void load_next_valid(int map_nr = -1);
+    bool load_by_name(const std::string& name);  // Repeticiones: el mapa se guarda por nombre
     void show();
     void act();
     void refresh_holes();
@@ -36,6 +34,10 @@ public:
     void clear_tile_entity_at(int tx, int ty);  // NEW: Clear TileEntity pointer (for use-after-free fix)
     CL_Vector get_bomber_pos(int nr);
     
+    // Tamaño del mapa cargado en casillas (como mínimo el clásico 20x15)
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+    
     bool any_valid_map();
     int get_map_count();
     std::string get_name();
@@ -44,16 +46,20 @@ public:
 private:
     GameContext* context;
     
-    // NUEVO: Dual storage para transición
-    MapTile* maptiles[MAP_WIDTH][MAP_HEIGHT];  // Legacy storage
-    TileEntity* tile_entities[MAP_WIDTH][MAP_HEIGHT];  // NEW: TileEntity storage
-    std::vector<MapEntry*> map_list;
+    // NUEVO: Dual storage para transición, fila a fila: [y * width + x]
+    int width, height;
+    std::vector<MapTile*> maptiles;  // Legacy storage
+    std::vector<TileEntity*> tile_entities;  // NEW: TileEntity storage
+    std::vector<MapEntry*> map_list;  // Propiedad de MapIndex
     MapEntry* current_map;
     int current_map_index;
     
     void enumerate_maps();
     void clear();
     void reload();
+    void resize(int new_width, int new_height);
+    bool in_bounds(int tx, int ty) const { return tx >= 0 && tx < width && ty >= 0 && ty < height; }
+    size_t index_of(int tx, int ty) const { return (size_t)ty * width + tx; }
 };
 
 #endif
\ No newline at end of file
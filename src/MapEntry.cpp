@@ -17,74 +17,214 @@
  */
 
 #include "MapEntry.h"
+#include "CoordinateSystem.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <iterator>
 #include <SDL3/SDL.h>
 
+namespace {
+    const size_t BINARY_HEADER_SIZE = 4 + 1 + 1 + 2; // magic, version, max players, author length
+
+    bool read_file(const std::string& filename, std::string& contents, std::streamoff offset = 0) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.seekg(offset);
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return !file.bad();
+    }
+
+    uint64_t fnv1a(const std::string& bytes) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : bytes) {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+        return hash;
+    }
+}
+
 MapEntry::MapEntry(const std::string& _filename) : filename(_filename) {
     enabled = true;
     max_players = 8;
+    binary = false;
+    loaded = false;
+    hash = 0;
+    body_offset = 0;
+    width = 0;
+    height = 0;
     
     // Extract map name from filename
     std::filesystem::path path(filename);
     name = path.stem().string();
+    binary = path.extension() == ".cbm";
     author = "Unknown";
     
-    // Initialize map data
-    for (int x = 0; x < MAP_WIDTH; x++) {
-        for (int y = 0; y < MAP_HEIGHT; y++) {
-            map_data[x][y] = ' ';
-        }
-    }
+    // Empty classic arena until the body is read
+    resize_grid(0, 0);
 }
 
 MapEntry::~MapEntry() {
 }
 
-bool MapEntry::load() {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        SDL_Log("Failed to open map file: %s", filename.c_str());
+bool MapEntry::load_header() {
+    std::string contents;
+    if (!read_file(filename, contents)) {
+        LOG_WARN(MAP, "Failed to open map file: %s", filename.c_str());
         return false;
     }
+    hash = fnv1a(contents);
     
-    std::string line;
-    int line_num = 0;
-    
-    // Read author (first line)
-    if (std::getline(file, line)) {
-        author = line;
-        line_num++;
+    if (binary) {
+        if (contents.size() < BINARY_HEADER_SIZE || memcmp(contents.data(), BINARY_MAGIC, 4) != 0 ||
+            (uint8_t)contents[4] != BINARY_VERSION) {
+            LOG_WARN(MAP, "Not a version %d binary map: %s", BINARY_VERSION, filename.c_str());
+            return false;
+        }
+        max_players = (uint8_t)contents[5];
+        size_t author_length = (uint8_t)contents[6] | ((uint8_t)contents[7] << 8);
+        if (contents.size() < BINARY_HEADER_SIZE + author_length) {
+            LOG_WARN(MAP, "Truncated binary map: %s", filename.c_str());
+            return false;
+        }
+        author = contents.substr(BINARY_HEADER_SIZE, author_length);
+        body_offset = (uint32_t)(BINARY_HEADER_SIZE + author_length);
+    } else {
+        // Author and max players on the first two lines; the tiles start after them
+        size_t author_end = contents.find('\n');
+        size_t players_end = author_end == std::string::npos ? std::string::npos : contents.find('\n', author_end + 1);
+        if (players_end == std::string::npos) {
+            LOG_WARN(MAP, "Map file has no tile rows: %s", filename.c_str());
+            return false;
+        }
+        author = contents.substr(0, author_end);
+        if (!author.empty() && author.back() == '\r') {
+            author.pop_back();
+        }
+        max_players = (int)std::strtol(contents.c_str() + author_end + 1, nullptr, 10);
+        body_offset = (uint32_t)(players_end + 1);
     }
-    
-    // Read max players (second line)  
-    if (std::getline(file, line)) {
-        max_players = std::stoi(line);
-        line_num++;
+    if (max_players < 1 || max_players > 8) {
+        LOG_WARN(MAP, "Map %s declares %d players, using 8", name.c_str(), max_players);
+        max_players = 8;
     }
-    
-    // Read map data
-    int y = 0;
-    while (std::getline(file, line) && y < MAP_HEIGHT) {
-        for (int x = 0; x < MAP_WIDTH && x < (int)line.length(); x++) {
-            map_data[x][y] = line[x];
-        }
-        y++;
-        line_num++;
+    return true;
+}
+
+void MapEntry::set_header(const std::string& _author, int _max_players, uint64_t _hash, uint32_t _body_offset) {
+    author = _author;
+    max_players = _max_players;
+    hash = _hash;
+    body_offset = _body_offset;
+}
+
+bool MapEntry::load() {
+    if (loaded) {
+        return true;
     }
-    
-    file.close();
+    std::string body;
+    if (!read_file(filename, body, body_offset)) {
+        LOG_WARN(MAP, "Failed to open map file: %s", filename.c_str());
+        return false;
+    }
+    if (!(binary ? parse_binary_body(body) : parse_text_body(body))) {
+        LOG_WARN(MAP, "Malformed map body: %s", filename.c_str());
+        return false;
+    }
+    loaded = true;
     
     // Read bomber positions
     read_bomber_positions();
     
-    SDL_Log("Loaded map: %s by %s (max %d players)", name.c_str(), author.c_str(), max_players);
+    LOG_INFO(MAP, "Loaded map: %s by %s (max %d players)", name.c_str(), author.c_str(), max_players);
     return true;
 }
 
+void MapEntry::resize_grid(int file_width, int file_height) {
+    width = std::min(std::max(file_width, CoordinateConfig::MIN_GRID_WIDTH), CoordinateConfig::MAX_GRID_WIDTH);
+    height = std::min(std::max(file_height, CoordinateConfig::MIN_GRID_HEIGHT), CoordinateConfig::MAX_GRID_HEIGHT);
+    map_data.assign((size_t)width * height, ' ');
+}
+
+bool MapEntry::parse_text_body(const std::string& body) {
+    // First pass sizes the grid, second pass copies the rows into it
+    std::vector<std::pair<size_t, size_t>> rows;
+    size_t widest = 0;
+    size_t line_start = 0;
+    while (line_start < body.size() && (int)rows.size() < CoordinateConfig::MAX_GRID_HEIGHT) {
+        size_t line_end = body.find('\n', line_start);
+        if (line_end == std::string::npos) {
+            line_end = body.size();
+        }
+        size_t length = line_end - line_start;
+        if (length > 0 && body[line_end - 1] == '\r') {
+            length--;
+        }
+        rows.emplace_back(line_start, length);
+        widest = std::max(widest, length);
+        line_start = line_end + 1;
+    }
+    if (rows.empty()) {
+        return false;
+    }
+    resize_grid((int)std::min(widest, (size_t)CoordinateConfig::MAX_GRID_WIDTH), (int)rows.size());
+    for (int y = 0; y < (int)rows.size(); y++) {
+        size_t row_width = std::min(rows[y].second, (size_t)width);
+        std::copy_n(body.begin() + rows[y].first, row_width, map_data.begin() + (size_t)y * width);
+    }
+    return true;
+}
+
+bool MapEntry::parse_binary_body(const std::string& body) {
+    if (body.size() < 4) {
+        return false;
+    }
+    int file_width = (uint8_t)body[0] | ((uint8_t)body[1] << 8);
+    int file_height = (uint8_t)body[2] | ((uint8_t)body[3] << 8);
+    if (file_width == 0 || file_height == 0 || body.size() < 4 + (size_t)file_width * file_height) {
+        return false;
+    }
+    resize_grid(file_width, file_height);
+    int copy_width = std::min(file_width, width);
+    int copy_height = std::min(file_height, height);
+    for (int y = 0; y < copy_height; y++) {
+        std::copy_n(body.begin() + 4 + (size_t)y * file_width, copy_width, map_data.begin() + (size_t)y * width);
+    }
+    return true;
+}
+
+bool MapEntry::save_binary(const std::string& path) {
+    if (!load()) {
+        return false;
+    }
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_WARN(MAP, "Cannot write binary map: %s", path.c_str());
+        return false;
+    }
+    size_t author_length = std::min(author.size(), (size_t)0xFFFF);
+    const char header[BINARY_HEADER_SIZE] = {
+        BINARY_MAGIC[0], BINARY_MAGIC[1], BINARY_MAGIC[2], BINARY_MAGIC[3],
+        (char)BINARY_VERSION, (char)max_players,
+        (char)(author_length & 0xFF), (char)(author_length >> 8)
+    };
+    file.write(header, sizeof(header));
+    file.write(author.data(), (std::streamsize)author_length);
+    
+    const char size[4] = {(char)(width & 0xFF), (char)(width >> 8), (char)(height & 0xFF), (char)(height >> 8)};
+    file.write(size, sizeof(size));
+    file.write(map_data.data(), (std::streamsize)map_data.size());
+    return (bool)file;
+}
+
 char MapEntry::get_data(int x, int y) {
-    if (x >= 0 && x < MAP_WIDTH && y >= 0 && y < MAP_HEIGHT) {
-        return map_data[x][y];
+    if (x >= 0 && x < width && y >= 0 && y < height) {
+        return map_data[(size_t)y * width + x];
     }
     return '*'; // Wall by default for out of bounds
 }
@@ -92,9 +232,9 @@ char MapEntry::get_data(int x, int y) {
 void MapEntry::read_bomber_positions() {
     bomber_positions.clear();
     
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-        for (int x = 0; x < MAP_WIDTH; x++) {
-            char tile = map_data[x][y];
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            char tile = map_data[(size_t)y * width + x];
             // Check for numbered bomber positions (0-7)
             if (tile >= '0' && tile <= '7') {
                 bomber_positions.push_back(CL_Vector(x, y));
@@ -19,23 +19,48 @@
 #ifndef MAPENTRY_H
 #define MAPENTRY_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "UtilsCL_Vector.h"
 
-#define MAP_WIDTH 20
-#define MAP_HEIGHT 15
-
+/**
+ * @brief Un mapa instalado: cabecera siempre, cuerpo solo al seleccionarlo
+ *
+ * Formatos:
+ *   .map  texto: autor, jugadores máximos, y una línea por fila de casillas
+ *   .cbm  binario: "CBMP", versión, jugadores, autor (u16 + bytes),
+ *         y como cuerpo ancho y alto (u16 cada uno) y las casillas fila a fila
+ * body_offset apunta al cuerpo en ambos casos, así MapIndex puede guardar
+ * la cabecera en disco y load() leer solo lo que falta.
+ *
+ * El tamaño sale del fichero (hasta MAX_GRID_WIDTH x MAX_GRID_HEIGHT); los
+ * mapas más pequeños que el clásico 20x15 se rellenan con suelo hasta él.
+ */
 class MapEntry {
 public:
+    static constexpr char BINARY_MAGIC[4] = {'C', 'B', 'M', 'P'};
+    static constexpr uint8_t BINARY_VERSION = 2;
+    
     MapEntry(const std::string& filename);
     ~MapEntry();
     
-    bool load();
+    bool load_header();
+    void set_header(const std::string& author, int max_players, uint64_t hash, uint32_t body_offset);
+    bool load();        // Lee el cuerpo la primera vez; después no hace nada
+    bool is_loaded() const { return loaded; }
+    bool save_binary(const std::string& path);
+    
     char get_data(int x, int y);
+    int get_width() const { return width; }
+    int get_height() const { return height; }
     std::string get_name() const { return name; }
     std::string get_author() const { return author; }
     int get_max_players() const { return max_players; }
+    const std::string& get_filename() const { return filename; }
+    uint64_t get_hash() const { return hash; }       // FNV-1a del fichero completo
+    uint32_t get_body_offset() const { return body_offset; }
+    bool is_binary() const { return binary; }
     bool is_enabled() const { return enabled; }
     void enable() { enabled = true; }
     void disable() { enabled = false; }
@@ -49,8 +74,17 @@ private:
     std::string author;
     int max_players;
     bool enabled;
-    char map_data[MAP_WIDTH][MAP_HEIGHT];
+    bool binary;
+    bool loaded;
+    uint64_t hash;
+    uint32_t body_offset;
+    int width, height;
+    std::vector<char> map_data;     // Fila a fila: map_data[y * width + x]
     std::vector<CL_Vector> bomber_positions;
+    
+    bool parse_text_body(const std::string& body);
+    bool parse_binary_body(const std::string& body);
+    void resize_grid(int file_width, int file_height);
 };
 
 #endif
\ No newline at end of file
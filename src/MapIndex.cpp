@@ -0,0 +1,197 @@
+#include "MapIndex.h"
+#include "MapEntry.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+std::vector<std::unique_ptr<MapEntry>> MapIndex::entries;
+std::vector<MapEntry*> MapIndex::maps;
+bool MapIndex::built = false;
+
+namespace {
+    const char* CACHE_FILE_NAME = "maps.idx";
+
+    // Native byte order: the cache is only read back on the machine that wrote it
+    template <typename T>
+    void write_value(std::ofstream& file, T value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    template <typename T>
+    bool read_value(std::ifstream& file, T& value) {
+        return (bool)file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    }
+
+    void write_string(std::ofstream& file, const std::string& text) {
+        uint16_t length = (uint16_t)std::min(text.size(), (size_t)0xFFFF);
+        write_value(file, length);
+        file.write(text.data(), length);
+    }
+
+    bool read_string(std::ifstream& file, std::string& text) {
+        uint16_t length;
+        if (!read_value(file, length)) {
+            return false;
+        }
+        text.resize(length);
+        return (bool)file.read(&text[0], length);
+    }
+}
+
+const std::vector<MapEntry*>& MapIndex::get_maps() {
+    if (!built) {
+        rebuild();
+    }
+    return maps;
+}
+
+MapEntry* MapIndex::find(const std::string& name) {
+    const std::vector<MapEntry*>& sorted = get_maps();
+    auto it = std::lower_bound(sorted.begin(), sorted.end(), name,
+                               [](const MapEntry* entry, const std::string& key) { return entry->get_name() < key; });
+    if (it != sorted.end() && (*it)->get_name() == name) {
+        return *it;
+    }
+    return nullptr;
+}
+
+std::filesystem::path MapIndex::get_maps_directory() {
+    return "data/maps";
+}
+
+void MapIndex::rebuild() {
+    PROFILE_ZONE("MapIndex::rebuild");
+    entries.clear();
+    maps.clear();
+    built = true;
+
+    std::filesystem::path maps_dir = get_maps_directory();
+    std::error_code error;
+    if (!std::filesystem::exists(maps_dir, error)) {
+        LOG_WARN(MAP, "Maps directory not found: %s", maps_dir.string().c_str());
+        return;
+    }
+
+    // One file per map name: a converted .cbm replaces its .map
+    std::unordered_map<std::string, std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(maps_dir, error)) {
+        std::filesystem::path extension = entry.path().extension();
+        if (!entry.is_regular_file(error) || (extension != ".map" && extension != ".cbm")) {
+            continue;
+        }
+        std::string name = entry.path().stem().string();
+        auto it = files.find(name);
+        if (it == files.end() || extension == ".cbm") {
+            files[name] = entry.path();
+        }
+    }
+
+    std::filesystem::path cache_path = maps_dir / CACHE_FILE_NAME;
+    std::unordered_map<std::string, CachedHeader> cache;
+    load_cache(cache_path, cache);
+    std::unordered_map<std::string, CachedHeader> fresh;
+    size_t parsed = 0;
+
+    for (const auto& pair : files) {
+        const std::filesystem::path& path = pair.second;
+        uint64_t file_size = std::filesystem::file_size(path, error);
+        if (error) {
+            continue;
+        }
+        int64_t modified = (int64_t)std::filesystem::last_write_time(path, error).time_since_epoch().count();
+
+        auto map_entry = std::make_unique<MapEntry>(path.string());
+        std::string key = path.filename().string();
+        auto cached = cache.find(key);
+        if (cached != cache.end() && cached->second.file_size == file_size && cached->second.modified == modified) {
+            const CachedHeader& header = cached->second;
+            map_entry->set_header(header.author, header.max_players, header.hash, header.body_offset);
+            fresh[key] = header;
+        } else {
+            if (!map_entry->load_header()) {
+                // A binary of an older format version: fall back to its text source
+                std::filesystem::path text_path = path;
+                text_path.replace_extension(".map");
+                if (path.extension() != ".cbm" || !std::filesystem::exists(text_path, error)) {
+                    continue;
+                }
+                map_entry = std::make_unique<MapEntry>(text_path.string());
+                if (!map_entry->load_header()) {
+                    continue;
+                }
+                key = text_path.filename().string();
+                file_size = std::filesystem::file_size(text_path, error);
+                modified = (int64_t)std::filesystem::last_write_time(text_path, error).time_since_epoch().count();
+            }
+            fresh[key] = {file_size, modified, map_entry->get_hash(), map_entry->get_body_offset(),
+                          map_entry->get_max_players(), map_entry->get_author()};
+            parsed++;
+        }
+        maps.push_back(map_entry.get());
+        entries.push_back(std::move(map_entry));
+    }
+
+    std::sort(maps.begin(), maps.end(),
+              [](const MapEntry* a, const MapEntry* b) { return a->get_name() < b->get_name(); });
+
+    // Rewrite only when a map was added, changed or removed
+    if (parsed > 0 || fresh.size() != cache.size()) {
+        save_cache(cache_path, fresh);
+    }
+
+    if (maps.empty()) {
+        LOG_INFO(MAP, "No valid maps found");
+    } else {
+        LOG_INFO(MAP, "MapIndex: %zu maps (%zu headers parsed, %zu from %s)", maps.size(), parsed,
+                 maps.size() - parsed, cache_path.string().c_str());
+    }
+}
+
+void MapIndex::load_cache(const std::filesystem::path& path, std::unordered_map<std::string, CachedHeader>& cache) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+    char magic[4];
+    uint32_t version = 0, count = 0;
+    if (!file.read(magic, sizeof(magic)) || memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 ||
+        !read_value(file, version) || version != CACHE_VERSION || !read_value(file, count)) {
+        LOG_DEBUG(MAP, "MapIndex: ignoring stale cache %s", path.string().c_str());
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        std::string key;
+        CachedHeader header;
+        if (!read_string(file, key) || !read_value(file, header.file_size) || !read_value(file, header.modified) ||
+            !read_value(file, header.hash) || !read_value(file, header.body_offset) ||
+            !read_value(file, header.max_players) || !read_string(file, header.author)) {
+            // Truncated: whatever did not make it is simply parsed again
+            return;
+        }
+        cache[key] = header;
+    }
+}
+
+void MapIndex::save_cache(const std::filesystem::path& path, const std::unordered_map<std::string, CachedHeader>& cache) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        // Read-only install: the index is rebuilt from headers on every start, which is still cheap
+        LOG_DEBUG(MAP, "MapIndex: cannot write %s", path.string().c_str());
+        return;
+    }
+    file.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    write_value(file, CACHE_VERSION);
+    write_value(file, (uint32_t)cache.size());
+    for (const auto& pair : cache) {
+        const CachedHeader& header = pair.second;
+        write_string(file, pair.first);
+        write_value(file, header.file_size);
+        write_value(file, header.modified);
+        write_value(file, header.hash);
+        write_value(file, header.body_offset);
+        write_value(file, header.max_players);
+        write_string(file, header.author);
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef MAPINDEX_H
+#define MAPINDEX_H
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class MapEntry;
+
+/**
+ * @brief Índice de los mapas instalados, construido una vez por proceso
+ *
+ * Guarda por mapa nombre, autor, jugadores máximos, hash y offset del cuerpo,
+ * y lo persiste en data/maps/maps.idx. Al arrancar solo se hace stat() de
+ * cada fichero: los que no han cambiado de tamaño ni de fecha no se abren.
+ * El cuerpo de cada mapa se lee al seleccionarlo (MapEntry::load()).
+ *
+ * Es dueño de los MapEntry; Map solo guarda punteros.
+ */
+class MapIndex {
+public:
+    static constexpr char CACHE_MAGIC[4] = {'C', 'B', 'M', 'X'};
+    static constexpr uint32_t CACHE_VERSION = 2;  // Subir junto con MapEntry::BINARY_VERSION
+
+    /**
+     * @brief Mapas ordenados por nombre; construye el índice la primera vez
+     * Si hay "x.map" y "x.cbm" se usa el binario.
+     */
+    static const std::vector<MapEntry*>& get_maps();
+    static MapEntry* find(const std::string& name);
+
+    /**
+     * @brief Vuelve a recorrer el directorio (mapas instalados en caliente)
+     * Invalida los punteros anteriores.
+     */
+    static void rebuild();
+
+    static std::filesystem::path get_maps_directory();
+
+private:
+    struct CachedHeader {
+        uint64_t file_size;
+        int64_t modified;
+        uint64_t hash;
+        uint32_t body_offset;
+        int32_t max_players;
+        std::string author;
+    };
+
+    static std::vector<std::unique_ptr<MapEntry>> entries;
+    static std::vector<MapEntry*> maps;
+    static bool built;
+
+    static void load_cache(const std::filesystem::path& path, std::unordered_map<std::string, CachedHeader>& cache);
+    static void save_cache(const std::filesystem::path& path, const std::unordered_map<std::string, CachedHeader>& cache);
+};
+
+#endif
@@ -5,7 +5,7 @@
 #include "GameContext.h"
 #include "Extra.h"
 #include "CoordinateSystem.h"
-#include <random>
+#include "GameRandom.h"
 
 // Import CoordinateConfig constants for refactoring Phase 1
 static constexpr int TILE_SIZE = CoordinateConfig::TILE_SIZE;
@@ -60,11 +60,8 @@ void MapTile::destroy() {
 
 void MapTile::spawn_extra() {
     // Based on original ClanBomber spawn logic with balanced probabilities
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> main_dist(0, 7); // 8 main categories (0-7)
-    
-    int roll = main_dist(gen);
+    // Gameplay RNG: seeded per match so replays spawn the same extras
+    int roll = GameRandom::next_int(8); // 8 main categories (0-7)
     Extra::EXTRA_TYPE extra_type;
     
     switch (roll) {
@@ -78,13 +75,11 @@ void MapTile::spawn_extra() {
             extra_type = Extra::SPEED;
             break;
         case 3: { // Special abilities (12.5% chance - kick or glove)
-            std::uniform_int_distribution<> special_dist(0, 1);
-            extra_type = (special_dist(gen) == 0) ? Extra::KICK : Extra::GLOVE;
+            extra_type = (GameRandom::next_int(2) == 0) ? Extra::KICK : Extra::GLOVE;
             break;
         }
         case 4: { // Negative effects (12.5% chance)
-            std::uniform_int_distribution<> negative_dist(0, 7); // Increased chance of negative effects
-            int neg_roll = negative_dist(gen);
+            int neg_roll = GameRandom::next_int(8); // Increased chance of negative effects
             if (neg_roll == 0 || neg_roll == 1) {
                 extra_type = Extra::DISEASE; // Constipation (25% of this case)
             } else if (neg_roll == 2 || neg_roll == 3) {
@@ -97,7 +92,7 @@ void MapTile::spawn_extra() {
             break;
         }
         case 5: // Skate (rare, 6.25% chance)
-            if (std::uniform_int_distribution<>(0, 1)(gen) == 0) {
+            if (GameRandom::next_int(2) == 0) {
                 extra_type = Extra::SKATE;
             } else {
                 return; // No extra
@@ -1,10 +1,10 @@
 #include "MapTile_Box.h"
+#include "Logger.h"
 #include "GameContext.h"
 #include "Resources.h"
 #include "AudioMixer.h"
 #include "Extra.h"
 #include "Timer.h"
-#include "ParticleSystem.h"
 #include "GPUAcceleratedRenderer.h"
 #include "ParticleEffectsManager.h"
 #include "MemoryManagement.h"
@@ -19,7 +19,7 @@ MapTile_Box::MapTile_Box(int _x, int _y, GameContext* _context) : MapTile(_x, _y
     blocking = true;
     destructible = true;
     
-    SDL_Log("MapTile_Box created at pixel (%d,%d), maps to grid (%d,%d), destructible=%d, destroyed=%d", 
+    LOG_DEBUG(MAP, "MapTile_Box created at pixel (%d,%d), maps to grid (%d,%d), destructible=%d, destroyed=%d", 
              _x, _y, get_map_x(), get_map_y(), destructible, destroyed);
 }
 
@@ -33,12 +33,14 @@ void MapTile_Box::act() {
         
         // Add smoke particles during destruction animation  
         if (destroy_animation > 0.1f && prev_animation <= 0.1f) {
-            ParticleSystem* smoke = GameObjectFactory::getInstance().create_particle_system(get_x(), get_y(), static_cast<int>(SMOKE_TRAILS), get_context());
+            if (get_context() && get_context()->get_particle_effects()) {
+                get_context()->get_particle_effects()->spawn_emitter(get_x(), get_y(), SMOKE_TRAILS);
+            }
         }
         
         // Set delete_me exactly when animation completes to prevent black gap
         if (destroy_animation >= 0.5f && !delete_me) {
-            SDL_Log("MapTile_Box at (%d,%d) setting delete_me=true after animation", get_map_x(), get_map_y());
+            LOG_DEBUG(MAP, "MapTile_Box at (%d,%d) setting delete_me=true after animation", get_map_x(), get_map_y());
             
             // Spawn power-up now that explosion has ended (only once!)
             spawn_extra();
@@ -231,7 +233,7 @@ void MapTile_Box::show() {
                         return; // Spectacular GPU effect rendered successfully!
                         
                     } catch (...) {
-                        SDL_Log("GPU fragmentation failed, falling back to SDL effect");
+                        LOG_WARN(MAP, "GPU fragmentation failed, falling back to SDL effect");
                         // Fall through to SDL fallback
                     }
                 }
@@ -241,7 +243,7 @@ void MapTile_Box::show() {
 
 void MapTile_Box::destroy() {
     if (!destroyed) {
-        SDL_Log("MapTile_Box::destroy() called at (%d,%d)", get_map_x(), get_map_y());
+        LOG_DEBUG(MAP, "MapTile_Box::destroy() called at (%d,%d)", get_map_x(), get_map_y());
         destroyed = true;
         blocking = false;
         destroy_animation = 0.0f;
@@ -257,12 +259,13 @@ void MapTile_Box::destroy() {
         // Request destruction effect through centralized system
         if (get_context()->get_particle_effects()) {
             get_context()->get_particle_effects()->create_box_destruction_effect(get_x(), get_y(), 1.0f);
-            SDL_Log("Box destruction effect requested at (%d,%d)", get_x(), get_y());
+            LOG_DEBUG(MAP, "Box destruction effect requested at (%d,%d)", get_x(), get_y());
         }
         
-        // Add traditional particle effects for destruction using ObjectPool pattern
-        ParticleSystem* dust = GameObjectFactory::getInstance().create_particle_system(get_x(), get_y(), static_cast<int>(DUST_CLOUDS), get_context());
-        
-        ParticleSystem* sparks = GameObjectFactory::getInstance().create_particle_system(get_x(), get_y(), static_cast<int>(EXPLOSION_SPARKS), get_context());
+        // Add traditional particle effects for destruction (pooled by ParticleEffectsManager)
+        if (get_context() && get_context()->get_particle_effects()) {
+            get_context()->get_particle_effects()->spawn_emitter(get_x(), get_y(), DUST_CLOUDS);
+            get_context()->get_particle_effects()->spawn_emitter(get_x(), get_y(), EXPLOSION_SPARKS);
+        }
     }
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "MapTile_Pure.h"
+#include "Logger.h"
 #include "Bomb.h"
 #include "Bomber.h"
 #include <SDL3/SDL.h>
@@ -13,7 +14,7 @@ MapTile_Pure::MapTile_Pure(TILE_TYPE type, int grid_x, int grid_y)
     bomb = nullptr;
     bomber = nullptr;
     
-    SDL_Log("MapTile_Pure: Created %s tile at grid (%d,%d)", 
+    LOG_DEBUG(MAP, "MapTile_Pure: Created %s tile at grid (%d,%d)", 
            type == GROUND ? "GROUND" : type == WALL ? "WALL" : type == BOX ? "BOX" : "UNKNOWN",
            grid_x, grid_y);
 }
@@ -64,6 +65,6 @@ MapTile_Box_Pure::MapTile_Box_Pure(int grid_x, int grid_y)
 }
 
 void MapTile_Box_Pure::on_destruction_request() {
-    SDL_Log("MapTile_Box_Pure: Destruction requested at grid (%d,%d)", grid_x, grid_y);
+    LOG_DEBUG(MAP, "MapTile_Box_Pure: Destruction requested at grid (%d,%d)", grid_x, grid_y);
     // Pure tile just logs - actual destruction handling done by TileEntity
 }
\ No newline at end of file
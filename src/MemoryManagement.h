@@ -8,7 +8,6 @@
 #include <string>
 
 // Forward declarations
-class ParticleSystem;
 class GameContext;
 class GameObject;
 
@@ -151,12 +150,6 @@ public:
         pool.release(std::move(obj));
     }
     
-    /**
-     * @brief Specialized factory for ParticleSystem with ObjectPool and auto-registration
-     * Declared here, defined in GameObjectFactory.cpp to avoid forward declaration issues
-     */
-    class ParticleSystem* create_particle_system(int x, int y, int particle_type, GameContext* context);
-    
     /**
      * @brief Attempts to return a GameObject to appropriate pool
      * Declared here, defined in GameObjectFactory.cpp to avoid forward declaration issues
@@ -1,18 +1,28 @@
 #include "ParticleEffectsManager.h"
+#include "Logger.h"
+#include "AllocTracker.h"
 #include "ClanBomber.h"
+#include "GameObject.h"
 #include "GPUAcceleratedRenderer.h"
+#include "GameContext.h"
+#include "RenderingFacade.h"
+#include "TileManager.h"
 #include "Resources.h"
+#include "RenderSnapshot.h"
+#include "CoordinateSystem.h"
 #include <SDL3/SDL.h>
 #include <algorithm>
 #include <cmath>
 
 ParticleEffectsManager::ParticleEffectsManager(ClanBomberApplication* app) 
-    : app(app) {
-    SDL_Log("ParticleEffectsManager: Initialized centralized effects system");
+    : app(app), white_texture(0) {
+    active_emitters.reserve(MAX_ACTIVE_EMITTERS);
+    corpse_physics.set_decal_layer(&decal_layer);
+    LOG_INFO(RENDER, "ParticleEffectsManager: Initialized centralized effects system");
 }
 
 ParticleEffectsManager::~ParticleEffectsManager() {
-    SDL_Log("ParticleEffectsManager: Shutdown complete");
+    LOG_INFO(RENDER, "ParticleEffectsManager: Shutdown complete");
 }
 
 void ParticleEffectsManager::request_effect(const EffectRequest& request) {
@@ -20,6 +30,7 @@ void ParticleEffectsManager::request_effect(const EffectRequest& request) {
 }
 
 void ParticleEffectsManager::update(float deltaTime) {
+    ALLOC_SCOPE(ALLOC_TAG_PARTICLES);
     for (const auto& effect : pending_effects) {
         switch (effect.type) {
             case EffectType::BOX_DESTRUCTION:
@@ -33,9 +44,130 @@ void ParticleEffectsManager::update(float deltaTime) {
         }
     }
     pending_effects.clear();
+    
+    update_emitters(deltaTime);
+    
+    TileManager* tile_manager = (app && app->game_context) ? app->game_context->get_tile_manager() : nullptr;
+    corpse_physics.update(deltaTime, tile_manager);
+}
+
+void ParticleEffectsManager::update_emitters(float deltaTime) {
+    // Recycle finished emitters with swap-and-pop; order does not matter for cosmetics
+    for (size_t i = 0; i < active_emitters.size();) {
+        active_emitters[i]->update(deltaTime);
+        
+        if (active_emitters[i]->is_finished()) {
+            free_emitters.push_back(std::move(active_emitters[i]));
+            active_emitters[i] = std::move(active_emitters.back());
+            active_emitters.pop_back();
+            continue;
+        }
+        ++i;
+    }
 }
 
 void ParticleEffectsManager::render() {
+    ALLOC_SCOPE(ALLOC_TAG_PARTICLES);
+    if (!app || !app->game_context) return;
+    if (active_emitters.empty() && corpse_physics.get_part_count() == 0) return;
+    
+    RenderingFacade* facade = app->game_context->get_rendering_facade();
+    GPUAcceleratedRenderer* gpu_renderer = facade ? facade->get_gpu_renderer() : nullptr;
+    if (!gpu_renderer || !gpu_renderer->is_ready()) return;
+    
+    GLuint texture = get_white_texture();
+    
+    // Single pass after the z-sorted object list: gore first, then particles (one texture each)
+    GPUAcceleratedRenderer::GpuPassScope gpu_pass(gpu_renderer, GPUAcceleratedRenderer::GPU_PASS_PARTICLES);
+    gpu_renderer->begin_batch(GPUAcceleratedRenderer::NORMAL);
+    corpse_physics.render(gpu_renderer, Resources::get_gl_texture("corpse_parts"));
+    for (const auto& emitter : active_emitters) {
+        emitter->render(gpu_renderer, texture);
+    }
+    gpu_renderer->end_batch();
+}
+
+void ParticleEffectsManager::render_floor_decals() {
+    if (!app || !app->game_context) return;
+    
+    RenderingFacade* facade = app->game_context->get_rendering_facade();
+    GPUAcceleratedRenderer* gpu_renderer = facade ? facade->get_gpu_renderer() : nullptr;
+    if (!gpu_renderer) return;
+    
+    // Captured here: the render thread must not read the map size while a new map loads
+    int world_width = CoordinateConfig::get_world_width();
+    int world_height = CoordinateConfig::get_world_height();
+    
+    // FBO work can't be recorded as sprites: run it in order on the render thread
+    if (RenderSnapshot* recording = GPUAcceleratedRenderer::get_recording()) {
+        DecalLayer* decals = &decal_layer;
+        recording->defer([decals, gpu_renderer, world_width, world_height]() {
+            decals->render(gpu_renderer, world_width, world_height);
+        });
+        return;
+    }
+    
+    decal_layer.render(gpu_renderer, world_width, world_height);
+}
+
+ParticleSystem* ParticleEffectsManager::spawn_emitter(float x, float y, ParticleType type) {
+    if (active_emitters.size() >= MAX_ACTIVE_EMITTERS) {
+        return nullptr; // Cosmetic only - dropping is preferable to unbounded growth
+    }
+    
+    std::unique_ptr<ParticleSystem> emitter;
+    if (!free_emitters.empty()) {
+        emitter = std::move(free_emitters.back());
+        free_emitters.pop_back();
+        emitter->reinitialize(x, y, type);
+    } else {
+        emitter = std::make_unique<ParticleSystem>(x, y, type);
+    }
+    
+    active_emitters.push_back(std::move(emitter));
+    return active_emitters.back().get();
+}
+
+size_t ParticleEffectsManager::get_live_particle_count() const {
+    size_t count = 0;
+    for (const auto& emitter : active_emitters) {
+        count += emitter->get_particle_count();
+    }
+    return count;
+}
+
+void ParticleEffectsManager::clear_effects() {
+    for (auto& emitter : active_emitters) {
+        emitter->reset_for_pool();
+        free_emitters.push_back(std::move(emitter));
+    }
+    active_emitters.clear();
+    corpse_physics.clear();
+    decal_layer.clear();
+}
+
+unsigned int ParticleEffectsManager::get_white_texture() {
+    if (white_texture == 0) {
+        // 1x1 white pixel; particle color comes from the vertex tint
+        unsigned char white_pixel[4] = {255, 255, 255, 255};
+        
+        glGenTextures(1, &white_texture);
+        glBindTexture(GL_TEXTURE_2D, white_texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white_pixel);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    return white_texture;
+}
+
+void ParticleEffectsManager::release_gl_resources() {
+    if (white_texture != 0) {
+        glDeleteTextures(1, &white_texture);
+        white_texture = 0;
+    }
+    decal_layer.release_gl_resources();
 }
 
 void ParticleEffectsManager::create_box_destruction_effect(float x, float y, float intensity) {
@@ -50,7 +182,7 @@ void ParticleEffectsManager::process_box_destruction(float x, float y, float int
     if (!app) return;
     
     // TEMPORARILY DISABLED: Particle effects - will be migrated to RenderingFacade
-    SDL_Log("ParticleEffectsManager: Box destruction effect disabled during renderer migration");
+    LOG_DEBUG(RENDER, "ParticleEffectsManager: Box destruction effect disabled during renderer migration");
     
     /*
     GLuint gl_texture = Resources::get_gl_texture("maptile_box");
@@ -60,7 +192,7 @@ void ParticleEffectsManager::process_box_destruction(float x, float y, float int
         // Will be migrated to use RenderingFacade instead of direct GPU renderer
         
     } catch (const std::exception& e) {
-        SDL_Log("ParticleEffectsManager: Error creating box destruction effect: %s", e.what());
+        LOG_WARN(RENDER, "ParticleEffectsManager: Error creating box destruction effect: %s", e.what());
     }
     */
 }
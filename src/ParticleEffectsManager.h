@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <memory>
+#include "ParticleSystem.h"
+#include "CorpsePhysicsSystem.h"
+#include "DecalLayer.h"
 
 class ClanBomberApplication;
 class GPUAcceleratedRenderer;
@@ -36,10 +39,55 @@ public:
     void create_box_destruction_effect(float x, float y, float intensity = 1.0f);
     void create_explosion_effect(float x, float y, float intensity = 1.0f);
     
+    /**
+     * @brief Lanza un emisor de partículas cosméticas desde el pool
+     * @return Emisor activo, o nullptr si se alcanzó MAX_ACTIVE_EMITTERS
+     * @note El emisor pertenece al manager; no registrarlo como GameObject
+     */
+    ParticleSystem* spawn_emitter(float x, float y, ParticleType type);
+    
+    size_t get_active_emitter_count() const { return active_emitters.size(); }
+    size_t get_pooled_emitter_count() const { return free_emitters.size(); }
+    size_t get_live_particle_count() const;
+    
+    /**
+     * @brief Física de gore/debris (partes de cuerpo y gotas), también fuera de GameObjects
+     */
+    CorpsePhysicsSystem* get_corpse_physics() { return &corpse_physics; }
+    
+    /**
+     * @brief Capa persistente de sangre/quemaduras; se compone sobre el mapa
+     */
+    DecalLayer* get_decals() { return &decal_layer; }
+    void render_floor_decals();
+    
+    void clear_effects();
+    
+    /**
+     * @brief Textura blanca 1x1 para quads tintados (partículas, overlays de depuración)
+     */
+    unsigned int get_white_texture();
+
+    /**
+     * @brief Libera las texturas GL (blanca y decals) con el contexto aún activo
+     */
+    void release_gl_resources();
+    
+    static constexpr size_t MAX_ACTIVE_EMITTERS = 128;
+    
 private:
     ClanBomberApplication* app;
     std::vector<EffectRequest> pending_effects;
     
+    // Emitter pool: fuera del mundo de GameObjects (sin LifecycleManager/SpatialGrid)
+    std::vector<std::unique_ptr<ParticleSystem>> active_emitters;
+    std::vector<std::unique_ptr<ParticleSystem>> free_emitters;
+    CorpsePhysicsSystem corpse_physics;
+    DecalLayer decal_layer;
+    unsigned int white_texture;
+    
+    void update_emitters(float deltaTime);
+    
     void process_box_destruction(float x, float y, float intensity);
     void process_explosion(float x, float y, float intensity);
 };
@@ -1,84 +1,44 @@
 #include "ParticleSystem.h"
-#include "Timer.h"
-#include "Resources.h"
-#include "AudioMixer.h"
+#include "GPUAcceleratedRenderer.h"
 #include <cmath>
 #include <algorithm>
 
-ParticleSystem::ParticleSystem(int _x, int _y, ParticleType type, GameContext* context) 
-    : GameObject(_x, _y, context), particle_type(type), random_gen(std::random_device{}()), random_dist(-1.0f, 1.0f) {
-    
-    emission_timer = 0.0f;
-    emission_rate = 60.0f; // 60 particles per second
-    continuous_emission = false;
-    system_lifetime = 0.0f;
-    max_lifetime = 3.0f; // System lasts 3 seconds
-    
-    z = Z_EXPLOSION; // Same layer as explosions
-    
-    // Initialize based on particle type
-    switch (type) {
-        case EXPLOSION_SPARKS:
-            emit_explosion_sparks();
-            max_lifetime = 1.5f;
-            break;
-        case DUST_CLOUDS:
-            emit_dust_cloud();
-            continuous_emission = true;
-            emission_rate = 30.0f;
-            max_lifetime = 2.0f;
-            break;
-        case FIRE_PARTICLES:
-            emit_fire_particles();
-            continuous_emission = true;
-            emission_rate = 40.0f;
-            max_lifetime = 2.5f;
-            break;
-        case SMOKE_TRAILS:
-            emit_smoke_trail();
-            continuous_emission = true;
-            emission_rate = 20.0f;
-            max_lifetime = 3.0f;
-            break;
-    }
+ParticleSystem::ParticleSystem(float _x, float _y, ParticleType type) 
+    : x(_x), y(_y), finished(false), particle_type(type), random_gen(std::random_device{}()), random_dist(-1.0f, 1.0f) {
+    particles.reserve(200);
+    start_emission();
 }
 
 ParticleSystem::~ParticleSystem() {
 }
 
 void ParticleSystem::reset_for_pool() {
-    // Clear all particles and reset system state
+    // Clear all particles and reset system state (keeps vector capacity)
     particles.clear();
     emission_timer = 0.0f;
     system_lifetime = 0.0f;
-    delete_me = false;
-    
-    // Reset random generator
-    random_gen.seed(std::random_device{}());
+    finished = false;
 }
 
-void ParticleSystem::reinitialize(int _x, int _y, ParticleType type, GameContext* context) {
-    // First reset for pool to clear state
+void ParticleSystem::reinitialize(float _x, float _y, ParticleType type) {
     reset_for_pool();
     
-    SDL_Log("🔁 REINITIALIZE: ParticleSystem reused at (%d,%d) with type %d", _x, _y, type);
-    
-    // Reinitialize all members as if constructed fresh
     x = _x;
     y = _y;
     particle_type = type;
-    set_game_context(context); // Update context reference
-    
+    start_emission();
+}
+
+void ParticleSystem::start_emission() {
     emission_timer = 0.0f;
-    emission_rate = 60.0f;
+    emission_rate = 60.0f; // 60 particles per second
     continuous_emission = false;
     system_lifetime = 0.0f;
-    max_lifetime = 3.0f;
-    
-    z = Z_EXPLOSION; // Same layer as explosions
+    max_lifetime = 3.0f; // System lasts 3 seconds
+    finished = false;
     
-    // Initialize based on particle type (same logic as constructor)
-    switch (type) {
+    // Initialize based on particle type
+    switch (particle_type) {
         case EXPLOSION_SPARKS:
             emit_explosion_sparks();
             max_lifetime = 1.5f;
@@ -104,7 +64,7 @@ void ParticleSystem::reinitialize(int _x, int _y, ParticleType type, GameContext
     }
 }
 
-void ParticleSystem::act(float deltaTime) {
+void ParticleSystem::update(float deltaTime) {
     system_lifetime += deltaTime;
     
     // Update existing particles
@@ -131,25 +91,23 @@ void ParticleSystem::act(float deltaTime) {
         }
     }
     
-    // Remove system when lifetime expires and no particles remain
+    // Emitter can be recycled when lifetime expires and no particles remain
     if (system_lifetime > max_lifetime && particles.empty()) {
-        delete_me = true;
+        finished = true;
     }
 }
 
-void ParticleSystem::show() {
-    render_particles();
-}
-
 void ParticleSystem::update_particles(float deltaTime) {
-    for (auto it = particles.begin(); it != particles.end();) {
-        Particle& p = *it;
+    // Swap-and-pop removal: particle order is irrelevant for additive cosmetics
+    for (size_t i = 0; i < particles.size();) {
+        Particle& p = particles[i];
         
         // Update life
         p.life -= deltaTime;
         
         if (p.life <= 0.0f) {
-            it = particles.erase(it);
+            p = particles.back();
+            particles.pop_back();
             continue;
         }
         
@@ -173,12 +131,18 @@ void ParticleSystem::update_particles(float deltaTime) {
             p.size += 0.5f * deltaTime; // Smoke expands
         }
         
-        ++it;
+        ++i;
     }
 }
 
-void ParticleSystem::render_particles() {
-    // TODO
+void ParticleSystem::render(GPUAcceleratedRenderer* renderer, unsigned int white_texture) const {
+    // Cada partícula es un quad tintado sobre una textura blanca 1x1;
+    // todas comparten textura y efecto, así que caen en el mismo batch
+    for (const Particle& p : particles) {
+        float color[4] = {p.r / 255.0f, p.g / 255.0f, p.b / 255.0f, p.a / 255.0f};
+        float half = p.size * 0.5f;
+        renderer->add_sprite(p.x - half, p.y - half, p.size, p.size, white_texture, color);
+    }
 }
 
 void ParticleSystem::create_particle(float px, float py, float vel_x, float vel_y, 
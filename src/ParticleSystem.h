@@ -1,7 +1,7 @@
 #ifndef PARTICLE_SYSTEM_H
 #define PARTICLE_SYSTEM_H
 
-#include "GameObject.h"
+#include <SDL3/SDL.h>
 #include <vector>
 #include <random>
 
@@ -22,19 +22,30 @@ enum ParticleType {
     SMOKE_TRAILS
 };
 
-class ParticleSystem : public GameObject {
+class GPUAcceleratedRenderer;
+
+/**
+ * @brief Emisor de partículas cosméticas
+ *
+ * No es un GameObject: no pasa por LifecycleManager, SpatialGrid ni la lista
+ * de render ordenada por z. ParticleEffectsManager es dueño de los emisores,
+ * los actualiza/dibuja en su propio pass y los recicla en su pool.
+ */
+class ParticleSystem {
 public:
-    ParticleSystem(int _x, int _y, ParticleType type, GameContext* context);
+    ParticleSystem(float _x, float _y, ParticleType type);
     ~ParticleSystem();
     
-    void act(float deltaTime) override;
-    void show() override;
-    ObjectType get_type() const override { return EXPLOSION; } // Reuse explosion type
-    void reset_for_pool() override;
-    bool supports_object_pooling() const override { return true; }
+    void update(float deltaTime);
+    void render(GPUAcceleratedRenderer* renderer, unsigned int white_texture) const;
+    
+    // Pool support - reinitializes emitter with new parameters
+    void reinitialize(float _x, float _y, ParticleType type);
+    void reset_for_pool();
     
-    // ObjectPool support - reinitializes object with new parameters
-    void reinitialize(int _x, int _y, ParticleType type, GameContext* context);
+    bool is_finished() const { return finished; }
+    size_t get_particle_count() const { return particles.size(); }
+    ParticleType get_particle_type() const { return particle_type; }
     
     void emit_explosion_sparks(int count = 30);
     void emit_dust_cloud(int count = 20);
@@ -42,6 +53,8 @@ public:
     void emit_smoke_trail(int count = 15);
 
 private:
+    float x, y;
+    bool finished;
     std::vector<Particle> particles;
     ParticleType particle_type;
     float emission_timer;
@@ -53,8 +66,8 @@ private:
     std::mt19937 random_gen;
     std::uniform_real_distribution<float> random_dist;
     
+    void start_emission();
     void update_particles(float deltaTime);
-    void render_particles();
     void create_particle(float x, float y, float vel_x, float vel_y, 
                         float life, float size, Uint8 r, Uint8 g, Uint8 b);
 };
@@ -0,0 +1,276 @@
+#include "PerfHUD.h"
+#include "ClanBomber.h"
+#include "GameObject.h"
+#include "Bomber.h"
+#include "GameContext.h"
+#include "RenderingFacade.h"
+#include "GPUAcceleratedRenderer.h"
+#include "ParticleEffectsManager.h"
+#include "SpatialPartitioning.h"
+#include "LifecycleManager.h"
+#include "AudioMixer.h"
+#include "CoordinateSystem.h"
+#include "AllocTracker.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    const float PANEL_X = 8.0f;
+    const float PANEL_Y = 8.0f;
+    const float GRAPH_HEIGHT = 60.0f;
+    const float LINE_HEIGHT = 22.0f;   // Fuente "small" (18pt)
+    const float PANEL_WIDTH = 560.0f;
+    const float HISTOGRAM_GAP = 16.0f;   // Entre la gráfica de frames y el histograma de latencia
+    const float HISTOGRAM_BAR = 8.0f;
+}
+
+PerfHUD::PerfHUD(ClanBomberApplication* _app)
+    : app(_app), visible(false), history_head(0), history_count(0), text_timer(0.0f) {
+    std::fill(frame_history, frame_history + HISTORY_SIZE, 0.0f);
+    sorted_scratch.reserve(HISTORY_SIZE);
+}
+
+void PerfHUD::sample(float frame_ms) {
+    frame_history[history_head] = frame_ms;
+    history_head = (history_head + 1) % HISTORY_SIZE;
+    history_count = std::min(history_count + 1, HISTORY_SIZE);
+
+    if (!visible) {
+        return;
+    }
+
+    text_timer -= frame_ms / 1000.0f;
+    if (text_timer <= 0.0f || lines.empty()) {
+        text_timer = TEXT_REFRESH_SECONDS;
+        rebuild_text();
+    }
+}
+
+float PerfHUD::percentile(float fraction) {
+    if (sorted_scratch.empty()) {
+        return 0.0f;
+    }
+    size_t index = static_cast<size_t>(fraction * (sorted_scratch.size() - 1) + 0.5f);
+    return sorted_scratch[std::min(index, sorted_scratch.size() - 1)];
+}
+
+float PerfHUD::measure_ai_think_ms() {
+    if (!Profiler::is_enabled()) {
+        return -1.0f;
+    }
+
+    // Zonas AI_*::think del último frame (ver Controller_AI_*.cpp)
+    Profiler::collect_last_frame(zone_scratch);
+    uint64_t total_ns = 0;
+    for (const auto& zone : zone_scratch) {
+        if (zone.name && strncmp(zone.name, "AI_", 3) == 0) {
+            total_ns += zone.end_ns - zone.start_ns;
+        }
+    }
+    return total_ns / 1000000.0f;
+}
+
+void PerfHUD::rebuild_text() {
+    char buffer[160];
+    lines.clear();
+
+    sorted_scratch.assign(frame_history, frame_history + history_count);
+    std::sort(sorted_scratch.begin(), sorted_scratch.end());
+    float latest = frame_history[(history_head + HISTORY_SIZE - 1) % HISTORY_SIZE];
+    snprintf(buffer, sizeof(buffer), "Frame %.2f ms  p50 %.2f  p99 %.2f  max %.2f",
+             latest, percentile(0.50f), percentile(0.99f),
+             sorted_scratch.empty() ? 0.0f : sorted_scratch.back());
+    lines.push_back(buffer);
+
+    GameContext* context = app->game_context;
+    RenderingFacade* facade = context ? context->get_rendering_facade() : nullptr;
+    GPUAcceleratedRenderer* gpu = facade ? facade->get_gpu_renderer() : nullptr;
+
+    if (facade) {
+        const RenderingStats& stats = facade->get_frame_statistics();
+        if (stats.gpu_timing_valid) {
+            snprintf(buffer, sizeof(buffer), "GPU %.2f ms  spr %.2f  txt %.2f  part %.2f  expl %.2f",
+                     stats.gpu_frame_ms,
+                     stats.gpu_pass_ms[GPUAcceleratedRenderer::GPU_PASS_SPRITES],
+                     stats.gpu_pass_ms[GPUAcceleratedRenderer::GPU_PASS_TEXT],
+                     stats.gpu_pass_ms[GPUAcceleratedRenderer::GPU_PASS_PARTICLES],
+                     stats.gpu_pass_ms[GPUAcceleratedRenderer::GPU_PASS_EXPLOSIONS]);
+            lines.push_back(buffer);
+        }
+        snprintf(buffer, sizeof(buffer), "Draw calls %d  Sprites %u  Quads %d  Particles %zu",
+                 gpu ? gpu->get_frame_draw_calls() : 0, stats.sprites_rendered,
+                 gpu ? gpu->get_frame_vertices() / 4 : 0,
+                 app->particle_effects ? app->particle_effects->get_live_particle_count() : (size_t)0);
+        lines.push_back(buffer);
+
+        if (TextRenderer* text = facade->get_text_renderer()) {
+            snprintf(buffer, sizeof(buffer), "Glyph atlas %zu KB", text->get_atlas_bytes() / 1024);
+            lines.push_back(buffer);
+        }
+    }
+
+    int type_counts[GameObject::ANY + 1] = {};
+    for (const auto& obj : app->objects) {
+        if (obj) type_counts[obj->get_type()]++;
+    }
+    for (const auto& bomber : app->bomber_objects) {
+        if (bomber) type_counts[bomber->get_type()]++;
+    }
+    snprintf(buffer, sizeof(buffer), "Objects: bomber %d  bomb %d  expl %d  extra %d  corpse %d  tile %d",
+             type_counts[GameObject::BOMBER], type_counts[GameObject::BOMB],
+             type_counts[GameObject::EXPLOSION], type_counts[GameObject::EXTRA],
+             type_counts[GameObject::BOMBER_CORPSE], type_counts[GameObject::MAPTILE]);
+    lines.push_back(buffer);
+
+    if (context && context->get_spatial_grid()) {
+        SpatialGrid::GridStats grid = context->get_spatial_grid()->get_statistics();
+        snprintf(buffer, sizeof(buffer), "Grid: %zu objs in %zu/%zu cells  max/cell %zu  load %.2f",
+                 grid.total_objects, grid.occupied_cells, grid.total_cells,
+                 grid.max_objects_in_cell, grid.load_factor);
+        lines.push_back(buffer);
+    }
+
+    if (context && context->get_lifecycle_manager()) {
+        LifecycleManager::QueueStats queues = context->get_lifecycle_manager()->get_queue_stats();
+        snprintf(buffer, sizeof(buffer), "Lifecycle: active %zu  dying %zu  dead %zu  | tiles dying %zu",
+                 queues.objects[0], queues.objects[1], queues.objects[2] + queues.objects[3],
+                 queues.tiles[1] + queues.tiles[2]);
+        lines.push_back(buffer);
+    }
+
+    rebuild_alloc_line(buffer, sizeof(buffer));
+    lines.push_back(buffer);
+
+    rebuild_latency_line(buffer, sizeof(buffer));
+    lines.push_back(buffer);
+
+    float ai_ms = measure_ai_think_ms();
+    if (ai_ms >= 0.0f) {
+        snprintf(buffer, sizeof(buffer), "AI think %.3f ms  Audio voices %d/%d  stolen %llu",
+                 ai_ms, AudioMixer::get_active_voice_count(), MAX_CHANNELS,
+                 (unsigned long long)AudioMixer::get_stolen_voice_count());
+    } else {
+        snprintf(buffer, sizeof(buffer), "AI think n/a (profiler off)  Audio voices %d/%d  stolen %llu",
+                 AudioMixer::get_active_voice_count(), MAX_CHANNELS,
+                 (unsigned long long)AudioMixer::get_stolen_voice_count());
+    }
+    lines.push_back(buffer);
+}
+
+void PerfHUD::rebuild_alloc_line(char* buffer, size_t size) {
+    if (!AllocTracker::is_enabled()) {
+        snprintf(buffer, size, "Allocs n/a (CLANBOMBER_ENABLE_ALLOC_TRACKING=OFF)");
+        return;
+    }
+
+    // Último frame completo + los tres subsistemas que más asignan
+    const AllocTracker::Counters& frame = AllocTracker::get_last_frame();
+    int written = snprintf(buffer, size, "Allocs/frame %llu (%.1f KB)",
+                           (unsigned long long)frame.total_allocations(), frame.total_bytes() / 1024.0);
+
+    bool used[ALLOC_TAG_COUNT] = {};
+    for (int rank = 0; rank < 3 && written > 0 && (size_t)written < size; rank++) {
+        int best = -1;
+        for (int tag = 0; tag < ALLOC_TAG_COUNT; tag++) {
+            if (!used[tag] && frame.allocations[tag] > 0 &&
+                (best < 0 || frame.allocations[tag] > frame.allocations[best])) {
+                best = tag;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        used[best] = true;
+        written += snprintf(buffer + written, size - written, "  %s %llu",
+                            AllocTracker::tag_name(static_cast<AllocTag>(best)),
+                            (unsigned long long)frame.allocations[best]);
+    }
+}
+
+void PerfHUD::rebuild_latency_line(char* buffer, size_t size) {
+    InputLatency::get_histogram(latency);
+    const char* mode = InputLatency::is_low_latency_mode() ? "low-latency" : "normal";
+    if (latency.samples == 0) {
+        snprintf(buffer, size, "Input->swap: no samples yet (press a key)  [%s, F2]", mode);
+        return;
+    }
+    snprintf(buffer, size, "Input->swap %.1f ms  mean %.1f  p50 <%.0f  p99 <%.0f  n=%llu  [%s, F2]",
+             latency.last_ms, latency.mean_ms, latency.percentile(0.50f), latency.percentile(0.99f),
+             (unsigned long long)latency.samples, mode);
+}
+
+void PerfHUD::render_latency_histogram(GPUAcceleratedRenderer* gpu, unsigned int white, float x, float y) {
+    const float axis_color[4] = {1.0f, 1.0f, 1.0f, 0.5f};
+    const float bar_color[4] = {0.3f, 0.7f, 1.0f, 0.9f};
+    const float overflow_color[4] = {1.0f, 0.2f, 0.2f, 0.9f};
+
+    Uint64 highest = 0;
+    for (Uint64 count : latency.counts) {
+        highest = std::max(highest, count);
+    }
+
+    // One bar per BUCKET_MS bucket, 0 ms on the left; the last bucket is "and above"
+    for (int i = 0; i < InputLatency::BUCKETS && highest > 0; i++) {
+        float h = static_cast<float>(latency.counts[i]) / highest * GRAPH_HEIGHT;
+        const float* color = i == InputLatency::BUCKETS - 1 ? overflow_color : bar_color;
+        gpu->add_sprite(x + i * HISTOGRAM_BAR, y + GRAPH_HEIGHT - h, HISTOGRAM_BAR - 1.0f, h, white, color);
+    }
+    gpu->add_sprite(x, y + GRAPH_HEIGHT, InputLatency::BUCKETS * HISTOGRAM_BAR, 1.0f, white, axis_color);
+}
+
+void PerfHUD::render_graph(float x, float y) {
+    GameContext* context = app->game_context;
+    RenderingFacade* facade = context ? context->get_rendering_facade() : nullptr;
+    GPUAcceleratedRenderer* gpu = facade ? facade->get_gpu_renderer() : nullptr;
+    if (!gpu || !gpu->is_ready() || !app->particle_effects) {
+        return;
+    }
+
+    GLuint white = app->particle_effects->get_white_texture();
+    const float panel_color[4] = {0.0f, 0.0f, 0.0f, 0.6f};
+    const float budget_color[4] = {1.0f, 1.0f, 1.0f, 0.5f};
+    const float ok_color[4] = {0.2f, 0.9f, 0.3f, 0.9f};
+    const float slow_color[4] = {1.0f, 0.8f, 0.1f, 0.9f};
+    const float spike_color[4] = {1.0f, 0.2f, 0.2f, 0.9f};
+
+    float panel_height = GRAPH_HEIGHT + 12.0f + LINE_HEIGHT * lines.size();
+    gpu->begin_batch(GPUAcceleratedRenderer::NORMAL);
+    gpu->add_sprite(x - 4.0f, y - 4.0f, PANEL_WIDTH, panel_height, white, panel_color);
+
+    // Oldest sample on the left; one pixel per frame
+    for (int i = 0; i < history_count; i++) {
+        int index = (history_head - history_count + i + HISTORY_SIZE) % HISTORY_SIZE;
+        float ms = frame_history[index];
+        float h = std::min(ms / GRAPH_MAX_MS, 1.0f) * GRAPH_HEIGHT;
+        const float* color = ms <= 16.7f ? ok_color : (ms <= GRAPH_MAX_MS ? slow_color : spike_color);
+        gpu->add_sprite(x + (HISTORY_SIZE - history_count + i), y + GRAPH_HEIGHT - h, 1.0f, h, white, color);
+    }
+
+    // 60 Hz budget line
+    float budget_y = y + GRAPH_HEIGHT - (16.7f / GRAPH_MAX_MS) * GRAPH_HEIGHT;
+    gpu->add_sprite(x, budget_y, (float)HISTORY_SIZE, 1.0f, white, budget_color);
+
+    render_latency_histogram(gpu, white, x + HISTORY_SIZE + HISTOGRAM_GAP, y);
+    gpu->end_batch();
+}
+
+void PerfHUD::render() {
+    if (!visible) {
+        return;
+    }
+
+    GameContext* context = app->game_context;
+    RenderingFacade* facade = context ? context->get_rendering_facade() : nullptr;
+    if (!facade) {
+        return;
+    }
+
+    render_graph(PANEL_X, PANEL_Y);
+
+    float y = PANEL_Y + GRAPH_HEIGHT + 8.0f;
+    for (const auto& line : lines) {
+        facade->render_text(line, PixelCoord(PANEL_X, y), "small", 255, 255, 255);
+        y += LINE_HEIGHT;
+    }
+}
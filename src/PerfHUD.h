@@ -0,0 +1,64 @@
+#ifndef PERFHUD_H
+#define PERFHUD_H
+
+#include "Profiler.h"
+#include "InputLatency.h"
+#include <string>
+#include <vector>
+
+class ClanBomberApplication;
+class GPUAcceleratedRenderer;
+
+/**
+ * @brief Overlay de rendimiento para playtests (F1 en GameplayScreen)
+ *
+ * Gráfica de los últimos HISTORY_SIZE frame times con p50/p99, y contadores de
+ * los subsistemas: draw calls, sprites, partículas vivas, objetos por tipo,
+ * SpatialGrid, colas del LifecycleManager, asignaciones por frame (AllocTracker),
+ * tiempo de IA y voces de audio. A la derecha de la gráfica, el histograma de
+ * latencia entrada → imagen (InputLatency).
+ *
+ * sample() se llama una vez por frame al final de GameplayScreen::render() con
+ * la duración real del frame (con paso fijo, update() puede ejecutarse 0..N veces).
+ * Los contadores del renderer incluyen la escena del frame actual, sin el propio HUD.
+ * El texto se regenera cada TEXT_REFRESH_SECONDS
+ * para no crear una textura de texto nueva en cada frame.
+ */
+class PerfHUD {
+public:
+    explicit PerfHUD(ClanBomberApplication* app);
+
+    void toggle() { visible = !visible; }
+    bool is_visible() const { return visible; }
+
+    void sample(float frame_ms);
+    void render();
+
+    static constexpr int HISTORY_SIZE = 240;
+    static constexpr float TEXT_REFRESH_SECONDS = 0.25f;
+    static constexpr float GRAPH_MAX_MS = 33.3f;   // Alto de la gráfica: dos frames a 60 Hz
+
+private:
+    ClanBomberApplication* app;
+    bool visible;
+
+    float frame_history[HISTORY_SIZE];
+    int history_head;
+    int history_count;
+    float text_timer;
+
+    std::vector<std::string> lines;
+    std::vector<float> sorted_scratch;
+    std::vector<Profiler::ZoneEvent> zone_scratch;
+    InputLatency::Histogram latency;
+
+    float percentile(float fraction);
+    float measure_ai_think_ms();
+    void rebuild_text();
+    void rebuild_alloc_line(char* buffer, size_t size);
+    void rebuild_latency_line(char* buffer, size_t size);
+    void render_graph(float x, float y);
+    void render_latency_histogram(GPUAcceleratedRenderer* gpu, unsigned int white, float x, float y);
+};
+
+#endif
@@ -0,0 +1,190 @@
+#include "Profiler.h"
+#include "Logger.h"
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace {
+    struct ThreadRing {
+        Profiler::ZoneEvent events[Profiler::RING_CAPACITY];
+        std::atomic<uint64_t> write_index{0};
+        uint32_t depth = 0;
+        uint32_t thread_id = 0;
+        std::string thread_name;
+    };
+
+    // Los rings viven hasta el final del proceso: un hilo que termina sigue
+    // apareciendo en las capturas posteriores.
+    std::mutex registry_mutex;
+    std::vector<std::unique_ptr<ThreadRing>> registry;
+    std::atomic<uint32_t> next_thread_id{1};
+
+    std::atomic<bool> profiler_enabled{CLANBOMBER_PROFILER != 0};
+    std::atomic<uint32_t> frame_index{0};
+    uint64_t frame_start_ns = 0;
+    std::atomic<float> last_frame_ms{0.0f};
+    ThreadRing* frame_thread_ring = nullptr;
+
+    const auto epoch = std::chrono::steady_clock::now();
+
+    ThreadRing* get_thread_ring() {
+        thread_local ThreadRing* ring = nullptr;
+        if (!ring) {
+            auto owned = std::make_unique<ThreadRing>();
+            owned->thread_id = next_thread_id.fetch_add(1);
+            owned->thread_name = "thread " + std::to_string(owned->thread_id);
+            ring = owned.get();
+
+            std::lock_guard<std::mutex> lock(registry_mutex);
+            registry.push_back(std::move(owned));
+        }
+        return ring;
+    }
+
+    void write_json_string(std::ofstream& out, const char* text) {
+        out << '"';
+        for (const char* c = text; c && *c; c++) {
+            if (*c == '"' || *c == '\\') out << '\\';
+            out << *c;
+        }
+        out << '"';
+    }
+}
+
+uint64_t Profiler::now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - epoch).count());
+}
+
+void Profiler::set_enabled(bool enabled) {
+    profiler_enabled.store(enabled && CLANBOMBER_PROFILER != 0, std::memory_order_relaxed);
+}
+
+bool Profiler::is_enabled() {
+    return profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::begin_frame() {
+    frame_thread_ring = get_thread_ring();
+    frame_start_ns = now_ns();
+}
+
+void Profiler::end_frame() {
+    uint64_t end = now_ns();
+    last_frame_ms.store((end - frame_start_ns) / 1000000.0f, std::memory_order_relaxed);
+    frame_index.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t Profiler::get_frame_index() {
+    return frame_index.load(std::memory_order_relaxed);
+}
+
+float Profiler::get_last_frame_ms() {
+    return last_frame_ms.load(std::memory_order_relaxed);
+}
+
+void Profiler::set_thread_name(const char* name) {
+    ThreadRing* ring = get_thread_ring();
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    ring->thread_name = name ? name : "";
+}
+
+uint32_t Profiler::enter_zone() {
+    return get_thread_ring()->depth++;
+}
+
+void Profiler::leave_zone(const char* name, uint64_t start_ns, uint32_t depth) {
+    ThreadRing* ring = get_thread_ring();
+    ring->depth = depth;
+
+    // Solo escribe el hilo dueño; write_index publica el evento al exportador
+    uint64_t index = ring->write_index.load(std::memory_order_relaxed);
+    ZoneEvent& ev = ring->events[index % RING_CAPACITY];
+    ev.name = name;
+    ev.start_ns = start_ns;
+    ev.end_ns = now_ns();
+    ev.depth = depth;
+    ev.frame = frame_index.load(std::memory_order_relaxed);
+    ring->write_index.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::collect_last_frame(std::vector<ZoneEvent>& out) {
+    out.clear();
+    ThreadRing* ring = frame_thread_ring;
+    uint32_t current = frame_index.load(std::memory_order_relaxed);
+    if (!ring || current == 0) {
+        return;
+    }
+
+    const uint32_t wanted = current - 1;
+    uint64_t end = ring->write_index.load(std::memory_order_acquire);
+    uint64_t begin = end > RING_CAPACITY ? end - RING_CAPACITY : 0;
+
+    // Recorre hacia atrás hasta salir del frame buscado
+    for (uint64_t i = end; i > begin; i--) {
+        const ZoneEvent& ev = ring->events[(i - 1) % RING_CAPACITY];
+        if (ev.frame == wanted) {
+            out.push_back(ev);
+        } else if (ev.frame < wanted) {
+            break;
+        }
+    }
+
+    std::sort(out.begin(), out.end(), [](const ZoneEvent& a, const ZoneEvent& b) {
+        return a.start_ns < b.start_ns || (a.start_ns == b.start_ns && a.depth < b.depth);
+    });
+}
+
+bool Profiler::write_chrome_trace(const std::string& path) {
+    std::ofstream out(path, std::ios::out | std::ios::trunc);
+    if (!out) {
+        LOG_WARN(CORE, "Profiler: Cannot open '%s' for writing", path.c_str());
+        return false;
+    }
+
+    // No abre zonas nuevas mientras se copia: el exportador lee los rings de otros hilos
+    bool was_enabled = is_enabled();
+    set_enabled(false);
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    size_t event_count = 0;
+    bool first = true;
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (const auto& ring : registry) {
+        out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << ring->thread_id << ",\"args\":{\"name\":";
+        write_json_string(out, ring->thread_name.c_str());
+        out << "}}";
+        first = false;
+
+        uint64_t end = ring->write_index.load(std::memory_order_acquire);
+        uint64_t begin = end > RING_CAPACITY ? end - RING_CAPACITY : 0;
+        for (uint64_t i = begin; i < end; i++) {
+            const ZoneEvent& ev = ring->events[i % RING_CAPACITY];
+            out << ",\n{\"name\":";
+            write_json_string(out, ev.name);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << ring->thread_id
+                << ",\"ts\":" << (ev.start_ns / 1000.0)
+                << ",\"dur\":" << ((ev.end_ns - ev.start_ns) / 1000.0)
+                << ",\"args\":{\"frame\":" << ev.frame << "}}";
+            event_count++;
+        }
+    }
+    out << "\n]}\n";
+
+    set_enabled(was_enabled);
+
+    if (!out) {
+        LOG_WARN(CORE, "Profiler: Error writing trace to '%s'", path.c_str());
+        return false;
+    }
+    LOG_INFO(CORE, "Profiler: Wrote %zu zones from %zu threads to %s", event_count, registry.size(), path.c_str());
+    return true;
+}
@@ -0,0 +1,113 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Profiler jerárquico de zonas con export a Chrome trace (Perfetto)
+ *
+ * Cada PROFILE_ZONE("nombre") es un marcador RAII: al salir del scope graba
+ * un evento {nombre, inicio, fin, profundidad} en el ring buffer del hilo
+ * actual. Los rings son por hilo (sin locks en el hot path) y de tamaño fijo:
+ * siempre contienen los últimos N eventos, así que se puede volcar una captura
+ * en cualquier momento (F11 en el juego) sin haberla "arrancado" antes.
+ *
+ * Compilar con CLANBOMBER_PROFILER=0 elimina todos los marcadores.
+ * Los nombres deben ser literales (se guarda el puntero, no una copia).
+ */
+#ifndef CLANBOMBER_PROFILER
+#define CLANBOMBER_PROFILER 1
+#endif
+
+class Profiler {
+public:
+    struct ZoneEvent {
+        const char* name;
+        uint64_t start_ns;
+        uint64_t end_ns;
+        uint32_t depth;      // 0 = zona raíz del hilo
+        uint32_t frame;      // Frame en el que se cerró la zona
+    };
+
+    static constexpr size_t RING_CAPACITY = 1 << 15; // Eventos por hilo
+
+    static uint64_t now_ns();
+
+    static void set_enabled(bool enabled);
+    static bool is_enabled();
+
+    /**
+     * @brief Marca inicio/fin de frame (hilo principal)
+     * end_frame() guarda la duración para get_last_frame_ms().
+     */
+    static void begin_frame();
+    static void end_frame();
+    static uint32_t get_frame_index();
+    static float get_last_frame_ms();
+
+    static void set_thread_name(const char* name);
+
+    /**
+     * @brief Zonas del hilo principal cerradas en el último frame completo
+     * Ordenadas por hora de inicio; útil para overlays de depuración.
+     */
+    static void collect_last_frame(std::vector<ZoneEvent>& out);
+
+    /**
+     * @brief Vuelca el contenido de todos los rings como Chrome trace JSON
+     * @return false si no se pudo escribir el fichero
+     */
+    static bool write_chrome_trace(const std::string& path);
+
+    // Usado por ProfileZone
+    static uint32_t enter_zone();
+    static void leave_zone(const char* name, uint64_t start_ns, uint32_t depth);
+};
+
+/**
+ * @brief Marcador RAII de una zona de profiling
+ */
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* zone_name)
+        : name(zone_name), start(0), depth(0), active(Profiler::is_enabled()) {
+        if (active) {
+            depth = Profiler::enter_zone();
+            start = Profiler::now_ns();
+        }
+    }
+
+    ~ProfileZone() {
+        if (active) {
+            Profiler::leave_zone(name, start, depth);
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    uint64_t start;
+    uint32_t depth;
+    bool active;
+};
+
+#if CLANBOMBER_PROFILER
+#define PROFILER_CONCAT_INNER(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILER_CONCAT(profile_zone_, __LINE__)(name)
+#define PROFILE_FRAME_BEGIN() Profiler::begin_frame()
+#define PROFILE_FRAME_END() Profiler::end_frame()
+#define PROFILE_THREAD_NAME(name) Profiler::set_thread_name(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_FRAME_BEGIN() ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#define PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,218 @@
+#include "RenderSnapshot.h"
+#include "GPUAcceleratedRenderer.h"
+#include "RenderingFacade.h"
+#include "CoordinateSystem.h"
+#include "ErrorHandling.h"
+
+RenderSnapshot::RenderSnapshot()
+    : string_count(0), recorded_pass(GPUAcceleratedRenderer::GPU_PASS_SPRITES), facade_sprites(0),
+      input_timestamp(0) {
+    commands.reserve(4096);
+}
+
+void RenderSnapshot::clear() {
+    commands.clear();
+    string_count = 0;
+    callbacks.clear();
+    recorded_pass = GPUAcceleratedRenderer::GPU_PASS_SPRITES;
+    facade_sprites = 0;
+    input_timestamp = 0;
+}
+
+RenderSnapshot::Command& RenderSnapshot::push(CommandType type) {
+    commands.emplace_back();
+    Command& command = commands.back();
+    command.type = type;
+    command.flags = 0;
+    command.texture = 0;
+    command.payload = 0;
+    return command;
+}
+
+uint32_t RenderSnapshot::store_string(const std::string& value) {
+    if (string_count == strings.size()) {
+        strings.emplace_back();
+    }
+    strings[string_count].assign(value);   // Reuses the slot's buffer from previous frames
+    return static_cast<uint32_t>(string_count++);
+}
+
+// === Grabación ===
+
+void RenderSnapshot::begin_batch(int effect) {
+    push(BEGIN_BATCH).ival[0] = effect;
+}
+
+void RenderSnapshot::add_sprite(float x, float y, float w, float h, GLuint texture, const float* color,
+                                float rotation, const float* scale, int sprite_number) {
+    Command& command = push(SPRITE);
+    command.fval[0] = x;
+    command.fval[1] = y;
+    command.fval[2] = w;
+    command.fval[3] = h;
+    command.texture = texture;
+    if (color) {
+        command.flags |= HAS_COLOR;
+        for (int i = 0; i < 4; i++) command.fval[4 + i] = color[i];
+    }
+    command.fval[8] = rotation;
+    if (scale) {
+        command.flags |= HAS_SCALE;
+        command.fval[9] = scale[0];
+        command.fval[10] = scale[1];
+    }
+    command.ival[2] = sprite_number;
+}
+
+void RenderSnapshot::add_animated_sprite(float x, float y, float w, float h, GLuint texture, const float* color,
+                                         float rotation, const float* scale, int effect, int sprite_number) {
+    add_sprite(x, y, w, h, texture, color, rotation, scale, sprite_number);
+    commands.back().type = ANIMATED_SPRITE;
+    commands.back().ival[0] = effect;
+}
+
+void RenderSnapshot::end_batch() {
+    push(END_BATCH);
+}
+
+int RenderSnapshot::set_gpu_pass(int pass) {
+    int previous = recorded_pass;
+    if (pass != recorded_pass) {
+        push(SET_GPU_PASS).ival[1] = pass;
+        recorded_pass = pass;
+    }
+    return previous;
+}
+
+void RenderSnapshot::queue_explosion(float center_x, float center_y, float age, int up, int down, int left, int right) {
+    Command& command = push(QUEUE_EXPLOSION);
+    command.fval[0] = center_x;
+    command.fval[1] = center_y;
+    command.fval[2] = age;
+    command.ival[0] = up;
+    command.ival[1] = down;
+    command.ival[2] = left;
+    command.ival[3] = right;
+}
+
+void RenderSnapshot::render_explosions() {
+    push(RENDER_EXPLOSIONS);
+}
+
+void RenderSnapshot::emit_particles(float x, float y, int count, int type, const float* velocity, float life) {
+    Command& command = push(EMIT_PARTICLES);
+    command.fval[0] = x;
+    command.fval[1] = y;
+    command.fval[2] = life;
+    if (velocity) {
+        command.flags |= HAS_VELOCITY;
+        command.fval[3] = velocity[0];
+        command.fval[4] = velocity[1];
+    }
+    command.ival[3] = count;
+    command.ival[4] = type;
+}
+
+void RenderSnapshot::set_explosion_effect(float center_x, float center_y, float radius, float strength) {
+    Command& command = push(EXPLOSION_EFFECT);
+    command.fval[0] = center_x;
+    command.fval[1] = center_y;
+    command.fval[2] = radius;
+    command.fval[3] = strength;
+}
+
+void RenderSnapshot::set_camera(const float* position, float zoom) {
+    Command& command = push(SET_CAMERA);
+    if (position) {
+        command.flags |= HAS_POSITION;
+        command.fval[0] = position[0];
+        command.fval[1] = position[1];
+    }
+    command.fval[2] = zoom;
+}
+
+void RenderSnapshot::render_text(const std::string& text, float x, float y, const std::string& font_name,
+                                 uint8_t r, uint8_t g, uint8_t b) {
+    uint32_t text_index = store_string(text);
+    uint32_t font_index = store_string(font_name);
+    Command& command = push(TEXT);
+    command.payload = text_index;
+    command.ival[0] = static_cast<int>(font_index);
+    command.ival[1] = r;
+    command.ival[2] = g;
+    command.ival[3] = b;
+    command.fval[0] = x;
+    command.fval[1] = y;
+}
+
+void RenderSnapshot::defer(std::function<void()> work) {
+    callbacks.push_back(std::move(work));
+    push(CALLBACK).payload = static_cast<uint32_t>(callbacks.size() - 1);
+}
+
+// === Reproducción ===
+
+void RenderSnapshot::replay(GPUAcceleratedRenderer* renderer, RenderingFacade* facade) const {
+    if (!renderer) {
+        return;
+    }
+
+    for (const Command& command : commands) {
+        const float* color = (command.flags & HAS_COLOR) ? &command.fval[4] : nullptr;
+        const float* scale = (command.flags & HAS_SCALE) ? &command.fval[9] : nullptr;
+
+        switch (command.type) {
+            case BEGIN_BATCH:
+                renderer->begin_batch(static_cast<GPUAcceleratedRenderer::EffectType>(command.ival[0]));
+                break;
+            case SPRITE:
+                renderer->add_sprite(command.fval[0], command.fval[1], command.fval[2], command.fval[3],
+                                     command.texture, color, command.fval[8], scale, command.ival[2]);
+                break;
+            case ANIMATED_SPRITE:
+                renderer->add_animated_sprite(command.fval[0], command.fval[1], command.fval[2], command.fval[3],
+                                              command.texture, color, command.fval[8], scale,
+                                              static_cast<GPUAcceleratedRenderer::EffectType>(command.ival[0]),
+                                              command.ival[2]);
+                break;
+            case END_BATCH:
+                renderer->end_batch();
+                break;
+            case SET_GPU_PASS:
+                renderer->set_gpu_pass(static_cast<GPUAcceleratedRenderer::GpuPass>(command.ival[1]));
+                break;
+            case QUEUE_EXPLOSION:
+                renderer->queue_explosion(command.fval[0], command.fval[1], command.fval[2],
+                                          command.ival[0], command.ival[1], command.ival[2], command.ival[3]);
+                break;
+            case RENDER_EXPLOSIONS:
+                renderer->render_explosions();
+                break;
+            case EMIT_PARTICLES:
+                renderer->emit_particles(command.fval[0], command.fval[1], command.ival[3],
+                                         static_cast<GPUAcceleratedRenderer::ParticleType>(command.ival[4]),
+                                         (command.flags & HAS_VELOCITY) ? &command.fval[3] : nullptr,
+                                         command.fval[2]);
+                break;
+            case EXPLOSION_EFFECT:
+                renderer->set_explosion_effect(command.fval[0], command.fval[1], command.fval[2], command.fval[3]);
+                break;
+            case TEXT:
+                if (facade) {
+                    facade->render_text(strings[command.payload], PixelCoord(command.fval[0], command.fval[1]),
+                                        strings[command.ival[0]], static_cast<uint8_t>(command.ival[1]),
+                                        static_cast<uint8_t>(command.ival[2]), static_cast<uint8_t>(command.ival[3]));
+                }
+                break;
+            case SET_CAMERA:
+                renderer->set_camera((command.flags & HAS_POSITION) ? &command.fval[0] : nullptr, command.fval[2]);
+                break;
+            case CALLBACK:
+                callbacks[command.payload]();
+                break;
+        }
+    }
+
+    // The recorded pass must not leak into the next frame
+    renderer->set_gpu_pass(GPUAcceleratedRenderer::GPU_PASS_SPRITES);
+}
@@ -0,0 +1,110 @@
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include <glad/gl.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class GPUAcceleratedRenderer;
+class RenderingFacade;
+
+/**
+ * @brief Lista inmutable de comandos de dibujo de un frame (hilo de render separado)
+ *
+ * Con el hilo de render activo, el hilo de simulación no toca GL: las llamadas
+ * públicas de dibujo de GPUAcceleratedRenderer (batches, sprites, explosiones,
+ * partículas, cámara) y RenderingFacade::render_text() se graban aquí en orden. El hilo
+ * de render, dueño del contexto GL, ejecuta replay() entre begin_frame() y
+ * end_frame() del facade.
+ *
+ * Los textos se resuelven en el replay (la textura del texto es un objeto GL).
+ * Para el trabajo GL que no encaja en un comando (la capa de decals), defer()
+ * graba una función; solo debe capturar sistemas que viven toda la partida.
+ *
+ * clear() conserva la capacidad: en régimen estable grabar no asigna memoria.
+ */
+class RenderSnapshot {
+public:
+    enum CommandType : uint8_t {
+        BEGIN_BATCH,
+        SPRITE,
+        ANIMATED_SPRITE,
+        END_BATCH,
+        SET_GPU_PASS,
+        QUEUE_EXPLOSION,
+        RENDER_EXPLOSIONS,
+        EMIT_PARTICLES,
+        EXPLOSION_EFFECT,
+        TEXT,
+        SET_CAMERA,
+        CALLBACK
+    };
+
+    RenderSnapshot();
+
+    void clear();
+    bool empty() const { return commands.empty(); }
+    size_t get_command_count() const { return commands.size(); }
+
+    // === Grabación (hilo de simulación) ===
+    void begin_batch(int effect);
+    void add_sprite(float x, float y, float w, float h, GLuint texture, const float* color,
+                    float rotation, const float* scale, int sprite_number);
+    void add_animated_sprite(float x, float y, float w, float h, GLuint texture, const float* color,
+                             float rotation, const float* scale, int effect, int sprite_number);
+    void end_batch();
+    int set_gpu_pass(int pass);   // Devuelve el pase grabado anterior (para GpuPassScope)
+    void queue_explosion(float center_x, float center_y, float age, int up, int down, int left, int right);
+    void render_explosions();
+    void emit_particles(float x, float y, int count, int type, const float* velocity, float life);
+    void set_explosion_effect(float center_x, float center_y, float radius, float strength);
+    void set_camera(const float* position, float zoom);
+    void render_text(const std::string& text, float x, float y, const std::string& font_name,
+                     uint8_t r, uint8_t g, uint8_t b);
+    void defer(std::function<void()> work);
+
+    // Entrada más antigua que refleja este frame (InputLatency), 0 si ninguna
+    void note_input_timestamp(uint64_t input_ns) {
+        if (input_ns != 0 && (input_timestamp == 0 || input_ns < input_timestamp)) input_timestamp = input_ns;
+    }
+    uint64_t get_input_timestamp() const { return input_timestamp; }
+
+    // Sprites pedidos a través de RenderingFacade::render_sprite (estadísticas del facade)
+    void count_facade_sprite() { facade_sprites++; }
+    uint32_t get_facade_sprite_count() const { return facade_sprites; }
+
+    // === Reproducción (hilo de render) ===
+    void replay(GPUAcceleratedRenderer* renderer, RenderingFacade* facade) const;
+
+private:
+    struct Command {
+        CommandType type;
+        uint8_t flags;          // HAS_COLOR / HAS_SCALE / HAS_VELOCITY / HAS_POSITION
+        int ival[5];            // effect, pass, sprite_number, count, type, brazos de la explosión
+        GLuint texture;
+        uint32_t payload;       // Índice en strings (TEXT) o callbacks (CALLBACK)
+        float fval[11];         // x, y, w, h, rgba, rotation, scale | centro, radio...
+    };
+
+    enum CommandFlags : uint8_t {
+        HAS_COLOR = 1,
+        HAS_SCALE = 2,
+        HAS_VELOCITY = 4,
+        HAS_POSITION = 8
+    };
+
+    std::vector<Command> commands;
+    std::vector<std::string> strings;
+    size_t string_count;        // strings se reutilizan entre frames (conservan su buffer)
+    std::vector<std::function<void()>> callbacks;
+    int recorded_pass;
+    uint32_t facade_sprites;
+    uint64_t input_timestamp;
+
+    Command& push(CommandType type);
+    uint32_t store_string(const std::string& value);
+};
+
+#endif
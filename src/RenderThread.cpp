@@ -0,0 +1,136 @@
+#include "RenderThread.h"
+#include "RenderingFacade.h"
+#include "GPUAcceleratedRenderer.h"
+#include "ErrorHandling.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include "InputLatency.h"
+
+RenderThread::RenderThread()
+    : back(0), front(1), middle(2), carried_input_ns(0), window(nullptr), context(nullptr), facade(nullptr),
+      running(false), frames_rendered(0), frames_dropped(0) {
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+bool RenderThread::start(SDL_Window* _window, SDL_GLContext _context, RenderingFacade* _facade) {
+    if (running || !_window || !_context || !_facade) {
+        return false;
+    }
+    window = _window;
+    context = _context;
+    facade = _facade;
+
+    // A GL context can only be current on one thread at a time
+    if (!SDL_GL_MakeCurrent(window, nullptr)) {
+        LOG_ERROR(RENDER, "RenderThread: could not release GL context: %s", SDL_GetError());
+        return false;
+    }
+
+    back = 0;
+    front = 1;
+    middle.store(2, std::memory_order_relaxed);
+    carried_input_ns = 0;
+    for (RenderSnapshot& snapshot : snapshots) {
+        snapshot.clear();
+    }
+
+    running = true;
+    context_acquired = std::promise<bool>();
+    std::future<bool> acquired = context_acquired.get_future();
+    thread = std::thread(&RenderThread::render_loop, this);
+    if (!acquired.get()) {
+        // The render thread has already exited; take the context back and keep rendering here
+        thread.join();
+        running = false;
+        SDL_GL_MakeCurrent(window, context);
+        return false;
+    }
+    GPUAcceleratedRenderer::set_recording(&snapshots[back]);
+    LOG_INFO(RENDER, "RenderThread: started, simulation thread now records render snapshots");
+    return true;
+}
+
+void RenderThread::stop() {
+    if (!running) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        running = false;
+    }
+    wake.notify_one();
+    thread.join();
+
+    GPUAcceleratedRenderer::set_recording(nullptr);
+    SDL_GL_MakeCurrent(window, context);
+    LOG_INFO(RENDER, "RenderThread: stopped (%llu frames rendered, %llu snapshots skipped)",
+             (unsigned long long)frames_rendered.load(), (unsigned long long)frames_dropped.load());
+}
+
+RenderSnapshot* RenderThread::begin_snapshot() {
+    RenderSnapshot* snapshot = &snapshots[back];
+    snapshot->clear();
+    snapshot->note_input_timestamp(carried_input_ns);
+    carried_input_ns = 0;
+    GPUAcceleratedRenderer::set_recording(snapshot);
+    return snapshot;
+}
+
+void RenderThread::publish() {
+    int previous = middle.exchange(back | FRESH_BIT, std::memory_order_acq_rel);
+    back = previous & INDEX_MASK;
+    if (previous & FRESH_BIT) {
+        // Render thread never saw it: its input shows up in the next snapshot instead
+        frames_dropped.fetch_add(1, std::memory_order_relaxed);
+        carried_input_ns = snapshots[back].get_input_timestamp();
+    }
+    GPUAcceleratedRenderer::set_recording(&snapshots[back]);
+
+    // Taking the lock orders this notify after the render thread's predicate check
+    { std::lock_guard<std::mutex> lock(wake_mutex); }
+    wake.notify_one();
+}
+
+void RenderThread::render_loop() {
+    PROFILE_THREAD_NAME("render");
+    if (!SDL_GL_MakeCurrent(window, context)) {
+        LOG_ERROR(RENDER, "RenderThread: could not acquire GL context: %s", SDL_GetError());
+        context_acquired.set_value(false);
+        return;
+    }
+    context_acquired.set_value(true);
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(wake_mutex);
+            wake.wait(lock, [this]() {
+                return !running || (middle.load(std::memory_order_acquire) & FRESH_BIT);
+            });
+            if (!running) {
+                break;
+            }
+        }
+
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        const RenderSnapshot& snapshot = snapshots[front];
+
+        PROFILE_ZONE("RenderThread::frame");
+        if (facade->begin_frame().is_ok()) {
+            snapshot.replay(facade->get_gpu_renderer(), facade);
+            facade->account_replayed_sprites(snapshot.get_facade_sprite_count());
+            facade->end_frame();
+        }
+        {
+            PROFILE_ZONE("SDL_GL_SwapWindow");
+            SDL_GL_SwapWindow(window);
+        }
+        InputLatency::record_presented(snapshot.get_input_timestamp(), SDL_GetTicksNS());
+        frames_rendered.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Hand the context back to whoever calls stop()
+    SDL_GL_MakeCurrent(window, nullptr);
+}
@@ -0,0 +1,82 @@
+#ifndef RENDERTHREAD_H
+#define RENDERTHREAD_H
+
+#include "RenderSnapshot.h"
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+class RenderingFacade;
+
+/**
+ * @brief Hilo de render dueño del contexto GL, alimentado con RenderSnapshots
+ *
+ * Triple buffer: el hilo de simulación graba siempre en su snapshot `back`,
+ * publish() lo intercambia con el del medio y marca que hay frame nuevo; el
+ * hilo de render toma el del medio cuando está marcado. Ninguno espera al otro
+ * salvo el render cuando no hay nada nuevo que dibujar: si la simulación va
+ * más rápida, los frames intermedios se descartan (siempre se pinta el último).
+ *
+ * Con el hilo activo el tiempo de frame pasa de sim + render a max(sim, render).
+ */
+class RenderThread {
+public:
+    RenderThread();
+    ~RenderThread();
+
+    /**
+     * @brief Suelta el contexto GL del hilo actual y arranca el hilo de render
+     * A partir de aquí el hilo llamante graba (GPUAcceleratedRenderer::set_recording).
+     */
+    bool start(SDL_Window* window, SDL_GLContext context, RenderingFacade* facade);
+
+    /**
+     * @brief Para el hilo y devuelve el contexto GL al hilo llamante
+     */
+    void stop();
+
+    bool is_running() const { return running; }
+
+    /**
+     * @brief Snapshot vacío donde grabar el siguiente frame (hilo de simulación)
+     */
+    RenderSnapshot* begin_snapshot();
+
+    /**
+     * @brief Entrega el snapshot grabado al hilo de render
+     */
+    void publish();
+
+    uint64_t get_frames_rendered() const { return frames_rendered.load(std::memory_order_relaxed); }
+    uint64_t get_frames_dropped() const { return frames_dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr int FRESH_BIT = 4;   // En `middle`: el índice es un frame aún no pintado
+    static constexpr int INDEX_MASK = 3;
+
+    RenderSnapshot snapshots[3];
+    int back;                        // Solo hilo de simulación
+    int front;                       // Solo hilo de render
+    std::atomic<int> middle;
+    uint64_t carried_input_ns;       // Entrada de un snapshot descartado (solo simulación)
+
+    SDL_Window* window;
+    SDL_GLContext context;
+    RenderingFacade* facade;
+
+    std::thread thread;
+    std::atomic<bool> running;
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    std::promise<bool> context_acquired;  // start() espera a que el hilo tenga el contexto GL
+
+    std::atomic<uint64_t> frames_rendered;
+    std::atomic<uint64_t> frames_dropped;
+
+    void render_loop();
+};
+
+#endif
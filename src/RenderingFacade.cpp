@@ -1,7 +1,9 @@
 #include "RenderingFacade.h"
+#include "Logger.h"
 #include "Resources.h"
 #include "GPUAcceleratedRenderer.h"
 #include "TextRenderer.h"
+#include "RenderSnapshot.h"
 #include <SDL3/SDL.h>
 #include <algorithm>
 
@@ -9,7 +11,7 @@
 
 RenderingFacade::RenderingFacade(RenderingConfig config) 
     : config(config), initialized(false), frame_started(false) {
-    SDL_Log("RenderingFacade: Initialized with config - GPU acceleration: %s, Particle effects: %s", 
+    LOG_INFO(RENDER, "RenderingFacade: Initialized with config - GPU acceleration: %s, Particle effects: %s", 
         config.enable_gpu_acceleration ? "enabled" : "disabled",
         config.enable_particle_effects ? "enabled" : "disabled");
 }
@@ -28,7 +30,7 @@ GameResult<void> RenderingFacade::initialize(SDL_Window* window, int width, int
     screen_width = width;
     screen_height = height;
     
-    SDL_Log("RenderingFacade: Initializing subsystems for %dx%d display", width, height);
+    LOG_INFO(RENDER, "RenderingFacade: Initializing subsystems for %dx%d display", width, height);
     
     // Initialize subsystems in order
     auto gpu_result = initialize_gpu_renderer(window);
@@ -49,14 +51,14 @@ GameResult<void> RenderingFacade::initialize(SDL_Window* window, int width, int
     initialized = true;
     reset_statistics();
     
-    SDL_Log("RenderingFacade: All subsystems initialized successfully");
+    LOG_INFO(RENDER, "RenderingFacade: All subsystems initialized successfully");
     return GameResult<void>::success();
 }
 
 void RenderingFacade::shutdown() {
     if (!initialized) return;
     
-    SDL_Log("RenderingFacade: Shutting down all rendering subsystems");
+    LOG_INFO(RENDER, "RenderingFacade: Shutting down all rendering subsystems");
     
     // Shutdown in reverse order
     particle_manager.reset();
@@ -143,7 +145,9 @@ GameResult<void> RenderingFacade::render_sprite(const std::string& texture_name,
                                               int sprite_nr,
                                               float rotation,
                                               uint8_t opacity) {
-    if (!initialized || !frame_started) {
+    // While recording, frames are opened by the render thread, not this one
+    RenderSnapshot* recording = GPUAcceleratedRenderer::get_recording();
+    if (!initialized || (!frame_started && !recording)) {
         return GameResult<void>::error(GameErrorType::RENDER_ERROR, ErrorSeverity::WARNING,
             "RenderingFacade not ready for rendering");
     }
@@ -185,8 +189,12 @@ GameResult<void> RenderingFacade::render_sprite(const std::string& texture_name,
         );
         gpu_renderer->end_batch();
         
-        stats.sprites_rendered++;
-        stats.draw_calls++;
+        if (recording) {
+            recording->count_facade_sprite();
+        } else {
+            stats.sprites_rendered++;
+            stats.draw_calls++;
+        }
         
         return GameResult<void>::success();
         
@@ -221,7 +229,7 @@ GameResult<void> RenderingFacade::render_sprite_batch(const std::string& texture
     }
     
     // TODO: Implement proper batch rendering with GPU renderer
-    SDL_Log("RenderingFacade: Batch rendering %zu sprites for texture '%s'", 
+    LOG_DEBUG(RENDER, "RenderingFacade: Batch rendering %zu sprites for texture '%s'", 
         commands.size(), texture_name.c_str());
     
     stats.sprites_rendered += commands.size();
@@ -236,6 +244,16 @@ GameResult<void> RenderingFacade::render_text(const std::string& text,
                                             const PixelCoord& position,
                                             const std::string& font_name,
                                             uint8_t r, uint8_t g, uint8_t b) {
+    // Text textures are GL objects: resolve them when the render thread replays the frame
+    if (RenderSnapshot* recording = GPUAcceleratedRenderer::get_recording()) {
+        if (!initialized || !text_renderer) {
+            return GameResult<void>::error(GameErrorType::RENDER_ERROR, ErrorSeverity::WARNING,
+                "Text renderer not available");
+        }
+        recording->render_text(text, position.pixel_x, position.pixel_y, font_name, r, g, b);
+        return GameResult<void>::success();
+    }
+    
     if (!initialized || !frame_started) {
         return GameResult<void>::error(GameErrorType::RENDER_ERROR, ErrorSeverity::WARNING,
             "RenderingFacade not ready for text rendering");
@@ -251,13 +269,13 @@ GameResult<void> RenderingFacade::render_text(const std::string& text,
         int x = static_cast<int>(position.pixel_x);
         int y = static_cast<int>(position.pixel_y);
         
-        // Use the integrated TextRenderer to create text texture and render it
-        SDL_Color color = {r, g, b, 255};
-        auto text_texture = text_renderer->render_text(text, font_name, color);
-        
-        if (!text_texture || !text_texture->gl_texture) {
+        // Lay the string out against the font's glyph atlas: no GL texture per string
+        int text_width = 0;
+        int text_height = 0;
+        GLuint atlas_texture = text_renderer->layout_text(text, font_name, glyph_quads, text_width, text_height);
+        if (!atlas_texture) {
             return GameResult<void>::error(GameErrorType::RENDER_ERROR, ErrorSeverity::WARNING,
-                "Failed to create text texture for: " + text);
+                "Failed to lay out text: " + text);
         }
         
         // Calculate actual position - if this is for centered text, adjust x coordinate
@@ -266,17 +284,18 @@ GameResult<void> RenderingFacade::render_text(const std::string& text,
         // Check if this looks like a center coordinate (around screen center)
         if (x >= 300 && x <= 500) {
             // This is likely meant to be centered - calculate proper center position
-            actual_x = static_cast<float>(x) - (static_cast<float>(text_texture->width) / 2.0f);
+            actual_x = static_cast<float>(x) - (static_cast<float>(text_width) / 2.0f);
         }
         
-        // Render the text texture using GPU renderer
+        // The whole string goes out as one batch: glyphs are white, tinted by the vertex colour
         if (gpu_renderer) {
+            const float tint[4] = {r / 255.0f, g / 255.0f, b / 255.0f, 1.0f};
+            GPUAcceleratedRenderer::GpuPassScope gpu_pass(gpu_renderer.get(), GPUAcceleratedRenderer::GPU_PASS_TEXT);
             gpu_renderer->begin_batch();
-            gpu_renderer->add_sprite(
-                actual_x, static_cast<float>(y),
-                static_cast<float>(text_texture->width), static_cast<float>(text_texture->height),
-                text_texture->gl_texture, nullptr, 0.0f, nullptr, 0
-            );
+            for (const GlyphQuad& quad : glyph_quads) {
+                gpu_renderer->add_textured_quad(actual_x + quad.x, static_cast<float>(y) + quad.y, quad.w, quad.h,
+                                                atlas_texture, quad.u0, quad.v0, quad.u1, quad.v1, tint);
+            }
             gpu_renderer->end_batch();
         }
         
@@ -315,7 +334,7 @@ GameResult<void> RenderingFacade::render_particle_effect(const std::string& effe
         
         // Note: This is a simplified implementation
         // Real implementation would call particle_manager->create_effect(effect_type, position, intensity)
-        SDL_Log("RenderingFacade: Creating particle effect '%s' at (%.1f, %.1f) intensity=%.2f", 
+        LOG_DEBUG(RENDER, "RenderingFacade: Creating particle effect '%s' at (%.1f, %.1f) intensity=%.2f", 
             effect_type.c_str(), position.pixel_x, position.pixel_y, intensity);
         
         // Estimate particle count based on effect type and intensity
@@ -330,33 +349,62 @@ GameResult<void> RenderingFacade::render_particle_effect(const std::string& effe
     }
 }
 
+GameResult<void> RenderingFacade::render_explosion_batch() {
+    if (!initialized || !gpu_renderer) {
+        return GameResult<void>::error(GameErrorType::RENDER_ERROR, ErrorSeverity::WARNING,
+            "RenderingFacade not ready for explosion rendering");
+    }
+    
+    if (GPUAcceleratedRenderer::get_recording()) {
+        gpu_renderer->render_explosions(); // Recorded; the queue lives on the render thread
+        return GameResult<void>::success();
+    }
+    
+    if (gpu_renderer->get_queued_explosion_count() > 0) {
+        gpu_renderer->render_explosions();
+        stats.draw_calls++;
+    }
+    
+    return GameResult<void>::success();
+}
+
 // === UTILITY FUNCTIONS ===
 
 PixelCoord RenderingFacade::screen_to_world(const PixelCoord& screen_coord) const {
-    // For now, assume screen coordinates are the same as world coordinates
-    // In a more complex system, this would handle camera transforms, zoom, etc.
-    return screen_coord;
+    return PixelCoord(screen_coord.pixel_x + camera.pixel_x, screen_coord.pixel_y + camera.pixel_y);
 }
 
 PixelCoord RenderingFacade::world_to_screen(const PixelCoord& world_coord) const {
-    // For now, assume world coordinates are the same as screen coordinates
-    return world_coord;
+    return PixelCoord(world_coord.pixel_x - camera.pixel_x, world_coord.pixel_y - camera.pixel_y);
 }
 
 bool RenderingFacade::is_position_visible(const PixelCoord& position) const {
-    return position.pixel_x >= 0 && position.pixel_x < screen_width &&
-           position.pixel_y >= 0 && position.pixel_y < screen_height;
+    // Sprites are anchored top-left and at most a tile in size
+    constexpr float margin = static_cast<float>(CoordinateConfig::TILE_SIZE);
+    return position.pixel_x >= camera.pixel_x - margin && position.pixel_x < camera.pixel_x + screen_width &&
+           position.pixel_y >= camera.pixel_y - margin && position.pixel_y < camera.pixel_y + screen_height;
 }
 
 RenderingFacade::ViewportBounds RenderingFacade::get_viewport_bounds() const {
-    return ViewportBounds{0, 0, screen_width, screen_height};
+    return ViewportBounds{static_cast<int>(camera.pixel_x), static_cast<int>(camera.pixel_y), screen_width, screen_height};
+}
+
+void RenderingFacade::set_camera(const PixelCoord& top_left) {
+    if (top_left == camera) {
+        return; // Unchanged: no flush, nothing recorded
+    }
+    camera = top_left;
+    if (gpu_renderer) {
+        const float position[2] = {camera.pixel_x, camera.pixel_y};
+        gpu_renderer->set_camera(position);
+    }
 }
 
 // === CONFIGURATION ===
 
 void RenderingFacade::update_config(const RenderingConfig& new_config) {
     config = new_config;
-    SDL_Log("RenderingFacade: Configuration updated");
+    LOG_INFO(RENDER, "RenderingFacade: Configuration updated");
     
     // Apply configuration changes to subsystems
     if (gpu_renderer && config.enable_debug_overlays) {
@@ -366,7 +414,7 @@ void RenderingFacade::update_config(const RenderingConfig& new_config) {
 
 void RenderingFacade::set_debug_mode(bool enabled) {
     config.enable_debug_overlays = enabled;
-    SDL_Log("RenderingFacade: Debug mode %s", enabled ? "enabled" : "disabled");
+    LOG_INFO(RENDER, "RenderingFacade: Debug mode %s", enabled ? "enabled" : "disabled");
 }
 
 // === STATISTICS & DEBUGGING ===
@@ -398,7 +446,7 @@ GameResult<void> RenderingFacade::preload_texture(const std::string& texture_nam
     try {
         // Note: This is a simplified implementation
         // Real implementation would call gpu_renderer->preload_texture(texture_name)
-        SDL_Log("RenderingFacade: Preloading texture '%s'", texture_name.c_str());
+        LOG_DEBUG(RENDER, "RenderingFacade: Preloading texture '%s'", texture_name.c_str());
         
         return GameResult<void>::success();
         
@@ -412,7 +460,7 @@ void RenderingFacade::unload_texture(const std::string& texture_name) {
     
     // Note: This is a simplified implementation
     // Real implementation would call gpu_renderer->unload_texture(texture_name)
-    SDL_Log("RenderingFacade: Unloading texture '%s'", texture_name.c_str());
+    LOG_DEBUG(RENDER, "RenderingFacade: Unloading texture '%s'", texture_name.c_str());
 }
 
 RenderingFacade::TextureInfo RenderingFacade::get_texture_info(const std::string& texture_name) const {
@@ -437,12 +485,12 @@ RenderingFacade::TextureInfo RenderingFacade::get_texture_info(const std::string
 
 GameResult<void> RenderingFacade::initialize_gpu_renderer(SDL_Window* window) {
     if (!config.enable_gpu_acceleration) {
-        SDL_Log("RenderingFacade: GPU acceleration disabled, skipping GPU renderer initialization");
+        LOG_INFO(RENDER, "RenderingFacade: GPU acceleration disabled, skipping GPU renderer initialization");
         return GameResult<void>::success();
     }
     
     try {
-        SDL_Log("RenderingFacade: Creating dedicated GPUAcceleratedRenderer");
+        LOG_INFO(RENDER, "RenderingFacade: Creating dedicated GPUAcceleratedRenderer");
         gpu_renderer = std::make_unique<GPUAcceleratedRenderer>();
         
         auto init_result = gpu_renderer->initialize(window, screen_width, screen_height);
@@ -453,7 +501,7 @@ GameResult<void> RenderingFacade::initialize_gpu_renderer(SDL_Window* window) {
                 init_result.get_error_context());
         }
         
-        SDL_Log("RenderingFacade: GPU renderer created and initialized successfully");
+        LOG_INFO(RENDER, "RenderingFacade: GPU renderer created and initialized successfully");
         return GameResult<void>::success();
         
     } catch (const std::exception& e) {
@@ -464,7 +512,7 @@ GameResult<void> RenderingFacade::initialize_gpu_renderer(SDL_Window* window) {
 
 GameResult<void> RenderingFacade::initialize_text_renderer() {
     try {
-        SDL_Log("RenderingFacade: Creating and initializing real TextRenderer");
+        LOG_INFO(RENDER, "RenderingFacade: Creating and initializing real TextRenderer");
         text_renderer = std::make_unique<TextRenderer>();
         
         if (!text_renderer->initialize()) {
@@ -479,23 +527,23 @@ GameResult<void> RenderingFacade::initialize_text_renderer() {
         
         // Load big font
         if (text_renderer->load_font("big", base_path + "data/fonts/DejaVuSans-Bold.ttf", 28)) {
-            SDL_Log("RenderingFacade: Loaded big font successfully");
+            LOG_INFO(RENDER, "RenderingFacade: Loaded big font successfully");
         } else if (text_renderer->load_font("big", "/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf", 28)) {
-            SDL_Log("RenderingFacade: Loaded big font from system path");
+            LOG_INFO(RENDER, "RenderingFacade: Loaded big font from system path");
         } else {
-            SDL_Log("RenderingFacade: WARNING - Failed to load big font");
+            LOG_WARN(RENDER, "RenderingFacade: WARNING - Failed to load big font");
         }
         
         // Load small font
         if (text_renderer->load_font("small", base_path + "data/fonts/DejaVuSans-Bold.ttf", 18)) {
-            SDL_Log("RenderingFacade: Loaded small font successfully");
+            LOG_INFO(RENDER, "RenderingFacade: Loaded small font successfully");
         } else if (text_renderer->load_font("small", "/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf", 18)) {
-            SDL_Log("RenderingFacade: Loaded small font from system path");
+            LOG_INFO(RENDER, "RenderingFacade: Loaded small font from system path");
         } else {
-            SDL_Log("RenderingFacade: WARNING - Failed to load small font");
+            LOG_WARN(RENDER, "RenderingFacade: WARNING - Failed to load small font");
         }
         
-        SDL_Log("RenderingFacade: TextRenderer initialized successfully");
+        LOG_INFO(RENDER, "RenderingFacade: TextRenderer initialized successfully");
         return GameResult<void>::success();
         
     } catch (const std::exception& e) {
@@ -506,7 +554,7 @@ GameResult<void> RenderingFacade::initialize_text_renderer() {
 
 GameResult<void> RenderingFacade::initialize_particle_manager() {
     if (!config.enable_particle_effects) {
-        SDL_Log("RenderingFacade: Particle effects disabled, skipping particle manager initialization");
+        LOG_INFO(RENDER, "RenderingFacade: Particle effects disabled, skipping particle manager initialization");
         return GameResult<void>::success();
     }
     
@@ -516,7 +564,7 @@ GameResult<void> RenderingFacade::initialize_particle_manager() {
         // particle_manager = std::make_unique<ParticleEffectsManager>();
         // return particle_manager->initialize(config.max_particles);
         
-        SDL_Log("RenderingFacade: Particle manager initialized (mock) with max %d particles", config.max_particles);
+        LOG_INFO(RENDER, "RenderingFacade: Particle manager initialized (mock) with max %d particles", config.max_particles);
         return GameResult<void>::success();
         
     } catch (const std::exception& e) {
@@ -526,23 +574,33 @@ GameResult<void> RenderingFacade::initialize_particle_manager() {
 }
 
 void RenderingFacade::update_statistics() {
-    // Calculate frame time (simplified)
-    static Uint64 last_time = SDL_GetTicks();
-    Uint64 current_time = SDL_GetTicks();
-    stats.frame_time_ms = static_cast<float>(current_time - last_time);
-    last_time = current_time;
+    // Frame-to-frame time with the high resolution counter (SDL_GetTicks is whole ms)
+    static Uint64 last_counter = SDL_GetPerformanceCounter();
+    Uint64 current_counter = SDL_GetPerformanceCounter();
+    stats.frame_time_ms = static_cast<float>(current_counter - last_counter) * 1000.0f /
+                          static_cast<float>(SDL_GetPerformanceFrequency());
+    last_counter = current_counter;
     
     // Update texture memory usage estimate
     stats.texture_memory_usage = stats.sprites_rendered * 4096; // Rough estimate
+    
+    if (gpu_renderer) {
+        const auto& timings = gpu_renderer->get_gpu_timings();
+        stats.gpu_timing_valid = timings.valid;
+        stats.gpu_frame_ms = timings.frame_ms;
+        for (int i = 0; i < GPUAcceleratedRenderer::GPU_PASS_COUNT; i++) {
+            stats.gpu_pass_ms[i] = timings.pass_ms[i];
+        }
+    }
 }
 
 void RenderingFacade::validate_rendering_state() const {
     if (!initialized) {
-        SDL_Log("WARNING: RenderingFacade used before initialization");
+        LOG_WARN(RENDER, "RenderingFacade used before initialization");
     }
     
     if (frame_started && !gpu_renderer) {
-        SDL_Log("WARNING: Frame started but no GPU renderer available");
+        LOG_WARN(RENDER, "Frame started but no GPU renderer available");
     }
 }
 
@@ -550,7 +608,7 @@ void RenderingFacade::validate_rendering_state() const {
 
 GameResult<void> RenderingFacade::handle_gpu_error(const std::string& operation) const {
     // Simplified error handling - in real implementation would check GPU renderer status
-    SDL_Log("RenderingFacade: GPU operation '%s' completed", operation.c_str());
+    LOG_DEBUG(RENDER, "RenderingFacade: GPU operation '%s' completed", operation.c_str());
     return GameResult<void>::success();
 }
 
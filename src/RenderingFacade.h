@@ -66,6 +66,11 @@ struct RenderingStats {
     uint32_t draw_calls = 0;
     float frame_time_ms = 0.0f;
     size_t texture_memory_usage = 0;
+    
+    // Tiempos GPU (timer queries): corresponden a un frame de hace unos pocos frames
+    bool gpu_timing_valid = false;
+    float gpu_frame_ms = 0.0f;
+    float gpu_pass_ms[GPUAcceleratedRenderer::GPU_PASS_COUNT] = {};
 };
 
 /**
@@ -147,6 +152,11 @@ public:
      */
     GameResult<void> render_sprite_batch(const std::string& texture_name,
                                         const std::vector<RenderCommand>& commands);
+    
+    /**
+     * @brief Dibuja todas las explosiones encoladas en un único draw call instanciado
+     */
+    GameResult<void> render_explosion_batch();
 
     // === TEXT RENDERING ===
     
@@ -189,10 +199,19 @@ public:
     PixelCoord world_to_screen(const PixelCoord& world_coord) const;
     
     /**
-     * @brief Verifica si una posición está visible en pantalla
+     * @brief Verifica si un sprite con esquina en `position` puede verse con la cámara actual
+     * Deja un margen de un tile por arriba y por la izquierda (el sprite asoma aunque su esquina no).
      */
     bool is_position_visible(const PixelCoord& position) const;
     
+    /**
+     * @brief Coloca la cámara del mundo: `top_left` es el pixel del mundo en la esquina de la pantalla
+     * Se aplica a lo que se dibuje después (sprites, explosiones, partículas, decals);
+     * (0,0) es la vista clásica, la que usan HUD y menús.
+     */
+    void set_camera(const PixelCoord& top_left);
+    const PixelCoord& get_camera() const { return camera; }
+    
     /**
      * @brief Obtiene bounds del viewport actual
      */
@@ -230,6 +249,12 @@ public:
      */
     void reset_statistics();
     
+    /**
+     * @brief Suma los sprites de un RenderSnapshot reproducido (hilo de render)
+     * Al grabar no se tocan las estadísticas desde el hilo de simulación.
+     */
+    void account_replayed_sprites(uint32_t sprites) { stats.sprites_rendered += sprites; stats.draw_calls += sprites; }
+    
     /**
      * @brief Renderiza información de debug en pantalla
      */
@@ -267,12 +292,15 @@ public:
     GPUAcceleratedRenderer* get_gpu_renderer() const { 
         return gpu_renderer.get(); 
     }
+    
+    TextRenderer* get_text_renderer() const { return text_renderer.get(); }
 
 private:
     // Subsistemas de rendering - RenderingFacade tiene ownership completo
     std::unique_ptr<GPUAcceleratedRenderer> gpu_renderer;
     std::unique_ptr<TextRenderer> text_renderer;
     std::unique_ptr<ParticleEffectsManager> particle_manager;
+    std::vector<GlyphQuad> glyph_quads;     // Reutilizado por render_text: sin reservas por frame
     
     // Estado interno
     RenderingConfig config;
@@ -283,6 +311,7 @@ private:
     // Viewport info
     int screen_width = 800;
     int screen_height = 600;
+    PixelCoord camera;          // Esquina superior izquierda de la vista, en el mundo
     
     // Helper methods
     GameResult<void> initialize_gpu_renderer(SDL_Window* window);
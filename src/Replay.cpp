@@ -0,0 +1,365 @@
+#include "Replay.h"
+#include "Controller.h"
+#include "Bomber.h"
+#include "GameConfig.h"
+#include "Logger.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+const char REPLAY_MAGIC[4] = {'C', 'B', 'R', 'P'};
+const uint16_t REPLAY_VERSION = 1;
+
+// GameConfig values that change the outcome of a match. Append only: the
+// order is the file format (bump REPLAY_VERSION when it changes)
+struct ConfigField {
+    int (*get)();
+    void (*set)(int);
+};
+
+const ConfigField CONFIG_FIELDS[] = {
+    {&GameConfig::get_round_time, &GameConfig::set_round_time},
+    {&GameConfig::get_max_skateboards, &GameConfig::set_max_skateboards},
+    {&GameConfig::get_max_power, &GameConfig::set_max_power},
+    {&GameConfig::get_max_bombs, &GameConfig::set_max_bombs},
+    {&GameConfig::get_start_skateboards, &GameConfig::set_start_skateboards},
+    {&GameConfig::get_start_power, &GameConfig::set_start_power},
+    {&GameConfig::get_start_bombs, &GameConfig::set_start_bombs},
+    {&GameConfig::get_start_kick, &GameConfig::set_start_kick},
+    {&GameConfig::get_start_glove, &GameConfig::set_start_glove},
+    {&GameConfig::get_skateboards, &GameConfig::set_skateboards},
+    {&GameConfig::get_power, &GameConfig::set_power},
+    {&GameConfig::get_bombs, &GameConfig::set_bombs},
+    {&GameConfig::get_kick, &GameConfig::set_kick},
+    {&GameConfig::get_glove, &GameConfig::set_glove},
+    {&GameConfig::get_joint, &GameConfig::set_joint},
+    {&GameConfig::get_viagra, &GameConfig::set_viagra},
+    {&GameConfig::get_koks, &GameConfig::set_koks},
+    {&GameConfig::get_start_map, &GameConfig::set_start_map},
+    {&GameConfig::get_random_map_order, &GameConfig::set_random_map_order},
+    {&GameConfig::get_points_to_win, &GameConfig::set_points_to_win},
+    {&GameConfig::get_kids_mode, &GameConfig::set_kids_mode},
+    {&GameConfig::get_random_positions, &GameConfig::set_random_positions},
+    {&GameConfig::get_corpse_parts, &GameConfig::set_corpse_parts},
+    {&GameConfig::get_bomb_countdown, &GameConfig::set_bomb_countdown},
+    {&GameConfig::get_bomb_delay, &GameConfig::set_bomb_delay},
+    {&GameConfig::get_bomb_speed, &GameConfig::set_bomb_speed},
+};
+const size_t CONFIG_FIELD_COUNT = sizeof(CONFIG_FIELDS) / sizeof(CONFIG_FIELDS[0]);
+
+class ByteWriter {
+public:
+    std::vector<uint8_t> data;
+
+    void u8(uint8_t value) { data.push_back(value); }
+    void u16(uint16_t value) { u8(value & 0xFF); u8(value >> 8); }
+    void u32(uint32_t value) { u16(value & 0xFFFF); u16(value >> 16); }
+    void i32(int value) { u32(static_cast<uint32_t>(value)); }
+    void f32(float value) { uint32_t bits; std::memcpy(&bits, &value, 4); u32(bits); }
+    void varint(uint64_t value) {
+        while (value >= 0x80) {
+            u8(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        u8(static_cast<uint8_t>(value));
+    }
+    void str(const std::string& value) {
+        u16(static_cast<uint16_t>(value.size()));
+        data.insert(data.end(), value.begin(), value.begin() + static_cast<uint16_t>(value.size()));
+    }
+    void bytes(const uint8_t* values, size_t count) { data.insert(data.end(), values, values + count); }
+};
+
+// Every read checks bounds; after the first failure ok() is false and reads return 0
+class ByteReader {
+public:
+    ByteReader(const std::vector<uint8_t>& _data) : data(_data), offset(0), good(true) {}
+
+    bool ok() const { return good; }
+    bool at_end() const { return offset == data.size(); }
+
+    uint8_t u8() { return need(1) ? data[offset++] : 0; }
+    uint16_t u16() { uint16_t low = u8(); return static_cast<uint16_t>(low | (u8() << 8)); }
+    uint32_t u32() { uint32_t low = u16(); return low | (static_cast<uint32_t>(u16()) << 16); }
+    int i32() { return static_cast<int>(u32()); }
+    float f32() { uint32_t bits = u32(); float value; std::memcpy(&value, &bits, 4); return value; }
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64 && good; shift += 7) {
+            uint8_t byte = u8();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        good = false;
+        return 0;
+    }
+    std::string str() {
+        uint16_t length = u16();
+        if (!need(length)) return std::string();
+        std::string value(reinterpret_cast<const char*>(&data[offset]), length);
+        offset += length;
+        return value;
+    }
+    const uint8_t* bytes(size_t count) {
+        if (!need(count)) return nullptr;
+        const uint8_t* values = &data[offset];
+        offset += count;
+        return values;
+    }
+
+private:
+    const std::vector<uint8_t>& data;
+    size_t offset;
+    bool good;
+
+    bool need(size_t count) {
+        if (!good || data.size() - offset < count) {
+            good = false;
+        }
+        return good;
+    }
+};
+
+GameResult<std::shared_ptr<Replay>> load_error(const std::string& message, const std::string& path) {
+    return GameResult<std::shared_ptr<Replay>>::error(GameErrorType::FILE_IO_ERROR, ErrorSeverity::ERROR,
+                                                      message, path);
+}
+
+} // namespace
+
+Replay::Replay()
+    : seed(0), step_seconds(0.0f), tick_count(0), playback_tick(0) {
+}
+
+// === Grabación ===
+
+void Replay::begin(uint32_t _seed, const std::string& _map_name, float _step_seconds) {
+    seed = _seed;
+    map_name = _map_name;
+    step_seconds = _step_seconds;
+
+    settings.clear();
+    for (const ConfigField& field : CONFIG_FIELDS) {
+        settings.push_back(field.get());
+    }
+    for (int i = 0; i < SLOTS; i++) {
+        BomberConfig& config = GameConfig::bomber[i];
+        bomber_setup[i].enabled = config.is_enabled();
+        bomber_setup[i].skin = config.get_skin();
+        bomber_setup[i].team = config.get_team();
+        bomber_setup[i].controller = config.get_controller();
+        bomber_setup[i].name = config.get_name();
+    }
+
+    inputs.clear();
+    inputs.reserve(SLOTS * 60 * 300);   // 5 minutes at 60 Hz before the first regrow
+    tick_count = 0;
+    checksums.clear();
+    playback_tick = 0;
+}
+
+uint8_t Replay::capture_input(Controller* controller) {
+    if (!controller) {
+        return 0;
+    }
+    uint8_t bits = 0;
+    if (controller->is_left()) bits |= INPUT_LEFT;
+    if (controller->is_right()) bits |= INPUT_RIGHT;
+    if (controller->is_up()) bits |= INPUT_UP;
+    if (controller->is_down()) bits |= INPUT_DOWN;
+    if (controller->is_bomb()) bits |= INPUT_BOMB;
+    return bits;
+}
+
+void Replay::record_tick(const std::list<std::unique_ptr<Bomber>>& bombers) {
+    uint8_t row[SLOTS] = {};
+    for (const auto& bomber : bombers) {
+        if (!bomber) continue;
+        int slot = bomber->get_number();
+        if (slot >= 0 && slot < SLOTS) {
+            row[slot] = capture_input(bomber->get_controller());
+        }
+    }
+    push_row(row);
+}
+
+void Replay::push_row(const uint8_t* row) {
+    inputs.insert(inputs.end(), row, row + SLOTS);
+    tick_count++;
+}
+
+void Replay::record_checksum(uint32_t checksum) {
+    checksums.push_back(checksum);
+}
+
+uint32_t Replay::compute_checksum(const std::list<std::unique_ptr<Bomber>>& bombers) {
+    uint32_t hash = 2166136261u;   // FNV-1a over what a desync changes first
+    auto mix = [&hash](int value) {
+        uint32_t bits = static_cast<uint32_t>(value);
+        for (int i = 0; i < 4; i++) {
+            hash = (hash ^ ((bits >> (i * 8)) & 0xFF)) * 16777619u;
+        }
+    };
+    for (const auto& bomber : bombers) {
+        if (!bomber) continue;
+        mix(bomber->get_number());
+        mix(bomber->get_x());
+        mix(bomber->get_y());
+        mix(bomber->get_lives());
+        mix(bomber->is_dead() ? 1 : 0);
+    }
+    return hash;
+}
+
+GameResult<void> Replay::save(const std::string& path) const {
+    ByteWriter out;
+    out.bytes(reinterpret_cast<const uint8_t*>(REPLAY_MAGIC), sizeof(REPLAY_MAGIC));
+    out.u16(REPLAY_VERSION);
+    out.u32(seed);
+    out.f32(step_seconds);
+    out.str(map_name);
+
+    out.u16(static_cast<uint16_t>(settings.size()));
+    for (int value : settings) {
+        out.i32(value);
+    }
+    for (const BomberSetup& setup : bomber_setup) {
+        out.i32(setup.enabled);
+        out.i32(setup.skin);
+        out.i32(setup.team);
+        out.i32(setup.controller);
+        out.str(setup.name);
+    }
+
+    // Inputs: (run length, row) pairs of identical consecutive ticks
+    out.u32(static_cast<uint32_t>(tick_count));
+    size_t tick = 0;
+    while (tick < tick_count) {
+        const uint8_t* row = &inputs[tick * SLOTS];
+        size_t run = 1;
+        while (tick + run < tick_count && std::memcmp(row, &inputs[(tick + run) * SLOTS], SLOTS) == 0) {
+            run++;
+        }
+        out.varint(run);
+        out.bytes(row, SLOTS);
+        tick += run;
+    }
+
+    out.u32(static_cast<uint32_t>(checksums.size()));
+    for (uint32_t checksum : checksums) {
+        out.u32(checksum);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return GameResult<void>::error(GameErrorType::FILE_IO_ERROR, ErrorSeverity::ERROR,
+                                       "Cannot open replay file for writing", path);
+    }
+    file.write(reinterpret_cast<const char*>(out.data.data()), static_cast<std::streamsize>(out.data.size()));
+    if (!file) {
+        return GameResult<void>::error(GameErrorType::FILE_IO_ERROR, ErrorSeverity::ERROR,
+                                       "Failed writing replay file", path);
+    }
+
+    LOG_INFO(GAME, "Replay: saved %zu ticks (%zu bytes, seed %u, map '%s') to %s",
+             tick_count, out.data.size(), seed, map_name.c_str(), path.c_str());
+    return GameResult<void>::success();
+}
+
+// === Reproducción ===
+
+GameResult<std::shared_ptr<Replay>> Replay::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return load_error("Cannot open replay file", path);
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    ByteReader in(data);
+    const uint8_t* magic = in.bytes(sizeof(REPLAY_MAGIC));
+    if (!magic || std::memcmp(magic, REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0) {
+        return load_error("Not a replay file", path);
+    }
+    uint16_t version = in.u16();
+    if (version != REPLAY_VERSION) {
+        return load_error("Unsupported replay version " + std::to_string(version), path);
+    }
+
+    auto replay = std::make_shared<Replay>();
+    replay->seed = in.u32();
+    replay->step_seconds = in.f32();
+    replay->map_name = in.str();
+
+    uint16_t setting_count = in.u16();
+    for (uint16_t i = 0; i < setting_count && in.ok(); i++) {
+        replay->settings.push_back(in.i32());
+    }
+    for (BomberSetup& setup : replay->bomber_setup) {
+        setup.enabled = in.i32();
+        setup.skin = in.i32();
+        setup.team = in.i32();
+        setup.controller = in.i32();
+        setup.name = in.str();
+    }
+
+    uint32_t tick_count = in.u32();
+    replay->inputs.reserve(static_cast<size_t>(tick_count) * SLOTS);
+    while (replay->tick_count < tick_count && in.ok()) {
+        uint64_t run = in.varint();
+        const uint8_t* row = in.bytes(SLOTS);
+        if (!row || run == 0 || run > tick_count - replay->tick_count) {
+            return load_error("Corrupt replay input stream", path);
+        }
+        for (uint64_t i = 0; i < run; i++) {
+            replay->push_row(row);
+        }
+    }
+
+    uint32_t checksum_count = in.u32();
+    for (uint32_t i = 0; i < checksum_count && in.ok(); i++) {
+        replay->checksums.push_back(in.u32());
+    }
+
+    if (!in.ok()) {
+        return load_error("Truncated replay file", path);
+    }
+
+    LOG_INFO(GAME, "Replay: loaded %zu ticks (seed %u, map '%s') from %s",
+             replay->tick_count, replay->seed, replay->map_name.c_str(), path.c_str());
+    return GameResult<std::shared_ptr<Replay>>::success(std::move(replay));
+}
+
+void Replay::apply_config() const {
+    // Fields missing from an older file keep the local value
+    for (size_t i = 0; i < settings.size() && i < CONFIG_FIELD_COUNT; i++) {
+        CONFIG_FIELDS[i].set(settings[i]);
+    }
+    for (int i = 0; i < SLOTS; i++) {
+        BomberConfig& config = GameConfig::bomber[i];
+        config.set_enabled(bomber_setup[i].enabled != 0);
+        config.set_skin(bomber_setup[i].skin);
+        config.set_team(bomber_setup[i].team);
+        config.set_controller(bomber_setup[i].controller);
+        config.set_name(bomber_setup[i].name);
+    }
+}
+
+uint8_t Replay::get_input(int slot) const {
+    if (playback_tick >= tick_count || slot < 0 || slot >= SLOTS) {
+        return 0;
+    }
+    return inputs[playback_tick * SLOTS + slot];
+}
+
+bool Replay::verify_checksum(uint32_t checksum) const {
+    // Checksums are taken after the last tick of each interval
+    if ((playback_tick + 1) % CHECKSUM_INTERVAL != 0) {
+        return true;
+    }
+    size_t index = (playback_tick + 1) / CHECKSUM_INTERVAL - 1;
+    return index >= checksums.size() || checksums[index] == checksum;
+}
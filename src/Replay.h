@@ -0,0 +1,121 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "ErrorHandling.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Controller;
+class Bomber;
+
+/**
+ * @brief Repetición de una partida: semilla, mapa, configuración y entradas por tick
+ *
+ * La simulación es determinista dado el paso fijo (FramePacer), la semilla de
+ * GameRandom y las entradas de cada bomber, así que no se guarda estado del
+ * mundo: solo los cinco botones (Controller::is_left/right/up/down/bomb) de
+ * cada una de las 8 plazas de GameConfig::bomber en cada tick simulado.
+ *
+ * En disco (.cbr, little-endian) las filas de entradas van en run-length:
+ * los botones cambian pocas veces por segundo, así que un minuto de partida
+ * ocupa unos pocos KB. En memoria se guardan planas para acceso directo.
+ *
+ * Cada CHECKSUM_INTERVAL ticks se guarda un hash de posición/vida de los
+ * bombers; en reproducción, el primer hash distinto se avisa como desync.
+ */
+class Replay {
+public:
+    static constexpr int SLOTS = 8;
+    static constexpr int CHECKSUM_INTERVAL = 60;
+
+    enum InputBits : uint8_t {
+        INPUT_LEFT  = 1 << 0,
+        INPUT_RIGHT = 1 << 1,
+        INPUT_UP    = 1 << 2,
+        INPUT_DOWN  = 1 << 3,
+        INPUT_BOMB  = 1 << 4
+    };
+
+    struct BomberSetup {
+        int enabled = 0;
+        int skin = 0;
+        int team = 0;
+        int controller = 0;
+        std::string name;
+    };
+
+    Replay();
+
+    // === Grabación ===
+
+    /**
+     * @brief Empieza una grabación con la GameConfig actual
+     * Llamar después de cargar el mapa y sembrar GameRandom.
+     */
+    void begin(uint32_t seed, const std::string& map_name, float step_seconds);
+
+    /**
+     * @brief Añade un tick con lo que cada controller devuelve ahora mismo
+     * @param bombers Bombers vivos o no; la plaza sale de Bomber::get_number()
+     */
+    void record_tick(const std::list<std::unique_ptr<Bomber>>& bombers);
+
+    void record_checksum(uint32_t checksum);
+
+    GameResult<void> save(const std::string& path) const;
+
+    // === Reproducción ===
+
+    static GameResult<std::shared_ptr<Replay>> load(const std::string& path);
+
+    /**
+     * @brief Sobrescribe GameConfig con la configuración grabada (no la guarda a disco)
+     */
+    void apply_config() const;
+
+    /**
+     * @brief Tick que está simulando la partida (lo avanza GameplayScreen)
+     */
+    void set_playback_tick(size_t tick) { playback_tick = tick; }
+    size_t get_playback_tick() const { return playback_tick; }
+    bool is_finished() const { return playback_tick >= tick_count; }
+
+    uint8_t get_input(int slot) const;
+
+    /**
+     * @brief Compara con el hash grabado del tick actual
+     * @return false solo si hay hash grabado y no coincide
+     */
+    bool verify_checksum(uint32_t checksum) const;
+
+    // === Datos ===
+
+    uint32_t get_seed() const { return seed; }
+    const std::string& get_map_name() const { return map_name; }
+    float get_step_seconds() const { return step_seconds; }
+    size_t get_tick_count() const { return tick_count; }
+
+    static uint8_t capture_input(Controller* controller);
+
+    static uint32_t compute_checksum(const std::list<std::unique_ptr<Bomber>>& bombers);
+
+private:
+    uint32_t seed;
+    std::string map_name;
+    float step_seconds;
+    std::vector<int> settings;                 // Orden de la tabla CONFIG_FIELDS (Replay.cpp)
+    BomberSetup bomber_setup[SLOTS];
+
+    std::vector<uint8_t> inputs;               // tick_count * SLOTS
+    size_t tick_count;
+    std::vector<uint32_t> checksums;           // Uno cada CHECKSUM_INTERVAL ticks
+
+    size_t playback_tick;
+
+    void push_row(const uint8_t* row);
+};
+
+#endif
@@ -1,13 +1,19 @@
 #include "Resources.h"
+#include "Logger.h"
 #include "AudioMixer.h"
 #include "GPUAcceleratedRenderer.h"
 #include "CoordinateSystem.h"
+#include "ThreadPool.h"
+#include "AssetPack.h"
+#include "Profiler.h"
 #include <SDL3_image/SDL_image.h>
 #include <glad/gl.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <vector>
+#include <chrono>
+#include <cstdlib>
 
 // Phase 3: Import CoordinateConfig constants
 static constexpr int TILE_SIZE = CoordinateConfig::TILE_SIZE;
@@ -15,8 +21,103 @@ static constexpr int TILE_SIZE = CoordinateConfig::TILE_SIZE;
 std::string Resources::base_path;
 std::map<std::string, TextureInfo*> Resources::textures;
 std::map<std::string, TTF_Font*> Resources::fonts;
+ThreadPool* Resources::loader_pool = nullptr;
+std::mutex Resources::decoded_mutex;
+std::condition_variable Resources::decoded_ready;
+std::deque<Resources::DecodedAsset> Resources::decoded;
+int Resources::assets_total = 0;
+int Resources::assets_loaded = 0;
+Uint64 Resources::loading_start_ns = 0;
+LoadingCallback Resources::loading_callback;
+AssetPack Resources::pack;
+
+const std::vector<Resources::TextureManifestEntry>& Resources::texture_manifest() {
+    static const std::vector<TextureManifestEntry> manifest = {
+        {"titlescreen", "data/pics/clanbomber_title_andi.png", 0, 0},
+        {"fl_logo", "data/pics/fischlustig_logo.png", 0, 0},
+        {"ps_teams", "data/pics/ps_teams.png", 125, 56},
+        {"ps_controls", "data/pics/ps_controls.png", 125, 56},
+        {"ps_teamlamps", "data/pics/ps_teamlamps.png", 30, 32},
+        {"playersetup_background", "data/pics/playersetup.png", 0, 0},
+        {"mapselector_background", "data/pics/level_selection.png", 0, 0},
+        {"mapselector_not_available", "data/pics/not_available.png", 0, 0},
+        {"gamestatus_tools", "data/pics/cup2.png", TILE_SIZE, TILE_SIZE},
+        {"gamestatus_background", "data/pics/game_status.png", 0, 0},
+        {"horst_evil", "data/pics/horst_evil.png", 0, 0},
+        {"bomber_snake", "data/pics/bomber_snake.png", 40, 60},
+        {"bomber_tux", "data/pics/bomber_tux.png", 40, 60},
+        {"bomber_spider", "data/pics/bomber_spider.png", TILE_SIZE, TILE_SIZE},
+        {"bomber_bsd", "data/pics/bomber_bsd.png", TILE_SIZE, 60},
+        {"bomber_dull_red", "data/pics/bomber_dull_red.png", TILE_SIZE, TILE_SIZE},
+        {"bomber_dull_blue", "data/pics/bomber_dull_blue.png", TILE_SIZE, TILE_SIZE},
+        {"bomber_dull_yellow", "data/pics/bomber_dull_yellow.png", TILE_SIZE, TILE_SIZE},
+        {"bomber_dull_green", "data/pics/bomber_dull_green.png", TILE_SIZE, TILE_SIZE},
+        {"observer", "data/pics/observer.png", TILE_SIZE, TILE_SIZE},
+        {"maptiles", "data/pics/maptiles.png", TILE_SIZE, TILE_SIZE},
+        {"maptile_addons", "data/pics/maptile_addons.png", TILE_SIZE, TILE_SIZE},
+        {"bombs", "data/pics/bombs.png", TILE_SIZE, TILE_SIZE},
+        {"explosion", "data/pics/explosion2.png", TILE_SIZE, TILE_SIZE},
+        // Power-ups (extras2_X)
+        {"extras2_0", "data/pics/extras2_0.png", TILE_SIZE, TILE_SIZE},  // BOMB
+        {"extras2_1", "data/pics/extras2_1.png", TILE_SIZE, TILE_SIZE},  // FLAME
+        {"extras2_2", "data/pics/extras2_2.png", TILE_SIZE, TILE_SIZE},  // SPEED
+        {"extras2_3", "data/pics/extras2_3.png", TILE_SIZE, TILE_SIZE},  // KICK
+        {"extras2_4", "data/pics/extras2_4.png", TILE_SIZE, TILE_SIZE},  // GLOVE
+        {"extras2_5", "data/pics/extras2_5.png", TILE_SIZE, TILE_SIZE},  // SKATE
+        {"extras2_6", "data/pics/extras2_6.png", TILE_SIZE, TILE_SIZE},  // DISEASE
+        {"extras2_7", "data/pics/extras2_7.png", TILE_SIZE, TILE_SIZE},  // KOKS
+        {"extras2_8", "data/pics/extras2_8.png", TILE_SIZE, TILE_SIZE},  // VIAGRA
+        {"cb_logo_small", "data/pics/cb_logo_small.png", 0, 0},
+        {"map_editor_background", "data/pics/map_editor.png", 0, 0},
+        {"corpse_parts", "data/pics/corpse_parts.png", TILE_SIZE, TILE_SIZE},
+    };
+    return manifest;
+}
+
+const std::vector<Resources::SoundManifestEntry>& Resources::sound_manifest() {
+    static const std::vector<SoundManifestEntry> manifest = {
+        {"typewriter", "data/wavs/typewriter.wav"},
+        {"winlevel", "data/wavs/winlevel.wav"},
+        {"klatsch", "data/wavs/klatsch.wav"},
+        {"forward", "data/wavs/forward.wav"},
+        {"rewind", "data/wavs/rewind.wav"},
+        {"stop", "data/wavs/stop.wav"},
+        {"wow", "data/wavs/wow.wav"},
+        {"joint", "data/wavs/joint.wav"},
+        {"horny", "data/wavs/horny.wav"},
+        {"schnief", "data/wavs/schnief.wav"},
+        {"whoosh", "data/wavs/whoosh.wav"},
+        {"break", "data/wavs/break.wav"},
+        {"clear", "data/wavs/clear.wav"},
+        {"menu_back", "data/wavs/menu_back.wav"},
+        {"hurry_up", "data/wavs/hurry_up.wav"},
+        {"time_over", "data/wavs/time_over.wav"},
+        {"crunch", "data/wavs/crunch.wav"},
+        {"die", "data/wavs/die.wav"},
+        {"explode", "data/wavs/explode.wav"},
+        {"putbomb", "data/wavs/putbomb.wav"},
+        {"deepfall", "data/wavs/deepfall.wav"},
+        {"corpse_explode", "data/wavs/corpse_explode.wav"},
+        {"splash1", "data/wavs/splash1a.wav"},
+        {"splash2", "data/wavs/splash2a.wav"},
+    };
+    return manifest;
+}
 
 void Resources::init() {
+    begin_loading();
+    while (!pump_loading(1000.0)) {}
+}
+
+void Resources::begin_loading(LoadingCallback callback) {
+    if (loader_pool) {
+        return;
+    }
+    loading_start_ns = SDL_GetTicksNS();
+    loading_callback = callback;
+    assets_total = 0;
+    assets_loaded = 0;
+    loader_pool = new ThreadPool();
 
     const char* sdl_base_path = SDL_GetBasePath();
     if (sdl_base_path) {
@@ -28,126 +129,225 @@ void Resources::init() {
 
     // Note: Fonts are now loaded by TextRenderer
 
-    // Load textures
-    textures["titlescreen"] = load_texture("data/pics/clanbomber_title_andi.png");
-    textures["fl_logo"] = load_texture("data/pics/fischlustig_logo.png");
-    textures["ps_teams"] = load_texture("data/pics/ps_teams.png", 125, 56);
-    textures["ps_controls"] = load_texture("data/pics/ps_controls.png", 125, 56);
-    textures["ps_teamlamps"] = load_texture("data/pics/ps_teamlamps.png", 30, 32);
-    textures["playersetup_background"] = load_texture("data/pics/playersetup.png");
-    textures["mapselector_background"] = load_texture("data/pics/level_selection.png");
-    textures["mapselector_not_available"] = load_texture("data/pics/not_available.png");
-    textures["gamestatus_tools"] = load_texture("data/pics/cup2.png", TILE_SIZE, TILE_SIZE);
-    textures["gamestatus_background"] = load_texture("data/pics/game_status.png");
-    textures["horst_evil"] = load_texture("data/pics/horst_evil.png");
-    textures["bomber_snake"] = load_texture("data/pics/bomber_snake.png", 40, 60);
-    textures["bomber_tux"] = load_texture("data/pics/bomber_tux.png", 40, 60);
-    textures["bomber_spider"] = load_texture("data/pics/bomber_spider.png", TILE_SIZE, TILE_SIZE);
-    textures["bomber_bsd"] = load_texture("data/pics/bomber_bsd.png", TILE_SIZE, 60);
-    textures["bomber_dull_red"] = load_texture("data/pics/bomber_dull_red.png", TILE_SIZE, TILE_SIZE);
-    textures["bomber_dull_blue"] = load_texture("data/pics/bomber_dull_blue.png", TILE_SIZE, TILE_SIZE);
-    textures["bomber_dull_yellow"] = load_texture("data/pics/bomber_dull_yellow.png", TILE_SIZE, TILE_SIZE);
-    textures["bomber_dull_green"] = load_texture("data/pics/bomber_dull_green.png", TILE_SIZE, TILE_SIZE);
-    textures["observer"] = load_texture("data/pics/observer.png", TILE_SIZE, TILE_SIZE);
-    textures["maptiles"] = load_texture("data/pics/maptiles.png", TILE_SIZE, TILE_SIZE);
-    textures["maptile_addons"] = load_texture("data/pics/maptile_addons.png", TILE_SIZE, TILE_SIZE);
-    textures["bombs"] = load_texture("data/pics/bombs.png", TILE_SIZE, TILE_SIZE);
-    textures["explosion"] = load_texture("data/pics/explosion2.png", TILE_SIZE, TILE_SIZE);
-    SDL_Log("DEBUG: Loaded explosion texture, pointer: %p", textures["explosion"]);
-    
-    // Load power-up textures (extras2_X)
-    textures["extras2_0"] = load_texture("data/pics/extras2_0.png", TILE_SIZE, TILE_SIZE);  // BOMB
-    textures["extras2_1"] = load_texture("data/pics/extras2_1.png", TILE_SIZE, TILE_SIZE);  // FLAME
-    textures["extras2_2"] = load_texture("data/pics/extras2_2.png", TILE_SIZE, TILE_SIZE);  // SPEED
-    textures["extras2_3"] = load_texture("data/pics/extras2_3.png", TILE_SIZE, TILE_SIZE);  // KICK
-    textures["extras2_4"] = load_texture("data/pics/extras2_4.png", TILE_SIZE, TILE_SIZE);  // GLOVE
-    textures["extras2_5"] = load_texture("data/pics/extras2_5.png", TILE_SIZE, TILE_SIZE);  // SKATE
-    textures["extras2_6"] = load_texture("data/pics/extras2_6.png", TILE_SIZE, TILE_SIZE);  // DISEASE
-    textures["extras2_7"] = load_texture("data/pics/extras2_7.png", TILE_SIZE, TILE_SIZE);  // KOKS
-    textures["extras2_8"] = load_texture("data/pics/extras2_8.png", TILE_SIZE, TILE_SIZE);  // VIAGRA
-    textures["cb_logo_small"] = load_texture("data/pics/cb_logo_small.png");
-    textures["map_editor_background"] = load_texture("data/pics/map_editor.png");
-    textures["corpse_parts"] = load_texture("data/pics/corpse_parts.png", TILE_SIZE, TILE_SIZE);
-
-    // Initialize audio mixer
+    // A prebuilt pack (clanbomber-pack) skips decoding; anything it lacks loads from data/
+    const char* pack_path = std::getenv("CLANBOMBER_PACK");
+    std::string pack_file = pack_path ? pack_path : base_path + "data/clanbomber.pack";
+    auto pack_result = pack.open(pack_file);
+    if (!pack_result.is_ok() && pack_path) {
+        LOG_WARN(RESOURCE, "%s: %s", pack_result.get_error_message().c_str(), pack_file.c_str());
+    }
+
+    // Textures: decoded on the pool, uploaded by pump_loading
+    for (const TextureManifestEntry& texture : texture_manifest()) {
+        if (!queue_packed_texture(texture)) {
+            queue_texture(texture.name, texture.path, texture.sprite_width, texture.sprite_height);
+        }
+    }
+
+    // Initialize audio mixer: sounds are converted to its device format while loading
     AudioMixer::init();
     
-    // Load all game sounds with error checking
-    const std::vector<std::string> sound_files = {
-        "typewriter", "winlevel", "klatsch", "forward", "rewind", "stop",
-        "wow", "joint", "horny", "schnief", "whoosh", "break", "clear",
-        "menu_back", "hurry_up", "time_over", "crunch", "die", "explode",
-        "putbomb", "deepfall", "corpse_explode", "splash1", "splash2"
-    };
-    
-    for (const std::string& sound_name : sound_files) {
-        std::string file_path = "data/wavs/" + sound_name + ".wav";
-        // Handle special cases
-        if (sound_name == "splash1") file_path = "data/wavs/splash1a.wav";
-        if (sound_name == "splash2") file_path = "data/wavs/splash2a.wav";
-        
-        // Load with AudioMixer
-        std::string full_path = base_path + file_path;
-        MixerAudio* mixer_audio = AudioMixer::load_sound(full_path);
-        if (mixer_audio) {
-            AudioMixer::add_sound(sound_name, mixer_audio);
+    for (const SoundManifestEntry& sound : sound_manifest()) {
+        if (!queue_packed_sound(sound)) {
+            queue_sound(sound.name, sound.path);
         }
     }
+    LOG_INFO(RESOURCE, "Loading %d assets on %u threads", assets_total, loader_pool->get_thread_count());
 }
 
-void Resources::shutdown() {
-    AudioMixer::shutdown();
-    
-    for(auto& pair : textures) {
-        if (pair.second) {
-            if (pair.second->gl_texture != 0) {
-                glDeleteTextures(1, &pair.second->gl_texture);
+// Channel budget: announcements and deaths must survive a chain reaction
+// (priority), and no single effect may take all 16 channels (max copies)
+static void apply_sound_policies() {
+    AudioMixer::set_sound_policy("time_over", 5, 1);
+    AudioMixer::set_sound_policy("winlevel", 5, 1);
+    AudioMixer::set_sound_policy("hurry_up", 5, 1);
+    AudioMixer::set_sound_policy("die", 4, 4);
+    AudioMixer::set_sound_policy("corpse_explode", 3, 3);
+    AudioMixer::set_sound_policy("explode", 2, 4);
+    AudioMixer::set_sound_policy("wow", 2, 2);
+    AudioMixer::set_sound_policy("schnief", 2, 2);
+    AudioMixer::set_sound_policy("crunch", 1, 3);
+    AudioMixer::set_sound_policy("break", 0, 4);
+    AudioMixer::set_sound_policy("putbomb", 0, 3);
+}
+
+void Resources::queue_texture(const std::string& name, const std::string& path, int sprite_width, int sprite_height) {
+    assets_total++;
+    std::string full_path = base_path + path;
+    loader_pool->submit([name, path, full_path, sprite_width, sprite_height]() {
+        PROFILE_ZONE("Resources::decode_texture");
+        DecodedAsset asset;
+        asset.name = name;
+        asset.path = path;
+        asset.sprite_width = sprite_width;
+        asset.sprite_height = sprite_height;
+
+        // CRITICAL FIX: Load as surface only, no SDL_Renderer needed
+        SDL_Surface* surface = IMG_Load(full_path.c_str());
+        if (!surface) {
+            std::cerr << "Failed to load surface: " << full_path << " - " << SDL_GetError() << std::endl;
+        } else {
+            // Convert surface to consistent RGBA format for OpenGL
+            asset.surface = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+            SDL_DestroySurface(surface);
+            if (!asset.surface) {
+                std::cerr << "Failed to convert surface to RGBA: " << SDL_GetError() << std::endl;
             }
-            delete pair.second;
         }
+        push_decoded(std::move(asset));
+    });
+}
+
+void Resources::queue_sound(const std::string& name, const std::string& path) {
+    assets_total++;
+    std::string full_path = base_path + path;
+    loader_pool->submit([name, path, full_path]() {
+        PROFILE_ZONE("Resources::decode_sound");
+        DecodedAsset asset;
+        asset.name = name;
+        asset.path = path;
+        asset.is_sound = true;
+        asset.audio = AudioMixer::load_sound(full_path);
+        push_decoded(std::move(asset));
+    });
+}
+
+void Resources::push_decoded(DecodedAsset asset) {
+    {
+        std::lock_guard<std::mutex> lock(decoded_mutex);
+        decoded.push_back(std::move(asset));
     }
-    textures.clear();
+    decoded_ready.notify_one();
+}
 
-    // Note: Fonts are now managed by TextRenderer
-    fonts.clear();
+bool Resources::queue_packed_texture(const TextureManifestEntry& texture) {
+    const AssetPack::Entry* entry = pack.is_open() ? pack.find(texture.name, AssetPack::ENTRY_TEXTURE) : nullptr;
+    if (!entry) {
+        return false;
+    }
+    // Already RGBA32: pump_loading uploads straight from the mapping
+    DecodedAsset asset;
+    asset.name = texture.name;
+    asset.path = texture.path;
+    asset.sprite_width = texture.sprite_width;
+    asset.sprite_height = texture.sprite_height;
+    asset.packed_pixels = pack.get_data(*entry);
+    asset.packed_width = entry->params[0];
+    asset.packed_height = entry->params[1];
+    assets_total++;
+    push_decoded(std::move(asset));
+    return true;
 }
 
-TextureInfo* Resources::load_texture(const std::string& path, int sprite_width, int sprite_height) {
-    std::string full_path = base_path + path;
-    
-    // CRITICAL FIX: Load as surface only, no SDL_Renderer needed
-    SDL_Surface* surface = IMG_Load(full_path.c_str());
-    if (!surface) {
-        std::cerr << "Failed to load surface: " << full_path << " - " << SDL_GetError() << std::endl;
+bool Resources::queue_packed_sound(const SoundManifestEntry& sound) {
+    const AssetPack::Entry* entry = pack.is_open() ? pack.find(sound.name, AssetPack::ENTRY_SOUND) : nullptr;
+    if (!entry) {
+        return false;
+    }
+    // Packed for another device format: convert from the WAV instead
+    SDL_AudioSpec spec = AudioMixer::make_device_spec();
+    if (entry->params[0] != spec.freq || entry->params[1] != (int32_t)spec.format || entry->params[2] != spec.channels) {
+        return false;
+    }
+    DecodedAsset asset;
+    asset.name = sound.name;
+    asset.path = sound.path;
+    asset.is_sound = true;
+    asset.audio = new MixerAudio();
+    asset.audio->spec = spec;
+    asset.audio->buffer = const_cast<Uint8*>(pack.get_data(*entry)); // Read-only mapping; the mixer never writes
+    asset.audio->length = (Uint32)entry->size;
+    asset.audio->needs_free = false;
+    assets_total++;
+    push_decoded(std::move(asset));
+    return true;
+}
+
+bool Resources::pump_loading(double budget_ms) {
+    if (!loader_pool) {
+        return true;
+    }
+    PROFILE_ZONE("Resources::pump_loading");
+    const Uint64 start = SDL_GetTicksNS();
+    const Uint64 budget_ns = (Uint64)(budget_ms * 1000000.0);
+    int loaded_before = assets_loaded;
+    std::string last_name;
+
+    while (assets_loaded < assets_total) {
+        DecodedAsset asset;
+        {
+            std::unique_lock<std::mutex> lock(decoded_mutex);
+            if (decoded.empty()) {
+                // Nothing decoded yet: wait for a worker, but never past the budget
+                Uint64 elapsed = SDL_GetTicksNS() - start;
+                if (elapsed >= budget_ns ||
+                    !decoded_ready.wait_for(lock, std::chrono::nanoseconds(budget_ns - elapsed),
+                                            []() { return !decoded.empty(); })) {
+                    break;
+                }
+            }
+            asset = std::move(decoded.front());
+            decoded.pop_front();
+        }
+
+        // Main thread only: GL context, and the sound map the game thread reads
+        if (asset.is_sound) {
+            if (asset.audio) {
+                AudioMixer::add_sound(asset.name, asset.audio);
+            }
+        } else {
+            textures[asset.name] = upload_texture(asset);
+        }
+        assets_loaded++;
+        last_name = asset.name;
+
+        if (SDL_GetTicksNS() - start >= budget_ns) {
+            break;
+        }
+    }
+
+    if (loading_callback && assets_loaded != loaded_before) {
+        loading_callback(assets_loaded, assets_total, last_name);
+    }
+    if (assets_loaded < assets_total) {
+        return false;
+    }
+
+    delete loader_pool; // Every job has delivered its result: this only joins idle workers
+    loader_pool = nullptr;
+    loading_callback = nullptr;
+    apply_sound_policies();
+    LOG_INFO(RESOURCE, "Loaded %d assets in %.1f ms", assets_total,
+             (SDL_GetTicksNS() - loading_start_ns) / 1000000.0);
+    return true;
+}
+
+TextureInfo* Resources::upload_texture(const DecodedAsset& asset) {
+    if (!asset.surface && !asset.packed_pixels) {
         return nullptr;
     }
+    int width = asset.surface ? asset.surface->w : asset.packed_width;
+    int height = asset.surface ? asset.surface->h : asset.packed_height;
+    const void* pixels = asset.surface ? asset.surface->pixels : asset.packed_pixels;
     
     TextureInfo* tex_info = new TextureInfo();
-    tex_info->sprite_width = sprite_width;
-    tex_info->sprite_height = sprite_height;
-    tex_info->file_path = path; // Store path for GL texture creation
+    tex_info->sprite_width = asset.sprite_width;
+    tex_info->sprite_height = asset.sprite_height;
+    tex_info->file_path = asset.path; // Store path for GL texture creation
+    tex_info->width = width;
+    tex_info->height = height;
     
-    // IMMEDIATE OpenGL texture creation from surface
     glGenTextures(1, &tex_info->gl_texture);
     glBindTexture(GL_TEXTURE_2D, tex_info->gl_texture);
     
-    // Convert surface to consistent RGBA format for OpenGL
-    SDL_Surface* rgba_surface = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
-    SDL_DestroySurface(surface);
-    
-    if (!rgba_surface) {
-        std::cerr << "Failed to convert surface to RGBA: " << SDL_GetError() << std::endl;
-        delete tex_info;
-        return nullptr;
-    }
-    
-    // Now we know format is RGBA
+    // Decoded as RGBA32 on the worker, or stored that way in the pack
     GLenum format = GL_RGBA;
     GLenum internal_format = GL_RGBA;
     
-    // Create OpenGL texture from converted surface data
-    glTexImage2D(GL_TEXTURE_2D, 0, internal_format, rgba_surface->w, rgba_surface->h, 0, 
-                format, GL_UNSIGNED_BYTE, rgba_surface->pixels);
+    // Rows are tightly packed in both sources
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, 
+                format, GL_UNSIGNED_BYTE, pixels);
     
     // Set texture parameters
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -155,11 +355,42 @@ TextureInfo* Resources::load_texture(const std::string& path, int sprite_width,
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     
-    SDL_DestroySurface(rgba_surface);
+    if (asset.surface) {
+        SDL_DestroySurface(asset.surface);
+    }
     
     return tex_info;
 }
 
+void Resources::shutdown() {
+    if (loader_pool) {
+        // Quit during loading: let the workers finish, then drop what they produced
+        loader_pool->wait_idle();
+        delete loader_pool;
+        loader_pool = nullptr;
+        for (DecodedAsset& asset : decoded) {
+            if (asset.surface) SDL_DestroySurface(asset.surface);
+            if (asset.audio) AudioMixer::add_sound(asset.name, asset.audio); // Freed by AudioMixer::shutdown
+        }
+        decoded.clear();
+    }
+    AudioMixer::shutdown();
+    pack.close(); // Packed sounds point into the mapping: only after the mixer is gone
+    
+    for(auto& pair : textures) {
+        if (pair.second) {
+            if (pair.second->gl_texture != 0) {
+                glDeleteTextures(1, &pair.second->gl_texture);
+            }
+            delete pair.second;
+        }
+    }
+    textures.clear();
+
+    // Note: Fonts are now managed by TextRenderer
+    fonts.clear();
+}
+
 TTF_Font* Resources::load_font(const std::string& path, int size) {
     std::string full_path = base_path + path;
     TTF_Font* font = TTF_OpenFont(full_path.c_str(), size);
@@ -171,7 +402,7 @@ TTF_Font* Resources::load_font(const std::string& path, int size) {
 
 TextureInfo* Resources::get_texture(const std::string& name) {
     if (name == "explosion") {
-        SDL_Log("DEBUG: get_texture called for 'explosion', count=%zu, ptr=%p", textures.count(name), textures.count(name) ? textures[name] : nullptr);
+        LOG_TRACE(RESOURCE, "get_texture called for 'explosion', count=%zu, ptr=%p", textures.count(name), textures.count(name) ? textures[name] : nullptr);
     }
     if (textures.count(name)) {
         return textures[name];
@@ -186,6 +417,12 @@ GLuint Resources::get_gl_texture(const std::string& name) {
     }
     
     
+    // Recording thread has no GL context: textures must have been uploaded up front
+    if (tex_info->gl_texture == 0 && GPUAcceleratedRenderer::get_recording()) {
+        LOG_WARN(RESOURCE, "Resources: texture '%s' not uploaded before the render thread started", name.c_str());
+        return 0;
+    }
+    
     // Create OpenGL texture from SDL texture if not already created
     if (tex_info->gl_texture == 0) {
         // FIXED: Load as surface to get proper format information
@@ -206,6 +443,8 @@ GLuint Resources::get_gl_texture(const std::string& name) {
             
             glTexImage2D(GL_TEXTURE_2D, 0, internal_format, surface->w, surface->h, 0, 
                         format, GL_UNSIGNED_BYTE, surface->pixels);
+            tex_info->width = surface->w;
+            tex_info->height = surface->h;
             
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -221,6 +460,12 @@ GLuint Resources::get_gl_texture(const std::string& name) {
     return tex_info->gl_texture;
 }
 
+void Resources::upload_all_gl_textures() {
+    for (const auto& entry : textures) {
+        get_gl_texture(entry.first);
+    }
+}
+
 std::string Resources::load_shader_source(const std::string& path) {
     std::string full_path = base_path + path;
     std::ifstream file(full_path);
@@ -240,17 +485,13 @@ void Resources::register_gl_texture_metadata(const std::string& texture_name, GP
     TextureInfo* tex_info = get_texture(texture_name);
     if (!tex_info || tex_info->gl_texture == 0) return;
     
-    // Load surface to get dimensions
-    std::string full_path = base_path + tex_info->file_path;
-    SDL_Surface* surface = IMG_Load(full_path.c_str());
-    if (!surface) return;
+    // Size recorded at upload; no need to decode the file again
+    if (tex_info->width <= 0 || tex_info->height <= 0) return;
     
     // Register metadata with GPU renderer
     int sprite_width = (tex_info->sprite_width > 0) ? tex_info->sprite_width : TILE_SIZE;
     int sprite_height = (tex_info->sprite_height > 0) ? tex_info->sprite_height : TILE_SIZE;
     
-    renderer->register_texture_metadata(tex_info->gl_texture, surface->w, surface->h, 
+    renderer->register_texture_metadata(tex_info->gl_texture, tex_info->width, tex_info->height, 
                                        sprite_width, sprite_height);
-    
-    SDL_DestroySurface(surface);
 }
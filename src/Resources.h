@@ -4,8 +4,14 @@
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
 #include <glad/gl.h>
+#include "AssetPack.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <map>
+#include <vector>
 
 #define NR_BOMBERSKINS 8
 
@@ -14,15 +20,62 @@ struct TextureInfo {
     int sprite_width;
     int sprite_height;
     std::string file_path;  // Store original file path for GL texture creation
+    int width = 0;          // Tamaño de la imagen entera (0 = aún no subida)
+    int height = 0;
 };
 
+class ThreadPool;
+struct MixerAudio;
+
+// (assets listos, total, nombre del último); se llama en el hilo GL
+typedef std::function<void(int loaded, int total, const std::string& last_name)> LoadingCallback;
+
+/**
+ * @brief Texturas, sonidos y fuentes del juego
+ *
+ * La carga es asíncrona: begin_loading() reparte la lectura y decodificación
+ * de cada PNG/WAV entre los hilos de un ThreadPool, y pump_loading() sube a
+ * GL lo ya decodificado desde el hilo del contexto, sin pasar de un
+ * presupuesto de tiempo por llamada, para poder pintar una pantalla de carga
+ * entre medias. init() hace lo mismo de forma bloqueante.
+ */
 class Resources {
 public:
     static void init();
+
+    /**
+     * @brief Arranca la carga en segundo plano (hilo GL, una vez)
+     * @param callback Progreso; se llama desde pump_loading()
+     */
+    static void begin_loading(LoadingCallback callback = nullptr);
+
+    /**
+     * @brief Sube a GL/AudioMixer los assets ya decodificados (hilo GL)
+     * @param budget_ms Tiempo máximo a gastar; si no hay nada listo espera hasta ese tiempo
+     * @return true cuando todo está cargado
+     */
+    static bool pump_loading(double budget_ms);
+    static bool is_loading() { return loader_pool != nullptr; }
+
+    // Lista de assets del juego; la comparten la carga y clanbomber-pack
+    struct TextureManifestEntry {
+        const char* name;
+        const char* path;           // Relativa a base_path
+        int sprite_width;           // 0 = imagen entera
+        int sprite_height;
+    };
+    struct SoundManifestEntry {
+        const char* name;
+        const char* path;
+    };
+    static const std::vector<TextureManifestEntry>& texture_manifest();
+    static const std::vector<SoundManifestEntry>& sound_manifest();
     static void shutdown();
 
     static TextureInfo* get_texture(const std::string& name);
     static GLuint get_gl_texture(const std::string& name);
+    // Sube a GL todas las texturas cargadas (antes de ceder el contexto al hilo de render)
+    static void upload_all_gl_textures();
     static TTF_Font* get_font(const std::string& name);
     static std::string load_shader_source(const std::string& path);
     static void register_gl_texture_metadata(const std::string& texture_name, class GPUAcceleratedRenderer* renderer);
@@ -32,7 +85,36 @@ private:
     static std::map<std::string, TextureInfo*> textures;
     static std::map<std::string, TTF_Font*> fonts;
 
-    static TextureInfo* load_texture(const std::string& path, int sprite_width = 0, int sprite_height = 0);
+    // Resultado de un trabajo de carga, pendiente de subir en el hilo GL
+    struct DecodedAsset {
+        std::string name;
+        std::string path;
+        SDL_Surface* surface = nullptr;   // Textura ya en RGBA32
+        const Uint8* packed_pixels = nullptr;  // O RGBA32 dentro del AssetPack mapeado
+        int packed_width = 0;
+        int packed_height = 0;
+        MixerAudio* audio = nullptr;
+        bool is_sound = false;
+        int sprite_width = 0;
+        int sprite_height = 0;
+    };
+
+    static ThreadPool* loader_pool;
+    static std::mutex decoded_mutex;
+    static std::condition_variable decoded_ready;
+    static std::deque<DecodedAsset> decoded;
+    static int assets_total;
+    static int assets_loaded;
+    static Uint64 loading_start_ns;
+    static LoadingCallback loading_callback;
+    static AssetPack pack;                  // Abierto hasta shutdown(): los sonidos apuntan a él
+
+    static void queue_texture(const std::string& name, const std::string& path, int sprite_width = 0, int sprite_height = 0);
+    static void queue_sound(const std::string& name, const std::string& path);
+    static bool queue_packed_texture(const TextureManifestEntry& texture);
+    static bool queue_packed_sound(const SoundManifestEntry& sound);
+    static void push_decoded(DecodedAsset asset);
+    static TextureInfo* upload_texture(const DecodedAsset& asset);
     static TTF_Font* load_font(const std::string& path, int size);
 };
 
@@ -0,0 +1,100 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Cola circular lock-free de un productor y un consumidor
+ *
+ * Pensada para mandar órdenes a un hilo de tiempo real (callback de audio):
+ * try_push() y try_pop() nunca bloquean, nunca asignan memoria y fallan en
+ * vez de esperar cuando la cola está llena o vacía.
+ *
+ * Cada índice lo escribe un solo hilo (tail el productor, head el consumidor)
+ * y se publica con release/acquire, que es toda la sincronización necesaria.
+ * Los índices van en líneas de caché separadas para que productor y
+ * consumidor no se invaliden mutuamente.
+ *
+ * Capacity debe ser potencia de dos; caben Capacity - 1 elementos.
+ */
+template <typename T, size_t Capacity>
+class SPSCRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SPSCRing() : head(0), tail(0) {}
+
+    SPSCRing(const SPSCRing&) = delete;
+    SPSCRing& operator=(const SPSCRing&) = delete;
+
+    // Solo productor
+    bool try_push(const T& item) {
+        size_t current_tail = tail.load(std::memory_order_relaxed);
+        size_t next_tail = (current_tail + 1) & MASK;
+        if (next_tail == head.load(std::memory_order_acquire)) {
+            return false; // Full
+        }
+        items[current_tail] = item;
+        tail.store(next_tail, std::memory_order_release);
+        return true;
+    }
+
+    // Solo consumidor
+    bool try_pop(T& item) {
+        size_t current_head = head.load(std::memory_order_relaxed);
+        if (current_head == tail.load(std::memory_order_acquire)) {
+            return false; // Empty
+        }
+        item = items[current_head];
+        head.store((current_head + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+    // Solo productor: copia hasta `count` elementos, devuelve cuántos cupieron
+    size_t push_bulk(const T* data, size_t count) {
+        size_t current_tail = tail.load(std::memory_order_relaxed);
+        size_t space = (head.load(std::memory_order_acquire) - current_tail - 1) & MASK;
+        count = std::min(count, space);
+        size_t first = std::min(count, Capacity - current_tail);
+        std::copy(data, data + first, items + current_tail);
+        std::copy(data + first, data + count, items);
+        tail.store((current_tail + count) & MASK, std::memory_order_release);
+        return count;
+    }
+
+    // Solo consumidor: copia hasta `count` elementos, devuelve cuántos había
+    size_t pop_bulk(T* out, size_t count) {
+        size_t current_head = head.load(std::memory_order_relaxed);
+        size_t available = (tail.load(std::memory_order_acquire) - current_head) & MASK;
+        count = std::min(count, available);
+        size_t first = std::min(count, Capacity - current_head);
+        std::copy(items + current_head, items + current_head + first, out);
+        std::copy(items, items + (count - first), out + first);
+        head.store((current_head + count) & MASK, std::memory_order_release);
+        return count;
+    }
+
+    // Vacía la cola; solo cuando ningún otro hilo la está usando
+    void reset() {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+    // Aproximado si el otro hilo está activo
+    size_t size() const {
+        return (tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire)) & MASK;
+    }
+
+    static constexpr size_t capacity() { return Capacity - 1; }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    alignas(64) std::atomic<size_t> head;   // Siguiente elemento a leer (consumidor)
+    alignas(64) std::atomic<size_t> tail;   // Siguiente hueco a escribir (productor)
+    alignas(64) T items[Capacity];
+};
+
+#endif
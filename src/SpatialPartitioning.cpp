@@ -1,7 +1,10 @@
 #include "SpatialPartitioning.h"
+#include "Logger.h"
 #include "GameObject.h"
 #include "Bomber.h"
 #include "CoordinateSystem.h"
+#include "Profiler.h"
+#include "AllocTracker.h"
 #include <SDL3/SDL.h>
 #include <algorithm>
 #include <cmath>
@@ -15,13 +18,13 @@ static constexpr int TILE_SIZE = CoordinateConfig::TILE_SIZE;
 
 SpatialGrid::SpatialGrid(int cell_size_pixels) 
     : cell_size(cell_size_pixels) {
-    SDL_Log("SpatialGrid: Initialized with cell_size=%d pixels", cell_size);
+    LOG_INFO(SPATIAL, "SpatialGrid: Initialized with cell_size=%d pixels", cell_size);
 }
 
 void SpatialGrid::clear() {
     cells.clear();
     object_positions.clear();
-    SDL_Log("SpatialGrid: Cleared all cells and object positions");
+    LOG_DEBUG(SPATIAL, "SpatialGrid: Cleared all cells and object positions");
 }
 
 void SpatialGrid::add_object(GameObject* obj) {
@@ -60,6 +63,8 @@ void SpatialGrid::update_object_position(GameObject* obj, const PixelCoord& old_
 }
 
 void SpatialGrid::rebuild_from_objects(const std::list<GameObject*>& objects) {
+    PROFILE_ZONE("SpatialGrid::rebuild_from_objects");
+    ALLOC_SCOPE(ALLOC_TAG_SPATIAL);
     clear();
     
     for (GameObject* obj : objects) {
@@ -68,10 +73,12 @@ void SpatialGrid::rebuild_from_objects(const std::list<GameObject*>& objects) {
         }
     }
     
-    SDL_Log("SpatialGrid: Rebuilt with %zu objects", objects.size());
+    LOG_DEBUG(SPATIAL, "SpatialGrid: Rebuilt with %zu objects", objects.size());
 }
 
 std::vector<GameObject*> SpatialGrid::get_objects_at_position(const PixelCoord& position) const {
+    PROFILE_ZONE("SpatialGrid::get_objects_at_position");
+    ALLOC_SCOPE(ALLOC_TAG_SPATIAL);
     GridCoord grid_coord = pixel_to_grid_coord(position);
     const SpatialCell* cell = get_cell(grid_coord);
     
@@ -85,6 +92,8 @@ std::vector<GameObject*> SpatialGrid::get_objects_at_position(const PixelCoord&
 std::vector<GameObject*> SpatialGrid::get_objects_of_type_near(const PixelCoord& position,
                                                              GameObject::ObjectType object_type,
                                                              int radius) const {
+    PROFILE_ZONE("SpatialGrid::get_objects_of_type_near");
+    ALLOC_SCOPE(ALLOC_TAG_SPATIAL);
     std::vector<GameObject*> result;
     GridCoord center = pixel_to_grid_coord(position);
     std::vector<GridCoord> cells_to_check = get_cells_in_radius(center, radius);
@@ -120,6 +129,8 @@ std::vector<GameObject*> SpatialGrid::get_extras_near(const PixelCoord& position
 std::vector<GameObject*> SpatialGrid::get_objects_in_area(const PixelCoord& top_left,
                                                         const PixelCoord& bottom_right,
                                                         GameObject::ObjectType object_type) const {
+    PROFILE_ZONE("SpatialGrid::get_objects_in_area");
+    ALLOC_SCOPE(ALLOC_TAG_SPATIAL);
     std::vector<GameObject*> result;
     std::vector<GridCoord> cells_in_area = get_cells_in_area(top_left, bottom_right);
     
@@ -149,6 +160,8 @@ std::vector<GameObject*> SpatialGrid::get_objects_in_area(const PixelCoord& top_
 std::vector<GameObject*> SpatialGrid::find_collisions(GameObject* obj, 
                                                     float collision_radius,
                                                     GameObject::ObjectType object_type) const {
+    PROFILE_ZONE("SpatialGrid::find_collisions");
+    ALLOC_SCOPE(ALLOC_TAG_SPATIAL);
     if (!obj) return std::vector<GameObject*>();
     
     std::vector<GameObject*> result;
@@ -177,6 +190,8 @@ std::vector<GameObject*> SpatialGrid::find_collisions(GameObject* obj,
 
 bool SpatialGrid::has_object_at_position(const PixelCoord& position, 
                                        GameObject::ObjectType object_type) const {
+    PROFILE_ZONE("SpatialGrid::has_object_at_position");
+    ALLOC_SCOPE(ALLOC_TAG_SPATIAL);
     std::vector<GameObject*> objects = get_objects_at_position(position);
     
     for (GameObject* obj : objects) {
@@ -223,14 +238,14 @@ SpatialGrid::GridStats SpatialGrid::get_statistics() const {
 void SpatialGrid::print_debug_info() const {
     GridStats stats = get_statistics();
     
-    SDL_Log("=== SpatialGrid Debug Info ===");
-    SDL_Log("Cell size: %d pixels", cell_size);
-    SDL_Log("Total cells: %zu", stats.total_cells);
-    SDL_Log("Occupied cells: %zu", stats.occupied_cells);
-    SDL_Log("Total objects: %zu", stats.total_objects);
-    SDL_Log("Load factor: %.2f", stats.load_factor);
-    SDL_Log("Average objects per cell: %.2f", stats.average_objects_per_cell);
-    SDL_Log("Max objects in single cell: %zu", stats.max_objects_in_cell);
+    LOG_INFO(SPATIAL, "=== SpatialGrid Debug Info ===");
+    LOG_INFO(SPATIAL, "Cell size: %d pixels", cell_size);
+    LOG_INFO(SPATIAL, "Total cells: %zu", stats.total_cells);
+    LOG_INFO(SPATIAL, "Occupied cells: %zu", stats.occupied_cells);
+    LOG_INFO(SPATIAL, "Total objects: %zu", stats.total_objects);
+    LOG_INFO(SPATIAL, "Load factor: %.2f", stats.load_factor);
+    LOG_INFO(SPATIAL, "Average objects per cell: %.2f", stats.average_objects_per_cell);
+    LOG_INFO(SPATIAL, "Max objects in single cell: %zu", stats.max_objects_in_cell);
 }
 
 std::string SpatialGrid::visualize_grid(int max_width, int max_height) const {
@@ -363,18 +378,18 @@ GameObject* CollisionHelper::find_nearest_bomber(const PixelCoord& extra_positio
         for (GameObject* bomber : bombers) {
             // CRASH FIX: More robust null checking and corruption detection
             if (!bomber) {
-                SDL_Log("CollisionHelper: WARNING - null bomber pointer in SpatialGrid");
+                LOG_WARN(SPATIAL, "CollisionHelper: WARNING - null bomber pointer in SpatialGrid");
                 continue;
             }
             
             // Check for obviously corrupted pointers (basic heuristic)
             if (reinterpret_cast<uintptr_t>(bomber) < 0x1000) {
-                SDL_Log("CollisionHelper: WARNING - corrupted bomber pointer: %p", bomber);
+                LOG_WARN(SPATIAL, "CollisionHelper: WARNING - corrupted bomber pointer: %p", bomber);
                 continue;
             }
             
             if (bomber->delete_me) {
-                SDL_Log("CollisionHelper: WARNING - delete_me bomber still in SpatialGrid: %p", bomber);
+                LOG_WARN(SPATIAL, "CollisionHelper: WARNING - delete_me bomber still in SpatialGrid: %p", bomber);
                 continue;
             }
             
@@ -388,7 +403,7 @@ GameObject* CollisionHelper::find_nearest_bomber(const PixelCoord& extra_positio
                     nearest_distance = distance;
                 }
             } catch (...) {
-                SDL_Log("CollisionHelper: CRASH PREVENTED - Exception accessing bomber %p", bomber);
+                LOG_ERROR(SPATIAL, "CollisionHelper: CRASH PREVENTED - Exception accessing bomber %p", bomber);
                 continue;
             }
         }
@@ -403,7 +418,7 @@ GameObject* CollisionHelper::find_nearest_bomber(const PixelCoord& extra_positio
 
 std::vector<GameObject*> CollisionHelper::find_explosion_victims(const std::vector<GridCoord>& explosion_area) {
     if (!spatial_grid) {
-        SDL_Log("CollisionHelper: WARNING - No spatial_grid available for explosion victims");
+        LOG_WARN(SPATIAL, "CollisionHelper: WARNING - No spatial_grid available for explosion victims");
         return std::vector<GameObject*>();
     }
     
@@ -456,22 +471,22 @@ std::vector<GameObject*> CollisionHelper::find_explosion_victims(const std::vect
                             bool in_explosion_tile = (bomber_tile_x == grid_coord.grid_x && 
                                                     bomber_tile_y == grid_coord.grid_y);
                             
-                            SDL_Log("🎯 DISCRETE: Bomber(%.1f,%.1f) in tile(%d,%d) vs ExplosionTile(%d,%d)", 
+                            LOG_TRACE(SPATIAL, "🎯 DISCRETE: Bomber(%.1f,%.1f) in tile(%d,%d) vs ExplosionTile(%d,%d)", 
                                     bomber_x, bomber_y, bomber_tile_x, bomber_tile_y, 
                                     grid_coord.grid_x, grid_coord.grid_y);
-                            SDL_Log("   SAME_TILE=%s", in_explosion_tile ? "YES" : "NO");
+                            LOG_TRACE(SPATIAL, "   SAME_TILE=%s", in_explosion_tile ? "YES" : "NO");
                             
                             if (in_explosion_tile) {
-                                SDL_Log("💥 DEATH: Bomber in tile(%d,%d) killed by explosion in same tile", 
+                                LOG_TRACE(SPATIAL, "💥 DEATH: Bomber in tile(%d,%d) killed by explosion in same tile", 
                                         bomber_tile_x, bomber_tile_y);
                                 found_objects.insert(obj);
                             } else {
-                                SDL_Log("✅ SAFE: Bomber in tile(%d,%d) safe from explosion in tile(%d,%d)", 
+                                LOG_TRACE(SPATIAL, "✅ SAFE: Bomber in tile(%d,%d) safe from explosion in tile(%d,%d)", 
                                         bomber_tile_x, bomber_tile_y, grid_coord.grid_x, grid_coord.grid_y);
                             }
                         }
                     } catch (...) {
-                        SDL_Log("CollisionHelper: CRASH PREVENTED - Exception accessing object %p", obj);
+                        LOG_ERROR(SPATIAL, "CollisionHelper: CRASH PREVENTED - Exception accessing object %p", obj);
                         continue;
                     }
                 }
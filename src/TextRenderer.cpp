@@ -1,8 +1,51 @@
 #include "TextRenderer.h"
+#include "Logger.h"
+#include "AllocTracker.h"
 #include "RenderingFacade.h"
 #include "CoordinateSystem.h"
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
-#include <sstream>
+
+namespace {
+    const size_t DEFAULT_TEXT_CACHE_MB = 8;
+
+    // FNV-1a, 64-bit
+    const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    const uint64_t FNV_PRIME = 1099511628211ULL;
+
+    uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    const int GLYPH_ATLAS_INITIAL_SIZE = 512;
+    const int GLYPH_ATLAS_MAX_SIZE = 2048;
+    const int GLYPH_PADDING = 1; // Keeps linear filtering from sampling the neighbour glyph
+
+    // Decodes one UTF-8 code point and advances `i`; malformed sequences come out as '?'
+    Uint32 next_codepoint(const std::string& text, size_t& i) {
+        unsigned char lead = (unsigned char)text[i++];
+        if (lead < 0x80) {
+            return lead;
+        }
+        int extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+        if (extra == 0) {
+            return '?';
+        }
+        Uint32 codepoint = lead & (0x3F >> extra);
+        for (int k = 0; k < extra; k++) {
+            if (i >= text.size() || ((unsigned char)text[i] & 0xC0) != 0x80) {
+                return '?';
+            }
+            codepoint = (codepoint << 6) | ((unsigned char)text[i++] & 0x3F);
+        }
+        return codepoint;
+    }
+}
 
 TextTexture::~TextTexture() {
     if (gl_texture) {
@@ -10,7 +53,12 @@ TextTexture::~TextTexture() {
     }
 }
 
-TextRenderer::TextRenderer() : ttf_initialized(false) {
+TextRenderer::TextRenderer()
+    : atlas_bytes(0), cache_bytes(0), cache_budget_bytes(DEFAULT_TEXT_CACHE_MB * 1024 * 1024),
+      cache_hits(0), cache_misses(0), cache_evictions(0), ttf_initialized(false) {
+    if (const char* budget = std::getenv("CLANBOMBER_TEXT_CACHE_MB")) {
+        cache_budget_bytes = (size_t)std::strtoul(budget, nullptr, 10) * 1024 * 1024;
+    }
 }
 
 TextRenderer::~TextRenderer() {
@@ -24,13 +72,23 @@ bool TextRenderer::initialize() {
     }
     
     ttf_initialized = true;
-    SDL_Log("TextRenderer: SDL_ttf initialized successfully");
+    LOG_INFO(RENDER, "TextRenderer: SDL_ttf initialized successfully");
     return true;
 }
 
 void TextRenderer::shutdown() {
     // Clear text cache (automatically deletes TextTextures)
     text_cache.clear();
+    cache_lru.clear();
+    cache_bytes = 0;
+    
+    for (auto& pair : atlases) {
+        if (pair.second->texture) {
+            glDeleteTextures(1, &pair.second->texture);
+        }
+    }
+    atlases.clear();
+    atlas_bytes = 0;
     
     // Close all fonts
     for (auto& pair : fonts) {
@@ -54,7 +112,7 @@ bool TextRenderer::load_font(const std::string& name, const std::string& path, i
     }
     
     fonts[name] = font;
-    SDL_Log("TextRenderer: Loaded font '%s' from %s (size %d)", name.c_str(), path.c_str(), size);
+    LOG_INFO(RENDER, "TextRenderer: Loaded font '%s' from %s (size %d)", name.c_str(), path.c_str(), size);
     return true;
 }
 
@@ -92,19 +150,63 @@ GLuint TextRenderer::create_gl_texture_from_surface(SDL_Surface* surface) {
     return texture;
 }
 
-std::string TextRenderer::make_cache_key(const std::string& text, const std::string& font_name, SDL_Color color) {
-    std::stringstream ss;
-    ss << text << "|" << font_name << "|" << (int)color.r << "," << (int)color.g << "," << (int)color.b << "," << (int)color.a;
-    return ss.str();
+uint64_t TextRenderer::make_cache_key(const std::string& text, const std::string& font_name, SDL_Color color) {
+    // Hashed in place: a hit builds no key string
+    uint64_t hash = hash_bytes(FNV_OFFSET, text.data(), text.size());
+    const unsigned char separator = 0xFF; // Never appears in UTF-8, so "ab"+"c" != "a"+"bc"
+    hash = hash_bytes(hash, &separator, 1);
+    hash = hash_bytes(hash, font_name.data(), font_name.size());
+    const unsigned char rgba[4] = {color.r, color.g, color.b, color.a};
+    return hash_bytes(hash, rgba, sizeof(rgba));
+}
+
+void TextRenderer::set_cache_budget(size_t bytes) {
+    cache_budget_bytes = bytes;
+    evict_to_budget();
+}
+
+TextCacheStats TextRenderer::get_cache_stats() const {
+    TextCacheStats stats;
+    stats.hits = cache_hits;
+    stats.misses = cache_misses;
+    stats.evictions = cache_evictions;
+    stats.entries = cache_lru.size();
+    stats.bytes = cache_bytes;
+    stats.budget_bytes = cache_budget_bytes;
+    return stats;
+}
+
+void TextRenderer::evict_to_budget() {
+    // The newest entry always stays, even if it alone is over budget
+    while (cache_bytes > cache_budget_bytes && cache_lru.size() > 1) {
+        CacheEntry& oldest = cache_lru.back();
+        cache_bytes -= oldest.bytes;
+        text_cache.erase(oldest.key);
+        cache_lru.pop_back(); // Frees the GL texture unless a caller still holds it
+        cache_evictions++;
+    }
 }
 
 std::shared_ptr<TextTexture> TextRenderer::render_text(const std::string& text, const std::string& font_name, SDL_Color color) {
+    ALLOC_SCOPE(ALLOC_TAG_TEXT);
     // Check cache first
-    std::string cache_key = make_cache_key(text, font_name, color);
+    uint64_t cache_key = make_cache_key(text, font_name, color);
     auto cache_it = text_cache.find(cache_key);
     if (cache_it != text_cache.end()) {
-        return cache_it->second;
+        const TextTexture& cached = *cache_it->second->texture;
+        if (cached.text == text && cached.font_name == font_name &&
+            cached.color.r == color.r && cached.color.g == color.g &&
+            cached.color.b == color.b && cached.color.a == color.a) {
+            cache_hits++;
+            cache_lru.splice(cache_lru.begin(), cache_lru, cache_it->second);
+            return cache_it->second->texture;
+        }
+        // Hash collision: the new string takes the slot
+        cache_bytes -= cache_it->second->bytes;
+        cache_lru.erase(cache_it->second);
+        text_cache.erase(cache_it);
     }
+    cache_misses++;
     
     // Get font
     TTF_Font* font = get_font(font_name);
@@ -133,21 +235,228 @@ std::shared_ptr<TextTexture> TextRenderer::render_text(const std::string& text,
     text_texture->width = text_surface->w;
     text_texture->height = text_surface->h;
     text_texture->text = text;
+    text_texture->font_name = font_name;
     text_texture->color = color;
     text_texture->font = font;
     
     SDL_DestroySurface(text_surface);
     
-    // Cache it
-    text_cache[cache_key] = text_texture;
+    // Cache it as the most recent entry, then trim the oldest ones
+    size_t bytes = (size_t)text_texture->width * text_texture->height * 4;
+    cache_lru.push_front({cache_key, text_texture, bytes});
+    text_cache[cache_key] = cache_lru.begin();
+    cache_bytes += bytes;
+    evict_to_budget();
     
     return text_texture;
 }
 
+// === GLYPH ATLAS ===
+
+GLuint TextRenderer::layout_text(const std::string& text, const std::string& font_name,
+                                 std::vector<GlyphQuad>& quads, int& width, int& height) {
+    ALLOC_SCOPE(ALLOC_TAG_TEXT);
+    quads.clear();
+    width = 0;
+    height = 0;
+    
+    GlyphAtlas* atlas = get_atlas(font_name);
+    if (!atlas) {
+        return 0;
+    }
+    height = TTF_GetFontHeight(atlas->font);
+    
+    // A new glyph may grow the atlas halfway through: lay the string out again with the new UVs
+    for (int attempt = 0; attempt < 2; attempt++) {
+        int generation = atlas->generation;
+        quads.clear();
+        int pen_x = 0;
+        Uint32 previous = 0;
+        for (size_t i = 0; i < text.size();) {
+            Uint32 codepoint = next_codepoint(text, i);
+            const Glyph* glyph = find_glyph(*atlas, codepoint);
+            if (!glyph) {
+                continue;
+            }
+            int kerning = 0;
+            if (previous && TTF_GetGlyphKerning(atlas->font, previous, codepoint, &kerning)) {
+                pen_x += kerning;
+            }
+            previous = codepoint;
+            if (glyph->width > 0) {
+                quads.push_back({(float)pen_x, 0.0f, (float)glyph->width, (float)glyph->height,
+                                 glyph->u0, glyph->v0, glyph->u1, glyph->v1});
+            }
+            pen_x += glyph->advance;
+        }
+        width = pen_x;
+        if (generation == atlas->generation) {
+            break;
+        }
+    }
+    return atlas->texture;
+}
+
+
+TextRenderer::GlyphAtlas* TextRenderer::get_atlas(const std::string& font_name) {
+    auto it = atlases.find(font_name);
+    if (it != atlases.end()) {
+        return it->second.get();
+    }
+    
+    TTF_Font* font = get_font(font_name);
+    if (!font) {
+        LOG_WARN(RENDER, "TextRenderer: font not found: %s", font_name.c_str());
+        return nullptr;
+    }
+    auto atlas = std::make_unique<GlyphAtlas>();
+    atlas->font = font;
+    if (!create_atlas_texture(*atlas, GLYPH_ATLAS_INITIAL_SIZE)) {
+        return nullptr;
+    }
+    // Printable ASCII covers every string the game draws: rasterize it up front
+    for (Uint32 codepoint = 32; codepoint < 127; codepoint++) {
+        find_glyph(*atlas, codepoint);
+    }
+    LOG_INFO(RENDER, "TextRenderer: glyph atlas for '%s' (%dx%d)", font_name.c_str(), atlas->size, atlas->size);
+    
+    GlyphAtlas* result = atlas.get();
+    atlases[font_name] = std::move(atlas);
+    return result;
+}
+
+const TextRenderer::Glyph* TextRenderer::find_glyph(GlyphAtlas& atlas, Uint32 codepoint) {
+    Glyph* glyph;
+    if (codepoint < 128) {
+        glyph = &atlas.ascii[codepoint];
+    } else {
+        glyph = &atlas.extended[codepoint];
+    }
+    if (!glyph->ready && !rasterize_glyph(atlas, codepoint, *glyph)) {
+        return nullptr;
+    }
+    return glyph;
+}
+
+bool TextRenderer::rasterize_glyph(GlyphAtlas& atlas, Uint32 codepoint, Glyph& glyph) {
+    int min_x, max_x, min_y, max_y, advance;
+    glyph.width = 0;
+    glyph.height = 0;
+    glyph.advance = 0;
+    if (!TTF_GetGlyphMetrics(atlas.font, codepoint, &min_x, &max_x, &min_y, &max_y, &advance)) {
+        glyph.ready = true; // Not in the font: skipped from now on instead of retried every frame
+        return true;
+    }
+    glyph.advance = advance;
+    
+    // White glyphs: the sprite shader multiplies by the vertex colour
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* surface = TTF_RenderGlyph_Blended(atlas.font, codepoint, white);
+    SDL_Surface* rgba_surface = surface ? SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32) : nullptr;
+    if (surface) {
+        SDL_DestroySurface(surface);
+    }
+    if (!rgba_surface) {
+        glyph.ready = true; // Nothing to draw (a space), but it still advances the pen
+        return true;
+    }
+    
+    int w = rgba_surface->w;
+    int h = rgba_surface->h;
+    if (atlas.pen_x + w + GLYPH_PADDING > atlas.size) {
+        atlas.pen_x = 0;
+        atlas.pen_y += atlas.row_height + GLYPH_PADDING;
+        atlas.row_height = 0;
+    }
+    if (atlas.pen_y + h + GLYPH_PADDING > atlas.size) {
+        SDL_DestroySurface(rgba_surface);
+        if (!grow_atlas(atlas)) {
+            glyph.ready = true; // Full: draw it as blank space rather than retry every frame
+            return true;
+        }
+        return rasterize_glyph(atlas, codepoint, glyph);
+    }
+    
+    glBindTexture(GL_TEXTURE_2D, atlas.texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, rgba_surface->pitch / 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, atlas.pen_x, atlas.pen_y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, rgba_surface->pixels);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    SDL_DestroySurface(rgba_surface);
+    
+    float scale = 1.0f / atlas.size;
+    glyph.u0 = atlas.pen_x * scale;
+    glyph.v0 = atlas.pen_y * scale;
+    glyph.u1 = (atlas.pen_x + w) * scale;
+    glyph.v1 = (atlas.pen_y + h) * scale;
+    glyph.width = w;
+    glyph.height = h;
+    glyph.ready = true;
+    
+    atlas.pen_x += w + GLYPH_PADDING;
+    atlas.row_height = std::max(atlas.row_height, h);
+    return true;
+}
+
+bool TextRenderer::create_atlas_texture(GlyphAtlas& atlas, int size) {
+    // Zeroed so the padding between glyphs is transparent
+    std::vector<Uint8> clear_pixels((size_t)size * size * 4, 0);
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    if (!texture) {
+        LOG_ERROR(RENDER, "TextRenderer: failed to create %dx%d glyph atlas", size, size);
+        return false;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, clear_pixels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    atlas.texture = texture;
+    atlas.size = size;
+    atlas_bytes += (size_t)size * size * 4;
+    atlas.pen_x = 0;
+    atlas.pen_y = 0;
+    atlas.row_height = 0;
+    return true;
+}
+
+bool TextRenderer::grow_atlas(GlyphAtlas& atlas) {
+    if (atlas.size * 2 > GLYPH_ATLAS_MAX_SIZE) {
+        LOG_WARN(RENDER, "TextRenderer: glyph atlas full at %dx%d, skipping new glyphs", atlas.size, atlas.size);
+        return false;
+    }
+    GLuint old_texture = atlas.texture;
+    size_t old_bytes = (size_t)atlas.size * atlas.size * 4;
+    if (!create_atlas_texture(atlas, atlas.size * 2)) {
+        return false;
+    }
+    glDeleteTextures(1, &old_texture);
+    atlas_bytes -= old_bytes;
+    atlas.generation++;
+    LOG_INFO(RENDER, "TextRenderer: glyph atlas grown to %dx%d", atlas.size, atlas.size);
+    
+    // Repack everything that was there; the doubled texture always has room for it
+    for (Uint32 codepoint = 0; codepoint < 128; codepoint++) {
+        if (atlas.ascii[codepoint].ready) {
+            atlas.ascii[codepoint].ready = false;
+            rasterize_glyph(atlas, codepoint, atlas.ascii[codepoint]);
+        }
+    }
+    for (auto& pair : atlas.extended) {
+        if (pair.second.ready) {
+            pair.second.ready = false;
+            rasterize_glyph(atlas, pair.first, pair.second);
+        }
+    }
+    return true;
+}
+
 void TextRenderer::draw_text(RenderingFacade* rendering_facade, const std::string& text, 
                            const std::string& font_name, float x, float y, SDL_Color color) {
     if (!rendering_facade) {
-        SDL_Log("TextRenderer::draw_text() - No RenderingFacade available");
+        LOG_WARN(RENDER, "TextRenderer::draw_text() - No RenderingFacade available");
         return;
     }
     
@@ -156,14 +465,14 @@ void TextRenderer::draw_text(RenderingFacade* rendering_facade, const std::strin
     auto result = rendering_facade->render_text(text, position, font_name, color.r, color.g, color.b);
     
     if (!result.is_ok()) {
-        SDL_Log("TextRenderer::draw_text() failed: %s", result.get_error_message().c_str());
+        LOG_WARN(RENDER, "TextRenderer::draw_text() failed: %s", result.get_error_message().c_str());
     }
 }
 
 void TextRenderer::draw_text_centered(RenderingFacade* rendering_facade, const std::string& text, 
                                     const std::string& font_name, float center_x, float y, SDL_Color color) {
     if (!rendering_facade) {
-        SDL_Log("TextRenderer::draw_text_centered() - No RenderingFacade available");
+        LOG_WARN(RENDER, "TextRenderer::draw_text_centered() - No RenderingFacade available");
         return;
     }
     
@@ -173,6 +482,6 @@ void TextRenderer::draw_text_centered(RenderingFacade* rendering_facade, const s
     auto result = rendering_facade->render_text(text, position, font_name, color.r, color.g, color.b);
     
     if (!result.is_ok()) {
-        SDL_Log("TextRenderer::draw_text_centered() failed: %s", result.get_error_message().c_str());
+        LOG_WARN(RENDER, "TextRenderer::draw_text_centered() failed: %s", result.get_error_message().c_str());
     }
 }
\ No newline at end of file
@@ -3,9 +3,13 @@
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
 #include <glad/gl.h>
+#include <atomic>
+#include <cstdint>
+#include <list>
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 // Forward declarations
 class RenderingFacade;
@@ -16,6 +20,7 @@ struct TextTexture {
     int width;
     int height;
     std::string text;
+    std::string font_name;
     SDL_Color color;
     TTF_Font* font;
     
@@ -23,6 +28,22 @@ struct TextTexture {
     ~TextTexture();
 };
 
+// Un quad por glifo, relativo a la esquina superior izquierda del texto
+struct GlyphQuad {
+    float x, y, w, h;
+    float u0, v0, u1, v1;
+};
+
+// Contadores de la caché de render_text(); bytes = ancho * alto * 4 de cada textura
+struct TextCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t bytes;
+    size_t budget_bytes;
+};
+
 class TextRenderer {
 public:
     TextRenderer();
@@ -35,9 +56,21 @@ public:
     bool load_font(const std::string& name, const std::string& path, int size);
     TTF_Font* get_font(const std::string& name);
     
-    // Text rendering
+    // Glyph atlas: the whole string is drawn from one texture per font, no GL objects per string.
+    // Fills `quads` (cleared first) and returns the atlas texture, or 0 if the font is unknown.
+    GLuint layout_text(const std::string& text, const std::string& font_name,
+                       std::vector<GlyphQuad>& quads, int& width, int& height);
+    // Running total kept by the GL thread; safe to read from any thread (PerfHUD)
+    size_t get_atlas_bytes() const { return atlas_bytes.load(std::memory_order_relaxed); }
+    
+    // Text rendering (one texture per distinct string, kept in a bounded LRU cache).
+    // The game draws through layout_text(); this only bounds memory for external callers (bench_text)
     std::shared_ptr<TextTexture> render_text(const std::string& text, const std::string& font_name, SDL_Color color);
     
+    // Least recently used textures are freed once the cache passes this size (CLANBOMBER_TEXT_CACHE_MB, default 8)
+    void set_cache_budget(size_t bytes);
+    TextCacheStats get_cache_stats() const;
+    
     // Render text directly to screen using RenderingFacade
     void draw_text(RenderingFacade* rendering_facade, const std::string& text, 
                    const std::string& font_name, float x, float y, SDL_Color color);
@@ -47,11 +80,51 @@ public:
                            const std::string& font_name, float center_x, float y, SDL_Color color);
     
 private:
+    struct Glyph {
+        float u0, v0, u1, v1;
+        int width, height;          // 0 = sin píxeles (espacio)
+        int advance;
+        bool ready;
+    };
+    
+    // Glifos blancos de una fuente; el color lo pone el vértice al dibujar
+    struct GlyphAtlas {
+        TTF_Font* font = nullptr;
+        GLuint texture = 0;
+        int size = 0;
+        int generation = 0;         // Cambia al crecer: las UV anteriores dejan de valer
+        int pen_x = 0, pen_y = 0, row_height = 0;
+        Glyph ascii[128] = {};
+        std::unordered_map<Uint32, Glyph> extended;
+    };
+    
     std::unordered_map<std::string, TTF_Font*> fonts;
-    std::unordered_map<std::string, std::shared_ptr<TextTexture>> text_cache;
+    std::unordered_map<std::string, std::unique_ptr<GlyphAtlas>> atlases;   // Solo hilo GL
+    std::atomic<size_t> atlas_bytes;    // Suma de las texturas de atlases
+    
+    // LRU: la lista va de más a menos reciente; el mapa indexa por hash de (texto, fuente, RGBA)
+    struct CacheEntry {
+        uint64_t key;
+        std::shared_ptr<TextTexture> texture;
+        size_t bytes;
+    };
+    std::list<CacheEntry> cache_lru;
+    std::unordered_map<uint64_t, std::list<CacheEntry>::iterator> text_cache;
+    size_t cache_bytes;
+    size_t cache_budget_bytes;
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+    uint64_t cache_evictions;
     
     GLuint create_gl_texture_from_surface(SDL_Surface* surface);
-    std::string make_cache_key(const std::string& text, const std::string& font_name, SDL_Color color);
+    static uint64_t make_cache_key(const std::string& text, const std::string& font_name, SDL_Color color);
+    void evict_to_budget();
+    
+    GlyphAtlas* get_atlas(const std::string& font_name);
+    const Glyph* find_glyph(GlyphAtlas& atlas, Uint32 codepoint);
+    bool rasterize_glyph(GlyphAtlas& atlas, Uint32 codepoint, Glyph& glyph);
+    bool create_atlas_texture(GlyphAtlas& atlas, int size);
+    bool grow_atlas(GlyphAtlas& atlas);
     
     bool ttf_initialized;
 };
\ No newline at end of file
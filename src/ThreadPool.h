@@ -0,0 +1,50 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Pool fijo de hilos para trabajos independientes (carga de assets)
+ *
+ * Cola FIFO única protegida por mutex: pensada para decenas de trabajos de
+ * milisegundos (decodificar un PNG), no para millones de tareas pequeñas.
+ * Los trabajos no deben tocar GL ni estado del juego sin sincronizar.
+ */
+class ThreadPool {
+public:
+    /**
+     * @param threads 0 = uno por núcleo menos el hilo principal (mínimo 1)
+     */
+    explicit ThreadPool(unsigned int threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(std::function<void()> job);
+
+    /**
+     * @brief Bloquea hasta que la cola esté vacía y ningún trabajo en curso
+     */
+    void wait_idle();
+
+    unsigned int get_thread_count() const { return (unsigned int)workers.size(); }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable job_ready;
+    std::condition_variable idle;
+    unsigned int busy;
+    bool stopping;
+
+    void worker_loop();
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "ThrownBomb.h"
+#include "Logger.h"
 #include "Timer.h"
 #include "Resources.h"
 #include "MapTile.h"
@@ -21,7 +22,7 @@ ThrownBomb::ThrownBomb(int _x, int _y, int _power, Bomber* _owner,
     
     calculate_flight_path();
     
-    SDL_Log("ThrownBomb created: from (%.1f,%.1f) to (%.1f,%.1f), duration=%.2fs", 
+    LOG_DEBUG(GAME, "ThrownBomb created: from (%.1f,%.1f) to (%.1f,%.1f), duration=%.2fs", 
             start_x, start_y, target_x, target_y, flight_duration);
 }
 
@@ -56,7 +57,7 @@ void ThrownBomb::act(float deltaTime) {
             remove_bomb_from_tile(this);  // Remove from old position
             set_bomb_on_tile(this);       // Set at new position
             
-            SDL_Log("ThrownBomb landed at grid (%d,%d)", get_map_x(), get_map_y());
+            LOG_DEBUG(GAME, "ThrownBomb landed at grid (%d,%d)", get_map_x(), get_map_y());
         } else {
             // Flying animation - parabolic arc
             float ease_progress = progress; // Linear for now, could add easing
@@ -85,9 +86,11 @@ void ThrownBomb::show() {
         float arc_progress = 4.0f * progress * (1.0f - progress); // Parabola
         float visual_offset = arc_height * arc_progress;
         
-        // Temporarily offset Y position for rendering
+        // Temporarily offset Y position for rendering (both states, so interpolation keeps the arc)
         float original_y = y;
+        float original_prev_y = prev_y;
         y -= visual_offset; // Move up for arc effect
+        prev_y -= visual_offset;
         
         // Add slight scaling effect when high in the air
         float scale = 1.0f + (visual_offset / arc_height) * 0.3f; // Up to 30% bigger at peak
@@ -97,6 +100,7 @@ void ThrownBomb::show() {
         
         // Restore original position
         y = original_y;
+        prev_y = original_prev_y;
         
         // TODO: Add shadow effect on ground to show where bomb will land
     } else {
@@ -1,15 +1,16 @@
 #include "TileEntity.h"
+#include "Logger.h"
 #include "GameContext.h"
 #include "Resources.h"
 #include "AudioMixer.h"
 #include "Extra.h"
 #include "Timer.h"
-#include "ParticleSystem.h"
+#include "ParticleEffectsManager.h"
 #include "GPUAcceleratedRenderer.h"
 #include "GameContext.h"
 #include "CoordinateSystem.h"
 #include "MemoryManagement.h"
-#include <random>
+#include "GameRandom.h"
 #include <cmath>
 #include <SDL3/SDL.h>
 
@@ -33,7 +34,7 @@ TileEntity::TileEntity(MapTile_Pure* tile_data, GameContext* context)
     // CRITICAL: Set proper Z-order so tiles render BEHIND other objects
     z = Z_GROUND;  // Tiles should be at ground level (0), behind bombs (3000)
     
-    SDL_Log("TileEntity: Created entity for %s tile at (%d,%d)", 
+    LOG_DEBUG(MAP, "TileEntity: Created entity for %s tile at (%d,%d)", 
            tile_data->get_type() == MapTile_Pure::GROUND ? "GROUND" : 
            tile_data->get_type() == MapTile_Pure::WALL ? "WALL" : 
            tile_data->get_type() == MapTile_Pure::BOX ? "BOX" : "UNKNOWN",
@@ -50,7 +51,7 @@ TileEntity::~TileEntity() {
 void TileEntity::act(float deltaTime) {
     // DEFENSIVE: Detect corruption early
     if (tile_data == (MapTile_Pure*)0xffffffffffffffff) {
-        SDL_Log("CRITICAL: TileEntity::act() - tile_data corrupted to 0xffffffffffffffff at (%d,%d)!", get_x()/TILE_SIZE, get_y()/TILE_SIZE);
+        LOG_ERROR(MAP, "TileEntity::act() - tile_data corrupted to 0xffffffffffffffff at (%d,%d)!", get_x()/TILE_SIZE, get_y()/TILE_SIZE);
         // Try to recover by setting tile_data to nullptr to prevent further crashes
         tile_data = nullptr;
         return;
@@ -85,12 +86,12 @@ void TileEntity::show() {
 void TileEntity::destroy() {
     // DEFENSIVE: Check for corrupted tile_data
     if (!tile_data || tile_data == (MapTile_Pure*)0xffffffffffffffff) {
-        SDL_Log("ERROR: TileEntity::destroy() - corrupted tile_data pointer: %p", tile_data);
+        LOG_ERROR(MAP, "TileEntity::destroy() - corrupted tile_data pointer: %p", tile_data);
         return;
     }
     
     if (!destroyed && tile_data->can_be_destroyed()) {
-        SDL_Log("TileEntity: Destroying tile at (%d,%d)", get_map_x(), get_map_y());
+        LOG_DEBUG(MAP, "TileEntity: Destroying tile at (%d,%d)", get_map_x(), get_map_y());
         destroyed = true;
         destroy_animation = 0.0f;
         
@@ -106,17 +107,14 @@ void TileEntity::destroy() {
         AudioPosition tile_pos(get_x(), get_y(), 0.0f);
         AudioMixer::play_sound_3d("break", tile_pos, 500.0f);
     } else if (destroyed) {
-        SDL_Log("WARNING: TileEntity::destroy() called on already destroyed tile at (%d,%d)", get_map_x(), get_map_y());
+        LOG_WARN(MAP, "TileEntity::destroy() called on already destroyed tile at (%d,%d)", get_map_x(), get_map_y());
     }
 }
 
 void TileEntity::spawn_extra() {
     // Based on original ClanBomber spawn logic with balanced probabilities
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> main_dist(0, 7); // 8 main categories (0-7)
-    
-    int roll = main_dist(gen);
+    // Gameplay RNG: seeded per match so replays spawn the same extras
+    int roll = GameRandom::next_int(8); // 8 main categories (0-7)
     Extra::EXTRA_TYPE extra_type;
     
     switch (roll) {
@@ -130,13 +128,11 @@ void TileEntity::spawn_extra() {
             extra_type = Extra::SPEED;
             break;
         case 3: { // Special abilities (12.5% chance - kick or glove)
-            std::uniform_int_distribution<> special_dist(0, 1);
-            extra_type = (special_dist(gen) == 0) ? Extra::KICK : Extra::GLOVE;
+            extra_type = (GameRandom::next_int(2) == 0) ? Extra::KICK : Extra::GLOVE;
             break;
         }
         case 4: { // Negative effects (12.5% chance)
-            std::uniform_int_distribution<> negative_dist(0, 7);
-            int neg_roll = negative_dist(gen);
+            int neg_roll = GameRandom::next_int(8);
             if (neg_roll == 0 || neg_roll == 1) {
                 extra_type = Extra::DISEASE; // Constipation (25% of this case)
             } else if (neg_roll == 2 || neg_roll == 3) {
@@ -149,7 +145,7 @@ void TileEntity::spawn_extra() {
             break;
         }
         case 5: // Skate (rare, 6.25% chance)
-            if (std::uniform_int_distribution<>(0, 1)(gen) == 0) {
+            if (GameRandom::next_int(2) == 0) {
                 extra_type = Extra::SKATE;
             } else {
                 return; // No extra
@@ -175,7 +171,7 @@ void TileEntity::update_destruction_animation(float deltaTime) {
         
         // Check if animation completes and handle lifecycle through LifecycleManager
         if (destroy_animation >= 0.5f && !delete_me) {
-            SDL_Log("TileEntity at (%d,%d) completing destruction animation", get_map_x(), get_map_y());
+            LOG_DEBUG(MAP, "TileEntity at (%d,%d) completing destruction animation", get_map_x(), get_map_y());
             
             // Spawn power-up now that explosion has ended (only once!)
             spawn_extra();
@@ -223,7 +219,9 @@ void TileEntity_Box::act(float deltaTime) {
         // Add smoke particles during destruction animation  
         static float last_smoke_time = 0.0f;
         if (destroy_animation > 0.1f && last_smoke_time <= 0.1f) {
-            ParticleSystem* smoke = GameObjectFactory::getInstance().create_particle_system(get_x(), get_y(), static_cast<int>(SMOKE_TRAILS), get_context());
+            if (get_context() && get_context()->get_particle_effects()) {
+                get_context()->get_particle_effects()->spawn_emitter(get_x(), get_y(), SMOKE_TRAILS);
+            }
             last_smoke_time = destroy_animation;
         }
     }
@@ -252,18 +250,19 @@ void TileEntity_Box::destroy() {
                 get_context()->get_renderer()->emit_particles(get_x(), get_y(), 25, GPUAcceleratedRenderer::SPARK, nullptr, 1.0f);
                 get_context()->get_renderer()->emit_particles(get_x(), get_y(), 15, GPUAcceleratedRenderer::SMOKE, nullptr, 2.0f);
                 
-                SDL_Log("SPECTACULAR tile destruction effects at (%d,%d)!", get_x(), get_y());
+                LOG_DEBUG(MAP, "SPECTACULAR tile destruction effects at (%d,%d)!", get_x(), get_y());
             }
             
-            // Add traditional particle effects for destruction using ObjectPool pattern
-            ParticleSystem* dust = GameObjectFactory::getInstance().create_particle_system(get_x(), get_y(), static_cast<int>(DUST_CLOUDS), get_context());
-            
-            ParticleSystem* sparks = GameObjectFactory::getInstance().create_particle_system(get_x(), get_y(), static_cast<int>(EXPLOSION_SPARKS), get_context());
+            // Add traditional particle effects for destruction (pooled by ParticleEffectsManager)
+            if (get_context() && get_context()->get_particle_effects()) {
+                get_context()->get_particle_effects()->spawn_emitter(get_x(), get_y(), DUST_CLOUDS);
+                get_context()->get_particle_effects()->spawn_emitter(get_x(), get_y(), EXPLOSION_SPARKS);
+            }
             
             // Update rate limiting timestamp
             last_particle_emission_time = current_time;
         } else {
-            SDL_Log("Particle emission rate limited for tile at (%d,%d)", get_x(), get_y());
+            LOG_DEBUG(MAP, "Particle emission rate limited for tile at (%d,%d)", get_x(), get_y());
         }
     }
 }
@@ -437,7 +436,7 @@ void TileEntity_Box::render_fragmentation_effects() {
                 return; // Spectacular GPU effect rendered successfully!
                 
             } catch (...) {
-                SDL_Log("GPU fragmentation failed, falling back to base effect");
+                LOG_WARN(MAP, "GPU fragmentation failed, falling back to base effect");
                 // Fall through to base rendering
             }
         }
@@ -2,6 +2,7 @@
 #define TILEENTITY_H
 
 #include "GameObject.h"
+#include "Logger.h"
 #include "MapTile_Pure.h"
 
 /**
@@ -29,21 +30,21 @@ public:
     // === TILE PROPERTIES (DELEGATED) ===
     bool is_blocking() const { 
         if (!tile_data || tile_data == (MapTile_Pure*)0xffffffffffffffff) {
-            SDL_Log("ERROR: TileEntity::is_blocking() - corrupted tile_data pointer: %p", tile_data);
+            LOG_ERROR(MAP, "TileEntity::is_blocking() - corrupted tile_data pointer: %p", tile_data);
             return false;
         }
         return tile_data->is_blocking(); 
     }
     bool is_destructible() const { 
         if (!tile_data || tile_data == (MapTile_Pure*)0xffffffffffffffff) {
-            SDL_Log("ERROR: TileEntity::is_destructible() - corrupted tile_data pointer: %p (TileEntity at %p)", tile_data, this);
+            LOG_ERROR(MAP, "TileEntity::is_destructible() - corrupted tile_data pointer: %p (TileEntity at %p)", tile_data, this);
             return false;
         }
         return tile_data->is_destructible(); 
     }
     bool is_burnable() const { 
         if (!tile_data || tile_data == (MapTile_Pure*)0xffffffffffffffff) {
-            SDL_Log("ERROR: TileEntity::is_burnable() - corrupted tile_data pointer: %p", tile_data);
+            LOG_ERROR(MAP, "TileEntity::is_burnable() - corrupted tile_data pointer: %p", tile_data);
             return false;
         }
         return tile_data->is_burnable(); 
@@ -1,4 +1,5 @@
 #include "TileManager.h"
+#include "Logger.h"
 #include "GameContext.h"
 #include "Map.h"
 #include "MapTile.h"
@@ -14,16 +15,16 @@
 static constexpr int TILE_SIZE = CoordinateConfig::TILE_SIZE;
 
 TileManager::TileManager(GameContext* context) : context(context) {
-    SDL_Log("TileManager: Initialized intelligent tile coordination system");
+    LOG_INFO(MAP, "TileManager: Initialized intelligent tile coordination system");
 }
 
 void TileManager::set_context(GameContext* new_context) {
     context = new_context;
-    SDL_Log("TileManager: GameContext set to %p", context);
+    LOG_DEBUG(MAP, "TileManager: GameContext set to %p", context);
 }
 
 TileManager::~TileManager() {
-    SDL_Log("TileManager: Shutdown complete");
+    LOG_INFO(MAP, "TileManager: Shutdown complete");
 }
 
 // === COORDINACIÓN PRINCIPAL ===
@@ -56,7 +57,7 @@ void TileManager::handle_tile_updates() {
 
 void TileManager::coordinate_with_lifecycle_manager() {
     if (!context->get_lifecycle_manager()) {
-        SDL_Log("TileManager: ERROR - No LifecycleManager available for coordination");
+        LOG_ERROR(MAP, "TileManager: ERROR - No LifecycleManager available for coordination");
         return;
     }
     
@@ -71,7 +72,7 @@ void TileManager::process_dying_tiles() {
         
         LifecycleManager::ObjectState state = context->get_lifecycle_manager()->get_tile_state(tile);
         if (state == LifecycleManager::ObjectState::DYING) {
-            SDL_Log("TileManager: Tile at (%d,%d) is dying - monitoring", x, y);
+            LOG_DEBUG(MAP, "TileManager: Tile at (%d,%d) is dying - monitoring", x, y);
             // Tile está en animación de muerte - solo monitorear
         }
     });
@@ -83,7 +84,7 @@ void TileManager::process_dead_tiles() {
         
         LifecycleManager::ObjectState state = context->get_lifecycle_manager()->get_tile_state(tile);
         if (state == LifecycleManager::ObjectState::DELETED) {
-            SDL_Log("TileManager: Tile at (%d,%d) ready for replacement - executing", x, y);
+            LOG_DEBUG(MAP, "TileManager: Tile at (%d,%d) ready for replacement - executing", x, y);
             replace_tile_when_ready(x, y, MapTile::GROUND);
         }
     });
@@ -94,7 +95,7 @@ void TileManager::process_dead_tiles() {
 void TileManager::request_tile_destruction(int map_x, int map_y) {
     if (!is_valid_position(map_x, map_y)) return;
     
-    SDL_Log("TileManager: Processing destruction request for tile at (%d,%d)", map_x, map_y);
+    LOG_DEBUG(MAP, "TileManager: Processing destruction request for tile at (%d,%d)", map_x, map_y);
     
     bool tile_destroyed = false;
     Bomb* bomb_to_explode = nullptr;
@@ -102,7 +103,7 @@ void TileManager::request_tile_destruction(int map_x, int map_y) {
     // DUAL ARCHITECTURE COORDINATION: Handle legacy MapTile first
     MapTile* legacy_tile = context->get_map()->get_tile(map_x, map_y);
     if (legacy_tile && legacy_tile->is_burnable()) {
-        SDL_Log("TileManager: Destroying legacy MapTile at (%d,%d)", map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Destroying legacy MapTile at (%d,%d)", map_x, map_y);
         legacy_tile->destroy();
         tile_destroyed = true;
         if (legacy_tile->bomb && !bomb_to_explode) {
@@ -114,7 +115,7 @@ void TileManager::request_tile_destruction(int map_x, int map_y) {
     if (!tile_destroyed) {
         TileEntity* tile_entity = context->get_map()->get_tile_entity(map_x, map_y);
         if (tile_entity && !tile_entity->is_destroyed() && tile_entity->is_destructible()) {
-            SDL_Log("TileManager: Destroying TileEntity at (%d,%d)", map_x, map_y);
+            LOG_DEBUG(MAP, "TileManager: Destroying TileEntity at (%d,%d)", map_x, map_y);
             tile_entity->destroy();
             tile_destroyed = true;
             if (tile_entity->get_bomb() && !bomb_to_explode) {
@@ -129,9 +130,9 @@ void TileManager::request_tile_destruction(int map_x, int map_y) {
     }
     
     if (tile_destroyed) {
-        SDL_Log("TileManager: Destruction completed for tile at (%d,%d)", map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Destruction completed for tile at (%d,%d)", map_x, map_y);
     } else {
-        SDL_Log("TileManager: No destructible tile found at (%d,%d)", map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: No destructible tile found at (%d,%d)", map_x, map_y);
     }
 }
 
@@ -226,7 +227,7 @@ void TileManager::register_bomb_at(int map_x, int map_y, Bomb* bomb) {
     MapTile* tile = get_tile_at(map_x, map_y);
     if (tile && bomb) {
         tile->set_bomb(bomb);
-        SDL_Log("TileManager: Registered bomb %p at (%d,%d)", bomb, map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Registered bomb %p at (%d,%d)", bomb, map_x, map_y);
     }
 }
 
@@ -234,7 +235,7 @@ void TileManager::unregister_bomb_at(int map_x, int map_y) {
     MapTile* tile = get_tile_at(map_x, map_y);
     if (tile) {
         tile->set_bomb(nullptr);
-        SDL_Log("TileManager: Unregistered bomb at (%d,%d)", map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Unregistered bomb at (%d,%d)", map_x, map_y);
     }
 }
 
@@ -242,9 +243,9 @@ void TileManager::unregister_bomb_at(int map_x, int map_y, Bomb* bomb) {
     MapTile* tile = get_tile_at(map_x, map_y);
     if (tile && tile->get_bomb() == bomb) {
         tile->set_bomb(nullptr);
-        SDL_Log("TileManager: Unregistered bomb %p at (%d,%d) with safety check", bomb, map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Unregistered bomb %p at (%d,%d) with safety check", bomb, map_x, map_y);
     } else if (tile && tile->get_bomb() != bomb) {
-        SDL_Log("WARNING: TileManager: Attempted to unregister bomb %p at (%d,%d) but found different bomb %p", 
+        LOG_WARN(MAP, "TileManager: Attempted to unregister bomb %p at (%d,%d) but found different bomb %p", 
                 bomb, map_x, map_y, tile->get_bomb());
     }
 }
@@ -258,7 +259,7 @@ void TileManager::register_bomber_at(int map_x, int map_y, Bomber* bomber) {
     MapTile* tile = get_tile_at(map_x, map_y);
     if (tile && bomber) {
         tile->set_bomber(bomber);
-        SDL_Log("TileManager: Registered bomber %p at (%d,%d)", bomber, map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Registered bomber %p at (%d,%d)", bomber, map_x, map_y);
     }
 }
 
@@ -266,7 +267,7 @@ void TileManager::unregister_bomber_at(int map_x, int map_y) {
     MapTile* tile = get_tile_at(map_x, map_y);
     if (tile) {
         tile->set_bomber(nullptr);
-        SDL_Log("TileManager: Unregistered bomber at (%d,%d)", map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Unregistered bomber at (%d,%d)", map_x, map_y);
     }
 }
 
@@ -284,9 +285,10 @@ bool TileManager::has_bomber_at(int map_x, int map_y) {
 void TileManager::iterate_all_tiles(std::function<void(MapTile*, int, int)> callback) {
     if (!context->get_map() || !callback) return;
     
-    for (int x = 0; x < CoordinateConfig::MAX_GRID_WIDTH; x++) {
-        for (int y = 0; y < CoordinateConfig::MAX_GRID_HEIGHT; y++) {
-            MapTile* tile = context->get_map()->get_tile(x, y);
+    Map* map = context->get_map();
+    for (int x = 0; x < map->get_width(); x++) {
+        for (int y = 0; y < map->get_height(); y++) {
+            MapTile* tile = map->get_tile(x, y);
             callback(tile, x, y);
         }
     }
@@ -322,7 +324,7 @@ void TileManager::update_single_tile(MapTile* tile, int map_x, int map_y) {
     
     // Si el tile se marcó para destrucción, lo procesaremos en el próximo update
     if (tile->delete_me) {
-        SDL_Log("TileManager: Tile at (%d,%d) marked for destruction", map_x, map_y);
+        LOG_DEBUG(MAP, "TileManager: Tile at (%d,%d) marked for destruction", map_x, map_y);
     }
 }
 
@@ -330,14 +332,14 @@ void TileManager::handle_tile_destruction_request(int map_x, int map_y) {
     MapTile* tile = get_tile_at(map_x, map_y);
     if (!tile) return;
     
-    SDL_Log("TileManager: Handling destruction request for tile at (%d,%d)", map_x, map_y);
+    LOG_DEBUG(MAP, "TileManager: Handling destruction request for tile at (%d,%d)", map_x, map_y);
     request_tile_destruction(map_x, map_y);
 }
 
 void TileManager::perform_tile_replacement(int map_x, int map_y, int new_tile_type) {
     if (!context->get_map()) return;
     
-    SDL_Log("TileManager: Replacing tile at (%d,%d) with type %d", map_x, map_y, new_tile_type);
+    LOG_DEBUG(MAP, "TileManager: Replacing tile at (%d,%d) with type %d", map_x, map_y, new_tile_type);
     
     // Eliminar tile anterior
     MapTile* old_tile = get_tile_at(map_x, map_y);
@@ -354,7 +356,7 @@ void TileManager::perform_tile_replacement(int map_x, int map_y, int new_tile_ty
     // Actualizar grid usando el setter
     context->get_map()->set_tile(map_x, map_y, new_tile);
     
-    SDL_Log("TileManager: Tile replacement complete at (%d,%d)", map_x, map_y);
+    LOG_DEBUG(MAP, "TileManager: Tile replacement complete at (%d,%d)", map_x, map_y);
 }
 
 // === VALIDACIÓN ===
@@ -4,6 +4,8 @@
 Uint64 Timer::last_tick = 0;
 Uint64 Timer::performance_frequency = 0;
 float Timer::delta_time = 0.0f;
+float Timer::real_delta_time = 0.0f;
+float Timer::alpha = 1.0f;
 
 void Timer::init() {
     performance_frequency = SDL_GetPerformanceFrequency();
@@ -13,9 +15,26 @@ void Timer::init() {
 void Timer::tick() {
     Uint64 current_tick = SDL_GetPerformanceCounter();
     delta_time = static_cast<float>(current_tick - last_tick) / performance_frequency;
+    real_delta_time = delta_time;
     last_tick = current_tick;
 }
 
 float Timer::time_elapsed() {
     return delta_time;
 }
+
+void Timer::set_time_elapsed(float seconds) {
+    delta_time = seconds;
+}
+
+float Timer::frame_time() {
+    return real_delta_time;
+}
+
+void Timer::set_interpolation_alpha(float _alpha) {
+    alpha = _alpha;
+}
+
+float Timer::interpolation_alpha() {
+    return alpha;
+}
@@ -8,11 +8,23 @@ public:
     static void init();
     static void tick();
     static float time_elapsed();
+    
+    // Fija el delta del frame sin mirar el reloj (paso fijo, simulación headless, benchmarks)
+    static void set_time_elapsed(float seconds);
+
+    // Duración real del último frame (tick() a tick()), independiente del paso de simulación
+    static float frame_time();
+
+    // Fracción 0..1 entre el estado simulado anterior y el actual (ver FramePacer)
+    static void set_interpolation_alpha(float alpha);
+    static float interpolation_alpha();
 
 private:
     static Uint64 last_tick;
     static Uint64 performance_frequency;
     static float delta_time;
+    static float real_delta_time;
+    static float alpha;
 };
 
 #endif
\ No newline at end of file
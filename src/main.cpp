@@ -1,7 +1,12 @@
 #include "Game.h"
+#include "Logger.h"
 
 int main(int argc, char* argv[]) {
-    Game game;
-    game.run();
+    Logger::init();
+    {
+        Game game;
+        game.run();
+    }
+    Logger::shutdown();
     return 0;
-}
\ No newline at end of file
+}
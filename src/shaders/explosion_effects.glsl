@@ -90,7 +90,7 @@ bool processExplosionEffect(
     }
     
     float t = explosion_age;
-    float tile_size = 40.0;
+    float tile_size = uTileSize; // Declarado por el shader que incluye este fichero
     
     // SISTEMA LIMPIO: WorldPos ya viene en coordenadas mundiales correctas
     // Solo calcular el offset desde el centro de explosión
@@ -0,0 +1,30 @@
+#version 330 core
+
+// Fragment shader del renderer instanciado de explosiones.
+// Los parámetros llegan por instancia (flat), no por uniforms globales.
+in vec3 WorldPos;
+flat in vec4 ExplosionCenter;
+flat in vec4 ExplosionSize;
+
+out vec4 FragColor;
+
+uniform vec4 uTimeData; // x=time, y=sin(time), z=cos(time), w=time*2
+uniform float uTileSize; // Compartido con el vertex shader, fijado al enlazar
+
+#include "explosion_effects.glsl"
+
+void main() {
+    vec4 explosionColor;
+    bool processed = processExplosionEffect(
+        WorldPos,
+        ExplosionCenter,
+        ExplosionSize,
+        uTimeData.x,
+        explosionColor
+    );
+
+    if (!processed || explosionColor.a <= 0.0) {
+        discard; // Fuera de la cruz o explosión terminada
+    }
+    FragColor = explosionColor;
+}
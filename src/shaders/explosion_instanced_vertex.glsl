@@ -0,0 +1,47 @@
+#version 330 core
+
+// Instanced explosion renderer: una instancia por explosión.
+// Cada instancia se expande a 3 quads sin solapamiento (18 vértices):
+//   quad 0 = haz horizontal (incluye el tile central)
+//   quad 1 = brazo superior, quad 2 = brazo inferior
+layout (location = 0) in vec4 aCenterAge; // x,y=center, z=age, w=unused
+layout (location = 1) in vec4 aArms;      // x=up, y=down, z=left, w=right (in tiles)
+
+out vec3 WorldPos;
+flat out vec4 ExplosionCenter;
+flat out vec4 ExplosionSize;
+
+uniform mat4 uProjection;
+uniform mat4 uView;
+uniform float uTileSize; // CoordinateConfig::TILE_SIZE, fijado al enlazar
+
+const vec2 CORNERS[6] = vec2[6](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),
+    vec2(0.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0)
+);
+
+void main() {
+    int quad = gl_VertexID / 6;
+    vec2 corner = CORNERS[gl_VertexID % 6];
+    float half_tile = uTileSize * 0.5;
+
+    vec2 min_offset;
+    vec2 max_offset;
+    if (quad == 0) {
+        min_offset = vec2(-(aArms.z * uTileSize + half_tile), -half_tile);
+        max_offset = vec2(  aArms.w * uTileSize + half_tile,   half_tile);
+    } else if (quad == 1) {
+        min_offset = vec2(-half_tile, -(aArms.x * uTileSize + half_tile));
+        max_offset = vec2( half_tile, -half_tile);
+    } else {
+        min_offset = vec2(-half_tile, half_tile);
+        max_offset = vec2( half_tile, aArms.y * uTileSize + half_tile);
+    }
+
+    vec2 pos = aCenterAge.xy + mix(min_offset, max_offset, corner);
+
+    WorldPos = vec3(pos, 0.0);
+    ExplosionCenter = vec4(aCenterAge.xyz, 1.0); // w=active
+    ExplosionSize = aArms;
+    gl_Position = uProjection * uView * vec4(WorldPos, 1.0);
+}
@@ -0,0 +1,136 @@
+#include "AssetPack.h"
+#include "AudioMixer.h"
+#include "Logger.h"
+#include "MapEntry.h"
+#include "Resources.h"
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+/**
+ * clanbomber-pack: genera data/clanbomber.pack a partir de data/
+ *
+ *   clanbomber-pack <raíz con data/> <fichero de salida>
+ *   clanbomber-pack --convert-maps <directorio de mapas>
+ *
+ * Recorre los mismos manifiestos que Resources::begin_loading, así que un
+ * asset nuevo solo se añade en un sitio. Las texturas se guardan en RGBA32
+ * y los sonidos en el formato de AudioMixer::make_device_spec().
+ * --convert-maps escribe un .cbm (formato binario de MapEntry) junto a cada .map.
+ */
+
+static bool pack_texture(AssetPack::Writer& writer, const std::string& root,
+                         const Resources::TextureManifestEntry& texture) {
+    SDL_Surface* surface = IMG_Load((root + texture.path).c_str());
+    if (!surface) {
+        LOG_WARN(RESOURCE, "clanbomber-pack: cannot load %s: %s", texture.path, SDL_GetError());
+        return false;
+    }
+    SDL_Surface* rgba = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(surface);
+    if (!rgba) {
+        LOG_WARN(RESOURCE, "clanbomber-pack: cannot convert %s: %s", texture.path, SDL_GetError());
+        return false;
+    }
+    // The runtime uploads the pack bytes as tightly packed rows
+    bool added = rgba->pitch == rgba->w * 4 && writer.add_texture(texture.name, rgba->w, rgba->h, rgba->pixels);
+    SDL_DestroySurface(rgba);
+    return added;
+}
+
+static bool pack_sound(AssetPack::Writer& writer, const std::string& root,
+                       const Resources::SoundManifestEntry& sound) {
+    SDL_AudioSpec source_spec;
+    Uint8* source = nullptr;
+    Uint32 source_length = 0;
+    if (!SDL_LoadWAV((root + sound.path).c_str(), &source_spec, &source, &source_length)) {
+        LOG_WARN(RESOURCE, "clanbomber-pack: cannot load %s: %s", sound.path, SDL_GetError());
+        return false;
+    }
+    SDL_AudioSpec device_spec = AudioMixer::make_device_spec();
+    Uint8* pcm = nullptr;
+    int pcm_length = 0;
+    bool converted = SDL_ConvertAudioSamples(&source_spec, source, (int)source_length,
+                                             &device_spec, &pcm, &pcm_length);
+    SDL_free(source);
+    if (!converted) {
+        LOG_WARN(RESOURCE, "clanbomber-pack: cannot convert %s: %s", sound.path, SDL_GetError());
+        return false;
+    }
+    bool added = writer.add_sound(sound.name, device_spec, pcm, (uint32_t)pcm_length);
+    SDL_free(pcm);
+    return added;
+}
+
+static int convert_maps(const std::filesystem::path& maps_dir) {
+    std::error_code error;
+    int converted = 0, failed = 0;
+    for (const auto& file : std::filesystem::directory_iterator(maps_dir, error)) {
+        if (file.path().extension() != ".map") {
+            continue;
+        }
+        MapEntry map(file.path().string());
+        std::filesystem::path output = file.path();
+        output.replace_extension(".cbm");
+        if (map.load_header() && map.save_binary(output.string())) {
+            converted++;
+        } else {
+            failed++;
+        }
+    }
+    if (error) {
+        LOG_ERROR(MAP, "clanbomber-pack: cannot read %s", maps_dir.string().c_str());
+        return 1;
+    }
+    LOG_INFO(MAP, "clanbomber-pack: converted %d maps (%d failed)", converted, failed);
+    return failed > 0 ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s <data root> <output.pack>\n", argv[0]);
+        std::fprintf(stderr, "       %s --convert-maps <maps dir>\n", argv[0]);
+        return 2;
+    }
+    Logger::init();
+    if (std::strcmp(argv[1], "--convert-maps") == 0) {
+        int status = convert_maps(argv[2]);
+        Logger::shutdown();
+        return status;
+    }
+    if (!SDL_Init(0)) {
+        LOG_ERROR(CORE, "SDL_Init failed: %s", SDL_GetError());
+        Logger::shutdown();
+        return 1;
+    }
+
+    std::string root = argv[1];
+    if (!root.empty() && root.back() != '/' && root.back() != '\\') {
+        root += '/';
+    }
+
+    AssetPack::Writer writer;
+    int skipped = 0;
+    for (const Resources::TextureManifestEntry& texture : Resources::texture_manifest()) {
+        skipped += pack_texture(writer, root, texture) ? 0 : 1;
+    }
+    for (const Resources::SoundManifestEntry& sound : Resources::sound_manifest()) {
+        skipped += pack_sound(writer, root, sound) ? 0 : 1;
+    }
+
+    auto result = writer.save(argv[2]);
+    if (result.is_error()) {
+        LOG_ERROR(RESOURCE, "%s: %s", result.get_error_message().c_str(), argv[2]);
+    } else {
+        // Skipped assets are not fatal: the game loads them from data/
+        LOG_INFO(RESOURCE, "clanbomber-pack: wrote %zu assets to %s (%d skipped)",
+                 writer.get_entry_count(), argv[2], skipped);
+    }
+
+    SDL_Quit();
+    Logger::shutdown();
+    return result.is_error() ? 1 : 0;
+}